@@ -0,0 +1,902 @@
+/**
+ * ZeticML Assignment - Benchmark Suite
+ * Micro (kernel) and macro (model) benchmarks with console and JSON reports
+ *
+ * Flags follow Google Benchmark so its tooling can read the JSON:
+ *   --benchmark_filter=<substring>   run matching benchmarks only
+ *   --benchmark_min_time=<seconds>   minimum measured time per benchmark
+ *   --benchmark_format=console|json  report written to stdout
+ *   --benchmark_out=<file>           additionally write the JSON report
+ *   --benchmark_list_tests           print the names and exit
+ *
+ * Profiling flags (on-device runs, see the scripts' `profile` command):
+ *   --benchmark_cpus=<list>          pin the process to CPUs, e.g. 4-7 (Linux/Android)
+ *   --benchmark_qos=<class>          interactive|initiated|utility|background (Apple)
+ *   --benchmark_threads=<n>          batched models run parallel_forward_batch() on n threads
+ *   --benchmark_latency              also time every call: latency percentiles
+ *   --benchmark_sustained=<seconds>  keep running in windows to expose throttling
+ *   --benchmark_window=<seconds>     sustained window length (default 1)
+ *
+ * Each entry reports ns/call, ns/sample, GFLOP/s, bytes/sample (inputs,
+ * outputs and one read of the weights per call), heap allocations per call
+ * in the steady state and the peak resident set while it ran.
+ */
+
+#include "../src/neural_network_interface.h"
+#include "../src/model_registry.h"
+#include "../src/multi_class_classifier.h"
+#include "../src/multi_head_model.h"
+#include "../src/replicated_model.h"
+#include "../src/logistic_regression.h"
+#include "../src/graph_model.h"
+#include "../src/quantization.h"
+#include "../src/kernels.h"
+#include "../src/cpu_features.h"
+#include "../src/gemm.h"
+#include "../src/histogram.h"
+#include "../src/memory_placement.h"
+#include "../src/parallel_inference.h"
+#include "../src/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#include <sys/qos.h>
+#endif
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#ifndef ZETIC_VERSION
+#define ZETIC_VERSION "unknown"
+#endif
+#ifndef ZETIC_BUILD_TYPE
+#define ZETIC_BUILD_TYPE "unknown"
+#endif
+
+// ---------------------------------------------------------------------------
+// Heap allocation counting: every global operator new bumps one counter
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+
+void* counted_alloc(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* counted_aligned_alloc(size_t size, std::align_val_t align) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const size_t alignment = static_cast<size_t>(align);
+#if defined(_MSC_VER)
+    void* p = _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, alignment < sizeof(void*) ? sizeof(void*) : alignment, size == 0 ? 1 : size) != 0) {
+        p = nullptr;
+    }
+#endif
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void aligned_free(void* p) {
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+} // namespace
+
+void* operator new(size_t size) { return counted_alloc(size); }
+void* operator new[](size_t size) { return counted_alloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try { return counted_alloc(size); } catch (...) { return nullptr; }
+}
+void* operator new(size_t size, std::align_val_t align) { return counted_aligned_alloc(size, align); }
+void* operator new[](size_t size, std::align_val_t align) { return counted_aligned_alloc(size, align); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { aligned_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { aligned_free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { aligned_free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { aligned_free(p); }
+
+using namespace ZeticML;
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Benchmark definitions
+
+struct Benchmark {
+    std::string name;
+    size_t samples_per_call = 1;
+    double flops_per_sample = 0.0;
+    double bytes_per_sample = 0.0;
+    std::function<void()> call;
+    std::shared_ptr<void> state;       // Keeps the call's buffers alive
+};
+
+// One window of a sustained run and the device state at its end
+struct Window {
+    double seconds = 0.0;           // Since the sustained run started
+    double ns_per_call = 0.0;
+    double cpu_mhz = 0.0;           // Mean current frequency of the pinned CPUs
+    double temperature_c = 0.0;     // Hottest thermal zone
+    double power_mw = 0.0;          // Battery discharge
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations = 0;
+    double ns_per_call = 0.0;
+    double cpu_ns_per_call = 0.0;
+    double ns_per_sample = 0.0;
+    double gflops = 0.0;
+    double bytes_per_sample = 0.0;
+    double allocs_per_call = 0.0;
+    size_t peak_rss_bytes = 0;
+    Histogram latency_ns;           // Per-call samples (--benchmark_latency)
+    std::vector<Window> windows;    // --benchmark_sustained
+};
+
+struct RunOptions {
+    double min_time = 0.1;
+    bool latency = false;
+    double sustained = 0.0;
+    double window = 1.0;
+    std::vector<size_t> cpus;       // Pinned CPUs; empty = all
+};
+
+std::vector<float> make_values(size_t count, float phase, float scale = 1.0f) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = scale * std::sin(static_cast<float>(i) * 0.37f + phase);
+    }
+    return values;
+}
+
+// Multiply-adds of every Dense layer; fallback 2 flops per parameter
+double model_flops(const NeuralNetwork& model) {
+    if (const auto* graph_model = dynamic_cast<const GraphModel*>(&model)) {
+        const LayerGraph& graph = graph_model->graph();
+        double flops = 0.0;
+        for (const LayerNode& node : graph.nodes()) {
+            if (node.op == LayerOp::Dense) {
+                flops += 2.0 * graph.node(node.inputs[0]).width * node.width;
+            }
+        }
+        return flops;
+    }
+    return 2.0 * model.get_parameters().size();
+}
+
+std::string shape_name(const std::vector<size_t>& dims) {
+    std::string name;
+    for (size_t i = 0; i < dims.size(); ++i) {
+        name += (i ? "x" : "") + std::to_string(dims[i]);
+    }
+    return name;
+}
+
+struct ModelState {
+    std::unique_ptr<NeuralNetwork> model;
+    std::vector<float> input;
+    std::vector<float> output;
+    InferenceContext context;
+};
+
+Benchmark model_benchmark(const std::string& label, std::unique_ptr<NeuralNetwork> model, size_t batch,
+                          ThreadPool* pool = nullptr) {
+    auto state = std::make_shared<ModelState>();
+    state->model = std::move(model);
+    NeuralNetwork& m = *state->model;
+    state->input = make_values(batch * m.input_size(), 0.5f);
+    state->output.resize(batch * m.output_size());
+    m.prepare(state->context, batch);
+
+    Benchmark b;
+    b.name = label + "/" + shape_name(m.dimensions()) + "/batch:" + std::to_string(batch);
+    if (pool != nullptr && batch > 1) {
+        b.name += "/threads:" + std::to_string(pool->size());
+    }
+    b.samples_per_call = batch;
+    b.flops_per_sample = model_flops(m);
+    b.bytes_per_sample = (m.input_size() + m.output_size()) * sizeof(float) +
+                         static_cast<double>(m.parameter_block().size()) * sizeof(float) / batch;
+    ModelState* s = state.get();
+    if (batch == 1) {
+        b.call = [s] {
+            s->model->forward_into(Span<const float>(s->input), Span<float>(s->output), s->context);
+        };
+    } else if (pool != nullptr && batch > 1) {
+        b.call = [s, batch, pool] {
+            parallel_forward_batch(*s->model, s->input.data(), batch, s->output.data(), *pool);
+        };
+    } else {
+        b.call = [s, batch] {
+            s->model->forward_batch(s->input.data(), batch, s->output.data(), s->context);
+        };
+    }
+    b.state = state;
+    return b;
+}
+
+std::unique_ptr<NeuralNetwork> parameterized(std::unique_ptr<NeuralNetwork> model,
+                                             WeightPrecision precision = WeightPrecision::Float32) {
+    model->set_parameters(make_values(model->get_parameters().size(), 0.2f, 0.1f));
+    if (precision != WeightPrecision::Float32) {
+        model->set_weight_precision(precision);
+    }
+    return model;
+}
+
+// pool: run batched model benchmarks on it (null = single-threaded)
+std::vector<Benchmark> build_suite(ThreadPool* pool) {
+    std::vector<Benchmark> suite;
+    ModelRegistry registry;
+    const std::vector<size_t> batches = {1, 16, 256};
+
+    // Micro: kernels of the active table
+    for (size_t n : {256, 4096}) {
+        auto data = std::make_shared<std::vector<float>>(make_values(2 * n, 0.1f));
+        Benchmark b;
+        b.name = "kernel/dot/n:" + std::to_string(n);
+        b.flops_per_sample = 2.0 * n;
+        b.bytes_per_sample = 2.0 * n * sizeof(float);
+        const float* p = data->data();
+        b.call = [p, n] {
+            volatile float sink = kernels().dot(p, p + n, n);
+            (void)sink;
+        };
+        b.state = data;
+        suite.push_back(std::move(b));
+    }
+    for (size_t n : {10, 1000, 10000}) {
+        auto data = std::make_shared<std::vector<float>>(make_values(n, 0.3f, 4.0f));
+        Benchmark b;
+        b.name = "kernel/softmax/n:" + std::to_string(n);
+        b.bytes_per_sample = 2.0 * n * sizeof(float);
+        float* p = data->data();
+        b.call = [p, n] { kernels().softmax(p, n); };
+        b.state = data;
+        suite.push_back(std::move(b));
+    }
+    for (size_t M : {1, 64}) {
+        const size_t K = 256, N = 256;
+        struct GemmState {
+            std::vector<float> A, C;
+            PackedMatrix B;
+        };
+        auto state = std::make_shared<GemmState>();
+        state->A = make_values(M * K, 0.7f);
+        state->C.resize(M * N);
+        state->B = PackedMatrix(K, N);
+        state->B.pack(make_values(K * N, 0.9f, 0.1f).data(), N);
+        Benchmark b;
+        b.name = "kernel/gemm/" + std::to_string(M) + "x" + std::to_string(K) + "x" + std::to_string(N);
+        b.samples_per_call = M;
+        b.flops_per_sample = 2.0 * K * N;
+        b.bytes_per_sample = (K + N) * sizeof(float) + static_cast<double>(K) * N * sizeof(float) / M;
+        GemmState* s = state.get();
+        b.call = [s, M, K, N] {
+            gemm_packed(s->A.data(), M, K, s->B, nullptr, Epilogue::None, s->C.data(), N);
+        };
+        b.state = state;
+        suite.push_back(std::move(b));
+    }
+
+    // Macro: every model type over shapes and batch sizes
+    struct Shape {
+        std::string label;
+        std::function<std::unique_ptr<NeuralNetwork>()> make;
+    };
+    const std::vector<Shape> shapes = {
+        {"linear", [&] { return parameterized(registry.create_model("linear", 16)); }},
+        {"linear", [&] { return parameterized(registry.create_model("linear", 1024)); }},
+        {"logistic", [&] { return parameterized(registry.create_model("logistic", 16)); }},
+        {"logistic", [&] { return parameterized(registry.create_model("logistic", 1024)); }},
+        {"multiclass", [&] { return parameterized(registry.create_model("multiclass", 64, 10)); }},
+        {"multiclass", [&] { return parameterized(registry.create_model("multiclass", 256, 1000)); }},
+        {"multiclass_fp16", [&] {
+             return parameterized(registry.create_model("multiclass", 256, 1000), WeightPrecision::Float16);
+         }},
+        {"mlp", [&] { return parameterized(registry.create_model("mlp", 16, 32, 4)); }},
+        {"mlp", [&] { return parameterized(registry.create_model("mlp", 256, 512, 64)); }},
+        {"mlp_fp16", [&] {
+             return parameterized(registry.create_model("mlp", 256, 512, 64), WeightPrecision::Float16);
+         }},
+        {"mlp_int8", [&] {
+             auto mlp = parameterized(registry.create_model("mlp", 256, 512, 64));
+             const auto calibration = make_values(64 * 256, 1.3f);
+             std::unique_ptr<NeuralNetwork> quantized = quantize_model(*mlp, calibration.data(), 64);
+             return quantized;
+         }},
+    };
+    for (const Shape& shape : shapes) {
+        for (size_t batch : batches) {
+            suite.push_back(model_benchmark(shape.label, shape.make(), batch, pool));
+        }
+    }
+
+    // Macro: alternative output and input modes
+    {
+        struct TopKState {
+            MultiClassClassifier model{256, 10000};
+            std::vector<float> input;
+            std::vector<ClassScore> top;
+        };
+        auto state = std::make_shared<TopKState>();
+        state->model.set_parameters(make_values(state->model.get_parameters().size(), 0.2f, 0.1f));
+        state->input = make_values(256, 0.5f);
+        state->top.resize(5);
+        Benchmark b;
+        b.name = "multiclass_top_k/256x10000/k:5";
+        b.flops_per_sample = 2.0 * 256 * 10000;
+        b.bytes_per_sample = static_cast<double>(state->model.parameter_block().size()) * sizeof(float);
+        TopKState* s = state.get();
+        b.call = [s] { s->model.top_k_into(Span<const float>(s->input), Span<ClassScore>(s->top)); };
+        b.state = state;
+        suite.push_back(std::move(b));
+    }
+    {
+        struct SparseState {
+            LogisticRegression model{400000};
+            std::vector<uint32_t> indices;
+            std::vector<float> values;
+        };
+        auto state = std::make_shared<SparseState>();
+        state->model.set_parameters(make_values(400001, 0.2f, 0.1f));
+        for (size_t i = 0; i < 50; ++i) {
+            state->indices.push_back(static_cast<uint32_t>((i * 104729 + 17) % 400000));
+        }
+        state->values = make_values(50, 0.4f);
+        Benchmark b;
+        b.name = "logistic_sparse/400000/nnz:50";
+        b.flops_per_sample = 2.0 * 50;
+        b.bytes_per_sample = 50 * (2 * sizeof(float) + sizeof(uint32_t));
+        SparseState* s = state.get();
+        b.call = [s] {
+            volatile float sink = s->model.forward_sparse(
+                {Span<const uint32_t>(s->indices), Span<const float>(s->values)});
+            (void)sink;
+        };
+        b.state = state;
+        suite.push_back(std::move(b));
+    }
+    {
+        // Three heads over one 256-wide input: separate calls vs one fused pass
+        struct HeadsState {
+            std::vector<std::unique_ptr<NeuralNetwork>> models;
+            std::unique_ptr<MultiHeadModel> fused;
+            std::vector<float> input;
+            std::vector<float> output;
+            InferenceContext context;
+        };
+        auto state = std::make_shared<HeadsState>();
+        state->models.push_back(parameterized(registry.create_model("linear", 256)));
+        state->models.push_back(parameterized(registry.create_model("logistic", 256)));
+        state->models.push_back(parameterized(registry.create_model("multiclass", 256, 100)));
+        state->fused = MultiHeadModel::fuse({state->models[0].get(), state->models[1].get(),
+                                             state->models[2].get()});
+        state->input = make_values(256, 0.5f);
+        state->output.resize(state->fused->output_size());
+        HeadsState* s = state.get();
+
+        Benchmark separate;
+        separate.name = "heads_separate/256/1+1+100";
+        separate.flops_per_sample = 2.0 * 256 * 102;
+        separate.bytes_per_sample = 256.0 * 102 * sizeof(float);
+        separate.call = [s] {
+            float* out = s->output.data();
+            for (const auto& model : s->models) {
+                model->forward_into(Span<const float>(s->input), Span<float>(out, model->output_size()),
+                                    s->context);
+                out += model->output_size();
+            }
+        };
+        separate.state = state;
+        suite.push_back(std::move(separate));
+
+        Benchmark fused;
+        fused.name = "heads_fused/256/1+1+100";
+        fused.flops_per_sample = separate.flops_per_sample;
+        fused.bytes_per_sample = separate.bytes_per_sample;
+        fused.call = [s] {
+            s->fused->forward_into(Span<const float>(s->input), Span<float>(s->output), s->context);
+        };
+        fused.state = state;
+        suite.push_back(std::move(fused));
+    }
+    {
+        // 16 MB of hidden weights on 4 KB pages vs transparent huge pages
+        auto base = parameterized(registry.create_model("mlp", 1024, 4096, 16));
+        auto huge = std::make_unique<ReplicatedModel>(*base, HugePages::Transparent);
+        suite.push_back(model_benchmark("mlp_4k_pages", std::move(base), 1));
+        suite.push_back(model_benchmark("mlp_huge_pages", std::move(huge), 1));
+    }
+    return suite;
+}
+
+// ---------------------------------------------------------------------------
+// Device probes: best effort, 0 where the platform does not expose them
+
+bool read_number(const std::string& path, double& value) {
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
+}
+
+size_t resident_bytes() {
+#if defined(__linux__)
+    double pages = 0.0, resident = 0.0;
+    std::ifstream statm("/proc/self/statm");
+    if (statm >> pages >> resident) {
+        return static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) ==
+        KERN_SUCCESS) {
+        return static_cast<size_t>(info.resident_size);
+    }
+#endif
+    return 0;
+}
+
+// High-water mark of the resident set, since the last successful reset
+size_t peak_resident_bytes() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        unsigned long kb = 0;
+        if (std::sscanf(line.c_str(), "VmHWM: %lu kB", &kb) == 1) {
+            return static_cast<size_t>(kb) * 1024;
+        }
+    }
+#endif
+#if !defined(_WIN32)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss);            // bytes
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;     // KB
+#endif
+    }
+#endif
+    return 0;
+}
+
+// Restart the high-water mark so each benchmark reports its own peak
+// (Linux 4.0+; elsewhere the peak is the process-wide one)
+bool reset_peak_resident() {
+#if defined(__linux__)
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    return static_cast<bool>(clear_refs << "5" << std::flush);
+#else
+    return false;
+#endif
+}
+
+// Mean current frequency of `cpus` (all online CPUs when empty)
+double cpu_mhz(const std::vector<size_t>& cpus) {
+    const size_t count = cpus.empty() ? std::thread::hardware_concurrency() : cpus.size();
+    double total = 0.0;
+    size_t read = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t cpu = cpus.empty() ? i : cpus[i];
+        double khz = 0.0;
+        if (read_number("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_cur_freq",
+                        khz)) {
+            total += khz / 1000.0;
+            ++read;
+        }
+    }
+    return read == 0 ? 0.0 : total / read;
+}
+
+// Hottest thermal zone in degrees Celsius (zones report millidegrees)
+double temperature_c() {
+    double hottest = 0.0;
+    for (int zone = 0; zone < 64; ++zone) {
+        double milli = 0.0;
+        if (!read_number("/sys/class/thermal/thermal_zone" + std::to_string(zone) + "/temp", milli)) {
+            break;
+        }
+        const double celsius = milli / 1000.0;
+        if (celsius > hottest && celsius < 150.0) {    // Skip disconnected sensors
+            hottest = celsius;
+        }
+    }
+    return hottest;
+}
+
+// Battery discharge in mW from current (uA) and voltage (uV); 0 while
+// charging over USB on most devices
+double battery_power_mw() {
+    const std::string battery = "/sys/class/power_supply/battery/";
+    double current_ua = 0.0, voltage_uv = 0.0;
+    if (read_number(battery + "current_now", current_ua) && read_number(battery + "voltage_now", voltage_uv)) {
+        return std::fabs(current_ua) * voltage_uv / 1e9;
+    }
+    return 0.0;
+}
+
+// Restrict this thread, and the threads it creates afterwards, to `cpus`
+bool pin_process(const std::vector<size_t>& cpus) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(static_cast<int>(cpu), &set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+// Apple schedulers place threads on performance or efficiency cores by QoS
+// class; threads created afterwards inherit it
+bool set_qos(const std::string& name) {
+#if defined(__APPLE__)
+    qos_class_t qos;
+    if (name == "interactive") {
+        qos = QOS_CLASS_USER_INTERACTIVE;
+    } else if (name == "initiated") {
+        qos = QOS_CLASS_USER_INITIATED;
+    } else if (name == "utility") {
+        qos = QOS_CLASS_UTILITY;
+    } else if (name == "background") {
+        qos = QOS_CLASS_BACKGROUND;
+    } else {
+        return false;
+    }
+    return pthread_set_qos_class_self_np(qos, 0) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Runner
+
+Result run_benchmark(const Benchmark& b, const RunOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    reset_peak_resident();
+    b.call();   // Warm-up: grows workspaces, faults in weights
+
+    Result r;
+    uint64_t iterations = 1;
+    for (;;) {
+        const uint64_t allocations = g_allocations.load(std::memory_order_relaxed);
+        const std::clock_t cpu_start = std::clock();
+        const auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            b.call();
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const double cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+        const uint64_t allocated = g_allocations.load(std::memory_order_relaxed) - allocations;
+
+        if (seconds >= options.min_time || iterations >= (uint64_t(1) << 40)) {
+            r.name = b.name;
+            r.iterations = iterations;
+            r.ns_per_call = seconds * 1e9 / iterations;
+            r.cpu_ns_per_call = cpu_seconds * 1e9 / iterations;
+            r.ns_per_sample = r.ns_per_call / b.samples_per_call;
+            r.gflops = b.flops_per_sample / r.ns_per_sample;   // flops per ns = GFLOP/s
+            r.bytes_per_sample = b.bytes_per_sample;
+            r.allocs_per_call = static_cast<double>(allocated) / iterations;
+            break;
+        }
+        // Aim past min_time, growing by at most 10x per round
+        const double scale = seconds > 0.0 ? 1.4 * options.min_time / seconds : 10.0;
+        iterations = static_cast<uint64_t>(iterations * std::min(10.0, std::max(2.0, scale)));
+    }
+
+    if (options.latency) {
+        // Individually timed calls; the clock read (tens of ns) is included,
+        // so only model-sized calls give meaningful tails
+        const auto end = Clock::now() + std::chrono::duration<double>(options.min_time);
+        while (r.latency_ns.count() < 1000000) {
+            const auto start = Clock::now();
+            b.call();
+            const auto stop = Clock::now();
+            r.latency_ns.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+            if (stop >= end && r.latency_ns.count() >= 100) {
+                break;
+            }
+        }
+    }
+
+    if (options.sustained > 0.0) {
+        // Fixed-work windows sized from the measured rate; a slowdown in
+        // later windows at a lower clock and a higher temperature is throttling
+        const uint64_t per_window = std::max<uint64_t>(
+            1, static_cast<uint64_t>(options.window * 1e9 / std::max(r.ns_per_call, 1.0)));
+        const auto begin = Clock::now();
+        double elapsed = 0.0;
+        while (elapsed < options.sustained) {
+            const auto start = Clock::now();
+            for (uint64_t i = 0; i < per_window; ++i) {
+                b.call();
+            }
+            const auto stop = Clock::now();
+            elapsed = std::chrono::duration<double>(stop - begin).count();
+            Window w;
+            w.seconds = elapsed;
+            w.ns_per_call = std::chrono::duration<double>(stop - start).count() * 1e9 / per_window;
+            w.cpu_mhz = cpu_mhz(options.cpus);
+            w.temperature_c = temperature_c();
+            w.power_mw = battery_power_mw();
+            r.windows.push_back(w);
+        }
+    }
+
+    r.peak_rss_bytes = peak_resident_bytes();
+    return r;
+}
+
+// Last window's time per call over the first's (> 1 = slowed down)
+double throttle_ratio(const Result& r) {
+    return r.windows.empty() ? 1.0 : r.windows.back().ns_per_call / r.windows.front().ns_per_call;
+}
+
+std::string current_date() {
+    const std::time_t now = std::time(nullptr);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    return buffer;
+}
+
+// Run settings recorded in the report context
+struct ReportContext {
+    RunOptions run;
+    std::string cpus = "all";
+    std::string qos = "default";
+    size_t threads = 1;
+    bool rss_peak_per_benchmark = false;
+    size_t suite_rss_bytes = 0;     // Resident after building the selected suite
+};
+
+void write_json(std::ostream& out, const std::vector<Result>& results, const ReportContext& context) {
+    out << std::setprecision(6);
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << current_date() << "\",\n"
+        << "    \"library_version\": \"" << ZETIC_VERSION << "\",\n"
+        << "    \"library_build_type\": \"" << ZETIC_BUILD_TYPE << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"kernel_isa\": \"" << kernels().name << "\",\n"
+        << "    \"cpu_features\": \"" << cpu_features().to_string() << "\",\n"
+        << "    \"min_time\": " << context.run.min_time << ",\n"
+        << "    \"cpus\": \"" << context.cpus << "\",\n"
+        << "    \"qos\": \"" << context.qos << "\",\n"
+        << "    \"threads\": " << context.threads << ",\n"
+        << "    \"sustained\": " << context.run.sustained << ",\n"
+        << "    \"rss_peak_per_benchmark\": " << (context.rss_peak_per_benchmark ? "true" : "false") << ",\n"
+        << "    \"suite_rss_bytes\": " << context.suite_rss_bytes << "\n"
+        << "  },\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\n"
+            << "      \"name\": \"" << r.name << "\",\n"
+            << "      \"run_type\": \"iteration\",\n"
+            << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"real_time\": " << r.ns_per_call << ",\n"
+            << "      \"cpu_time\": " << r.cpu_ns_per_call << ",\n"
+            << "      \"time_unit\": \"ns\",\n"
+            << "      \"ns_per_sample\": " << r.ns_per_sample << ",\n"
+            << "      \"gflops\": " << r.gflops << ",\n"
+            << "      \"bytes_per_sample\": " << r.bytes_per_sample << ",\n"
+            << "      \"allocs_per_call\": " << r.allocs_per_call << ",\n"
+            << "      \"peak_rss_bytes\": " << r.peak_rss_bytes;
+        if (r.latency_ns.count() > 0) {
+            const Histogram& h = r.latency_ns;
+            out << ",\n      \"latency_ns\": {\"samples\": " << h.count() << ", \"min\": " << h.min()
+                << ", \"mean\": " << h.mean() << ", \"p50\": " << h.percentile(0.5)
+                << ", \"p90\": " << h.percentile(0.9) << ", \"p99\": " << h.percentile(0.99)
+                << ", \"p999\": " << h.percentile(0.999) << ", \"max\": " << h.max() << "}";
+        }
+        if (!r.windows.empty()) {
+            out << ",\n      \"throttle_ratio\": " << throttle_ratio(r) << ",\n      \"sustained_windows\": [\n";
+            for (size_t w = 0; w < r.windows.size(); ++w) {
+                const Window& window = r.windows[w];
+                out << "        {\"seconds\": " << window.seconds << ", \"ns_per_call\": " << window.ns_per_call
+                    << ", \"cpu_mhz\": " << window.cpu_mhz << ", \"temperature_c\": " << window.temperature_c
+                    << ", \"power_mw\": " << window.power_mw << "}" << (w + 1 < r.windows.size() ? "," : "")
+                    << "\n";
+            }
+            out << "      ]";
+        }
+        out << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+void print_console_header() {
+    std::cout << "Kernels: " << kernels().name << " (" << cpu_features().to_string() << ")\n"
+              << std::left << std::setw(44) << "Benchmark" << std::right
+              << std::setw(14) << "ns/call" << std::setw(12) << "ns/sample"
+              << std::setw(10) << "GFLOP/s" << std::setw(14) << "bytes/sample"
+              << std::setw(12) << "allocs/call" << std::setw(12) << "iterations" << "\n"
+              << std::string(118, '-') << std::endl;
+}
+
+void print_console_row(const Result& r) {
+    std::cout << std::left << std::setw(44) << r.name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(14) << r.ns_per_call
+              << std::setw(12) << r.ns_per_sample
+              << std::setprecision(2) << std::setw(10) << r.gflops
+              << std::setprecision(0) << std::setw(14) << r.bytes_per_sample
+              << std::setprecision(2) << std::setw(12) << r.allocs_per_call
+              << std::setw(12) << r.iterations << std::endl;
+    if (r.latency_ns.count() > 0) {
+        std::cout << "    latency ns: p50 " << r.latency_ns.percentile(0.5) << "  p90 "
+                  << r.latency_ns.percentile(0.9) << "  p99 " << r.latency_ns.percentile(0.99) << "  max "
+                  << r.latency_ns.max() << "  (" << r.latency_ns.count() << " calls)" << std::endl;
+    }
+    if (!r.windows.empty()) {
+        const Window& first = r.windows.front();
+        const Window& last = r.windows.back();
+        std::cout << std::setprecision(1) << "    sustained " << last.seconds << " s: " << first.ns_per_call
+                  << " -> " << last.ns_per_call << " ns/call (x" << std::setprecision(2) << throttle_ratio(r)
+                  << "), " << std::setprecision(0) << first.cpu_mhz << " -> " << last.cpu_mhz << " MHz, "
+                  << std::setprecision(1) << first.temperature_c << " -> " << last.temperature_c << " C"
+                  << std::endl;
+    }
+}
+
+bool flag_value(const std::string& arg, const std::string& flag, std::string& value) {
+    const std::string prefix = flag + "=";
+    if (arg.compare(0, prefix.size(), prefix) == 0) {
+        value = arg.substr(prefix.size());
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter, format = "console", out_path, value;
+    ReportContext context;
+    bool list_only = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (flag_value(arg, "--benchmark_filter", value)) {
+            filter = value;
+        } else if (flag_value(arg, "--benchmark_min_time", value)) {
+            context.run.min_time = std::atof(value.c_str());
+        } else if (flag_value(arg, "--benchmark_format", value)) {
+            format = value;
+        } else if (flag_value(arg, "--benchmark_out", value)) {
+            out_path = value;
+        } else if (arg == "--benchmark_list_tests") {
+            list_only = true;
+        } else if (flag_value(arg, "--benchmark_cpus", value)) {
+            context.cpus = value;
+            context.run.cpus = parse_cpu_list(value);
+        } else if (flag_value(arg, "--benchmark_qos", value)) {
+            context.qos = value;
+        } else if (flag_value(arg, "--benchmark_threads", value)) {
+            context.threads = static_cast<size_t>(std::max(1, std::atoi(value.c_str())));
+        } else if (arg == "--benchmark_latency") {
+            context.run.latency = true;
+        } else if (flag_value(arg, "--benchmark_sustained", value)) {
+            context.run.sustained = std::atof(value.c_str());
+        } else if (flag_value(arg, "--benchmark_window", value)) {
+            context.run.window = std::max(0.01, std::atof(value.c_str()));
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--benchmark_filter=<substring>] [--benchmark_min_time=<seconds>]\n"
+                      << "       [--benchmark_format=console|json] [--benchmark_out=<file>]"
+                      << " [--benchmark_list_tests]\n"
+                      << "       [--benchmark_cpus=<list>] [--benchmark_qos=<class>] [--benchmark_threads=<n>]\n"
+                      << "       [--benchmark_latency] [--benchmark_sustained=<seconds>]"
+                      << " [--benchmark_window=<seconds>]" << std::endl;
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (format != "console" && format != "json") {
+        std::cerr << "Unknown --benchmark_format: " << format << std::endl;
+        return 1;
+    }
+    if (context.cpus != "all" && context.run.cpus.empty()) {
+        std::cerr << "Invalid --benchmark_cpus: " << context.cpus << std::endl;
+        return 1;
+    }
+
+    // Placement first: the pool's workers inherit the affinity and QoS
+    if (!context.run.cpus.empty() && !pin_process(context.run.cpus)) {
+        std::cerr << "Cannot pin to CPUs " << context.cpus << " on this platform; running unpinned" << std::endl;
+        context.cpus = "all";
+        context.run.cpus.clear();
+    }
+    if (context.qos != "default" && !set_qos(context.qos)) {
+        std::cerr << "Cannot set QoS class " << context.qos << " on this platform" << std::endl;
+        context.qos = "default";
+    }
+    std::unique_ptr<ThreadPool> pool;
+    if (context.threads > 1) {
+        pool = std::make_unique<ThreadPool>(ThreadPool::Options{context.threads, false});
+    }
+
+    std::vector<Benchmark> suite;
+    for (Benchmark& b : build_suite(pool.get())) {
+        if (filter.empty() || b.name.find(filter) != std::string::npos) {
+            suite.push_back(std::move(b));
+        }
+    }
+    if (list_only) {
+        for (const Benchmark& b : suite) {
+            std::cout << b.name << "\n";
+        }
+        return 0;
+    }
+    context.suite_rss_bytes = resident_bytes();
+    context.rss_peak_per_benchmark = reset_peak_resident();
+
+    if (format == "console") {
+        print_console_header();
+    }
+    std::vector<Result> results;
+    for (const Benchmark& b : suite) {
+        results.push_back(run_benchmark(b, context.run));
+        if (format == "console") {
+            print_console_row(results.back());
+        }
+    }
+
+    if (format == "json") {
+        write_json(std::cout, results, context);
+    }
+    if (!out_path.empty()) {
+        std::ofstream file(out_path);
+        if (!file) {
+            std::cerr << "Cannot write " << out_path << std::endl;
+            return 1;
+        }
+        write_json(file, results, context);
+    }
+    return 0;
+}
@@ -130,14 +130,8 @@ int main() {
             std::cout << "\n--- Processing model type: \"" << config.type << "\" ---" << std::endl;
 
             // Create model polymorphically from string configuration
-            std::unique_ptr<NeuralNetwork> model;
-            if (config.dimensions.size() == 1) {
-                model = registry.create_model(config.type, config.dimensions[0]);
-            } else if (config.dimensions.size() == 2) {
-                model = registry.create_model(config.type, config.dimensions[0], config.dimensions[1]);
-            } else if (config.dimensions.size() == 3) {
-                model = registry.create_model(config.type, config.dimensions[0], config.dimensions[1], config.dimensions[2]);
-            }
+            std::unique_ptr<NeuralNetwork> model =
+                registry.create_model(config.type, ModelShape(config.dimensions));
 
             // All interactions through base class interface - true polymorphism!
             std::cout << "Created: " << model->get_model_type() << std::endl;
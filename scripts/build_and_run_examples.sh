@@ -3,19 +3,51 @@
 
 echo "Building ZeticML Examples..."
 
+source "$(dirname "$0")/kernel_isa_objects.sh"
+
 # Create build directory
 mkdir -p build_examples
 cd build_examples
 
+CXXFLAGS="-std=c++17 -Wall -Wextra -O2 -pthread -I../src"
+
+# Kernel tables first, each with its ISA flags
+echo "Compiling per-ISA kernels..."
+if ! build_kernel_isa_objects "$CXXFLAGS"; then
+    echo "❌ Build failed!"
+    exit 1
+fi
+
 echo "Compiling neural example with modular framework..."
-g++ -std=c++17 -Wall -Wextra -O2 \
-    -I../src \
+g++ $CXXFLAGS \
     ../examples/neural_example.cpp \
+    ../src/graph_model.cpp \
     ../src/linear_regression.cpp \
     ../src/logistic_regression.cpp \
     ../src/multi_class_classifier.cpp \
     ../src/two_layer_mlp.cpp \
+    ../src/fixed_shape_models.cpp \
+    ../src/gemm.cpp \
+    ../src/half_precision.cpp \
+    ../src/cpu_features.cpp \
+    ../src/kernels.cpp \
     ../src/model_registry.cpp \
+    ../src/model_cache.cpp \
+    ../src/model_handle.cpp \
+    ../src/result_cache.cpp \
+    ../src/multi_head_model.cpp \
+    ../src/memory_placement.cpp \
+    ../src/replicated_model.cpp \
+    ../src/model_loader.cpp \
+    ../src/dataset_reader.cpp \
+    ../src/dataset_file.cpp \
+    ../src/thread_pool.cpp \
+    ../src/parallel_inference.cpp \
+    ../src/batch_scheduler.cpp \
+    ../src/int8_kernels.cpp \
+    ../src/quantization.cpp \
+    ../src/instrumentation.cpp \
+    "${KERNEL_ISA_OBJECTS[@]}" \
     -o neural_example
 
 echo "✓ Examples built successfully!"
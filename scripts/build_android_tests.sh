@@ -19,6 +19,12 @@ ANDROID_ABI=${ANDROID_ABI:-"arm64-v8a"}
 ANDROID_PLATFORM=${ANDROID_PLATFORM:-"android-21"}
 BUILD_DIR="build_android"
 TEST_EXECUTABLE="neural_interface_tests"
+BENCHMARK_EXECUTABLE="zetic_benchmarks"
+BENCHMARK_ARGS=${BENCHMARK_ARGS:-""}
+RESULTS_DIR="benchmark_results"
+PROFILE_ARGS=${PROFILE_ARGS:-"--benchmark_filter=mlp --benchmark_latency --benchmark_sustained=20"}
+PROFILE_THREADS=${PROFILE_THREADS:-"1 2 4"}
+PROFILE_COOLDOWN=${PROFILE_COOLDOWN:-30}
 DEVICE_PATH="/data/local/tmp/$TEST_EXECUTABLE"
 
 # Function to check prerequisites
@@ -66,8 +72,9 @@ check_prerequisites() {
     echo "  Target: $ANDROID_ABI ($ANDROID_PLATFORM)"
 }
 
-# Function to build using our existing CMake
+# Function to build using our existing CMake (target defaults to the tests)
 build_with_cmake() {
+    local target=${1:-$TEST_EXECUTABLE}
     echo -e "${YELLOW}Building with CMake for Android...${NC}"
 
     # Create build directory
@@ -83,12 +90,12 @@ build_with_cmake() {
         -DCMAKE_BUILD_TYPE=Release
 
     # Build using our existing CMake targets
-    echo "Building neural_interface_tests target..."
-    make neural_interface_tests -j$(nproc 2>/dev/null || echo 4)
+    echo "Building $target target..."
+    make $target -j$(nproc 2>/dev/null || echo 4)
 
-    if [ -f "$TEST_EXECUTABLE" ]; then
+    if [ -f "$target" ]; then
         echo -e "${GREEN}✓ Build successful${NC}"
-        echo "Executable: $BUILD_DIR/$TEST_EXECUTABLE"
+        echo "Executable: $BUILD_DIR/$target"
     else
         echo -e "${RED}✗ Build failed - executable not found${NC}"
         exit 1
@@ -149,10 +156,120 @@ deploy_and_run() {
     fi
 }
 
+# Function to run the benchmark suite on the device and pull the JSON report
+run_benchmarks() {
+    echo -e "${YELLOW}Running benchmarks on Android device...${NC}"
+    local device_bench="/data/local/tmp/$BENCHMARK_EXECUTABLE"
+    local device_json="/data/local/tmp/$BENCHMARK_EXECUTABLE.json"
+    local model=$(adb shell getprop ro.product.model 2>/dev/null | tr -d '\r' | tr ' ' '_')
+    local result="$RESULTS_DIR/android_${ANDROID_ABI}_${model:-device}.json"
+
+    adb push "$BUILD_DIR/$BENCHMARK_EXECUTABLE" "$device_bench"
+    adb shell "chmod 755 $device_bench"
+
+    echo -e "${BLUE}Device: ${model:-Unknown}${NC}"
+    echo -e "${BLUE}================= Benchmark Output =================${NC}"
+    if adb shell "cd /data/local/tmp && ./$BENCHMARK_EXECUTABLE --benchmark_out=$device_json $BENCHMARK_ARGS"; then
+        mkdir -p "$RESULTS_DIR"
+        adb pull "$device_json" "$result"
+        echo -e "${BLUE}==================================================${NC}"
+        echo -e "${GREEN}✅ Benchmark report: $result${NC}"
+    else
+        echo -e "${RED}❌ Benchmarks failed${NC}"
+        exit 1
+    fi
+}
+
+# CPU clusters as "name:cpulist" lines, grouped by maximum frequency
+# (slowest = little, fastest = big, anything between = mid<N>)
+detect_clusters() {
+    local freqs levels count index=0
+    freqs=$(adb shell 'for c in /sys/devices/system/cpu/cpu[0-9]*; do
+        echo "${c##*cpu} $(cat $c/cpufreq/cpuinfo_max_freq 2>/dev/null || echo 0)"; done' | tr -d '\r')
+    levels=$(echo "$freqs" | awk '{print $2}' | sort -n -u)
+    count=$(echo "$levels" | wc -l)
+    for level in $levels; do
+        local name="mid$index"
+        if [ "$count" -eq 1 ]; then
+            name="all"
+        elif [ "$index" -eq 0 ]; then
+            name="little"
+        elif [ "$index" -eq $((count - 1)) ]; then
+            name="big"
+        fi
+        echo "$name:$(echo "$freqs" | awk -v f="$level" '$2 == f {print $1}' | sort -n | paste -sd, -)"
+        index=$((index + 1))
+    done
+}
+
+# Function to profile the benchmark suite per CPU cluster and thread count:
+# latency percentiles, sustained-run throttling (clock, temperature and
+# battery power per window) and peak RSS. One JSON report per run plus a
+# report.json index are pulled into $RESULTS_DIR/profile_android_*/
+run_profile() {
+    echo -e "${YELLOW}Profiling on Android device...${NC}"
+    local device_bench="/data/local/tmp/$BENCHMARK_EXECUTABLE"
+    local model=$(adb shell getprop ro.product.model 2>/dev/null | tr -d '\r' | tr ' ' '_')
+    local soc=$(adb shell getprop ro.soc.model 2>/dev/null | tr -d '\r')
+    [ -z "$soc" ] && soc=$(adb shell getprop ro.board.platform 2>/dev/null | tr -d '\r')
+    local release=$(adb shell getprop ro.build.version.release 2>/dev/null | tr -d '\r')
+    local out_dir="$RESULTS_DIR/profile_android_${ANDROID_ABI}_${model:-device}"
+
+    adb push "$BUILD_DIR/$BENCHMARK_EXECUTABLE" "$device_bench"
+    adb shell "chmod 755 $device_bench"
+    mkdir -p "$out_dir"
+
+    local clusters=$(detect_clusters)
+    echo -e "${BLUE}Device: ${model:-Unknown} (${soc:-unknown SoC}, Android ${release:-?})${NC}"
+    echo "$clusters" | sed 's/^/  cluster /'
+    echo -e "${YELLOW}Note: battery power reads 0 on most devices while USB is charging them${NC}"
+
+    local runs=""
+    for cluster in $clusters; do
+        local name=${cluster%%:*}
+        local cpus=${cluster#*:}
+        local size=$(echo "$cpus" | tr ',' '\n' | wc -l)
+        for threads in $PROFILE_THREADS; do
+            if [ "$threads" -gt "$size" ]; then
+                continue
+            fi
+            local file="profile_${name}_t${threads}.json"
+            echo -e "${BLUE}--- $name cores ($cpus), $threads thread(s) ---${NC}"
+            if ! adb shell "cd /data/local/tmp && ./$BENCHMARK_EXECUTABLE --benchmark_cpus=$cpus \
+                --benchmark_threads=$threads --benchmark_out=/data/local/tmp/$file $PROFILE_ARGS"; then
+                echo -e "${RED}❌ Profile run failed: $name cores, $threads thread(s)${NC}"
+                exit 1
+            fi
+            adb pull "/data/local/tmp/$file" "$out_dir/$file" > /dev/null
+            adb shell "rm -f /data/local/tmp/$file"
+            runs="$runs${runs:+,}
+    {\"cluster\": \"$name\", \"cpus\": \"$cpus\", \"threads\": $threads, \"report\": \"$file\"}"
+            # Start every run from the same thermal state
+            sleep "$PROFILE_COOLDOWN"
+        done
+    done
+
+    cat > "$out_dir/report.json" <<EOF
+{
+  "platform": "android",
+  "device": "${model:-unknown}",
+  "soc": "${soc:-unknown}",
+  "os_version": "${release:-unknown}",
+  "abi": "$ANDROID_ABI",
+  "profile_args": "$PROFILE_ARGS",
+  "runs": [$runs
+  ]
+}
+EOF
+    echo -e "${GREEN}✅ Profile report: $out_dir/report.json${NC}"
+}
+
 # Function to cleanup
 cleanup() {
     echo -e "${YELLOW}Cleaning up...${NC}"
     adb shell "rm -f $DEVICE_PATH" 2>/dev/null || true
+    adb shell "rm -f /data/local/tmp/$BENCHMARK_EXECUTABLE /data/local/tmp/$BENCHMARK_EXECUTABLE.json" 2>/dev/null || true
+    adb shell "rm -f /data/local/tmp/profile_*.json" 2>/dev/null || true
     adb shell "rm -rf /data/local/tmp/tests" 2>/dev/null || true
     rm -rf $BUILD_DIR 2>/dev/null || true
     echo -e "${GREEN}✓ Cleanup completed${NC}"
@@ -180,6 +297,16 @@ case "${1:-}" in
         build_with_cmake
         echo -e "${GREEN}✓ Build completed. Run without arguments to deploy and test.${NC}"
         ;;
+    "bench")
+        check_prerequisites
+        build_with_cmake $BENCHMARK_EXECUTABLE
+        run_benchmarks
+        ;;
+    "profile")
+        check_prerequisites
+        build_with_cmake $BENCHMARK_EXECUTABLE
+        run_profile
+        ;;
     "help"|"-h"|"--help")
         echo "ZeticML Android NDK Test Runner (using existing CMake)"
         echo ""
@@ -188,6 +315,11 @@ case "${1:-}" in
         echo "Commands:"
         echo "  (no args)    Build and run tests on Android device"
         echo "  build-only   Build for Android but don't deploy"
+        echo "  bench        Build and run zetic_benchmarks on the device; the JSON"
+        echo "               report is pulled into $RESULTS_DIR/"
+        echo "  profile      Run zetic_benchmarks pinned to each CPU cluster (big/little)"
+        echo "               at each thread count: latency percentiles, throttling over"
+        echo "               sustained runs, peak RSS; reports in $RESULTS_DIR/profile_android_*/"
         echo "  clean        Clean up build files and device"
         echo "  help         Show this help message"
         echo ""
@@ -195,6 +327,11 @@ case "${1:-}" in
         echo "  ANDROID_NDK_HOME    Path to Android NDK (required)"
         echo "  ANDROID_ABI         Target ABI (default: arm64-v8a)"
         echo "  ANDROID_PLATFORM    Target platform (default: android-21)"
+        echo "  BENCHMARK_ARGS      Extra zetic_benchmarks flags (e.g. --benchmark_filter=mlp)"
+        echo "  PROFILE_ARGS        zetic_benchmarks flags of every profile run"
+        echo "                      (default: $PROFILE_ARGS)"
+        echo "  PROFILE_THREADS     Thread counts to profile (default: $PROFILE_THREADS)"
+        echo "  PROFILE_COOLDOWN    Seconds of cool-down between runs (default: $PROFILE_COOLDOWN)"
         echo ""
         echo "Prerequisites:"
         echo "  - Android NDK installed with CMake support"
@@ -23,6 +23,8 @@ if [ $? -eq 0 ]; then
     echo ""
     echo "Built executables:"
     echo "  - neural_interface_tests (unit tests with doctest)"
+    echo "  - zetic_benchmarks (benchmark suite, JSON via --benchmark_format=json)"
+    echo "  - zetic_convert_dataset (text -> .zds dataset converter)"
     echo ""
     echo "Run commands:"
     echo "  ./neural_interface_tests"
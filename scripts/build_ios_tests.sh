@@ -18,6 +18,13 @@ IOS_PLATFORM=${IOS_PLATFORM:-"SIMULATOR"}  # SIMULATOR or OS
 IOS_DEPLOYMENT_TARGET=${IOS_DEPLOYMENT_TARGET:-"12.0"}
 BUILD_DIR="build_ios"
 TEST_EXECUTABLE="neural_interface_tests"
+BENCHMARK_EXECUTABLE="zetic_benchmarks"
+BENCHMARK_ARGS=${BENCHMARK_ARGS:-""}
+RESULTS_DIR="benchmark_results"
+PROFILE_ARGS=${PROFILE_ARGS:-"--benchmark_filter=mlp --benchmark_latency --benchmark_sustained=20"}
+PROFILE_THREADS=${PROFILE_THREADS:-"1 2 4"}
+PROFILE_QOS=${PROFILE_QOS:-"interactive background"}
+PROFILE_COOLDOWN=${PROFILE_COOLDOWN:-30}
 
 # Function to check prerequisites
 check_prerequisites() {
@@ -69,8 +76,9 @@ check_prerequisites() {
     echo "  Platform: $IOS_PLATFORM"
 }
 
-# Function to build using our existing CMake
+# Function to build using our existing CMake (target defaults to the tests)
 build_with_cmake() {
+    local target=${1:-$TEST_EXECUTABLE}
     echo -e "${YELLOW}Building with CMake for iOS...${NC}"
 
     # Create build directory
@@ -86,13 +94,13 @@ build_with_cmake() {
         -DCMAKE_BUILD_TYPE=Release
 
     # Build using our existing CMake targets
-    echo "Building neural_interface_tests target..."
-    make neural_interface_tests -j$(sysctl -n hw.ncpu 2>/dev/null || echo 4)
+    echo "Building $target target..."
+    make $target -j$(sysctl -n hw.ncpu 2>/dev/null || echo 4)
 
     # iOS builds create .app bundles, check for the executable inside
-    if [ -f "$TEST_EXECUTABLE.app/$TEST_EXECUTABLE" ]; then
+    if [ -f "$target.app/$target" ]; then
         echo -e "${GREEN}✓ iOS build successful${NC}"
-        echo "Executable: $BUILD_DIR/$TEST_EXECUTABLE.app/$TEST_EXECUTABLE"
+        echo "Executable: $BUILD_DIR/$target.app/$target"
     else
         echo -e "${RED}✗ iOS build failed - executable not found${NC}"
         exit 1
@@ -183,6 +191,96 @@ run_tests() {
     fi
 }
 
+# Function to run the benchmark suite on the simulator; the JSON report is
+# written from stdout (device builds are deployed via Xcode like the tests)
+run_benchmarks() {
+    local bench="$BUILD_DIR/$BENCHMARK_EXECUTABLE.app/$BENCHMARK_EXECUTABLE"
+    if [ "$IOS_PLATFORM" != "SIMULATOR" ]; then
+        echo -e "${YELLOW}Built for iOS Device; deploy via Xcode and run:${NC}"
+        echo "  $BENCHMARK_EXECUTABLE --benchmark_format=json $BENCHMARK_ARGS"
+        echo -e "${BLUE}Executable ready at: $bench${NC}"
+        return
+    fi
+
+    DEVICE_ID=$(xcrun simctl list devices available | grep "iPhone" | head -1 | grep -o '[0-9A-F-]\{36\}')
+    if [ -z "$DEVICE_ID" ]; then
+        echo -e "${RED}Error: No available iOS Simulator found${NC}"
+        exit 1
+    fi
+    xcrun simctl boot "$DEVICE_ID" 2>/dev/null || echo "Simulator already running or boot failed"
+
+    mkdir -p "$RESULTS_DIR"
+    local result="$RESULTS_DIR/ios_simulator_$(uname -m).json"
+    echo -e "${BLUE}Running benchmarks on iOS Simulator ($DEVICE_ID)...${NC}"
+    if xcrun simctl spawn "$DEVICE_ID" "$PWD/$bench" --benchmark_format=json $BENCHMARK_ARGS > "$result"; then
+        echo -e "${GREEN}✅ Benchmark report: $result${NC}"
+    else
+        echo -e "${RED}❌ Benchmarks failed on simulator${NC}"
+        exit 1
+    fi
+}
+
+# Function to profile the benchmark suite per QoS class and thread count.
+# iOS does not let processes pin threads; the QoS class is what steers them
+# to performance (interactive) or efficiency (background) cores. One JSON
+# report per run plus a report.json index go to $RESULTS_DIR/profile_ios_*/
+run_profile() {
+    local bench="$BUILD_DIR/$BENCHMARK_EXECUTABLE.app/$BENCHMARK_EXECUTABLE"
+    if [ "$IOS_PLATFORM" != "SIMULATOR" ]; then
+        echo -e "${YELLOW}Built for iOS Device; deploy via Xcode and run once per configuration:${NC}"
+        for qos in $PROFILE_QOS; do
+            for threads in $PROFILE_THREADS; do
+                echo "  $BENCHMARK_EXECUTABLE --benchmark_qos=$qos --benchmark_threads=$threads" \
+                     "--benchmark_format=json $PROFILE_ARGS"
+            done
+        done
+        echo -e "${BLUE}Executable ready at: $bench${NC}"
+        return
+    fi
+
+    DEVICE_ID=$(xcrun simctl list devices available | grep "iPhone" | head -1 | grep -o '[0-9A-F-]\{36\}')
+    if [ -z "$DEVICE_ID" ]; then
+        echo -e "${RED}Error: No available iOS Simulator found${NC}"
+        exit 1
+    fi
+    xcrun simctl boot "$DEVICE_ID" 2>/dev/null || echo "Simulator already running or boot failed"
+
+    local out_dir="$RESULTS_DIR/profile_ios_simulator_$(uname -m)"
+    mkdir -p "$out_dir"
+    echo -e "${YELLOW}Note: the simulator runs on the host's cores; profile on a device for mobile numbers${NC}"
+
+    local runs=""
+    for qos in $PROFILE_QOS; do
+        for threads in $PROFILE_THREADS; do
+            local file="profile_${qos}_t${threads}.json"
+            echo -e "${BLUE}--- QoS $qos, $threads thread(s) ---${NC}"
+            if ! xcrun simctl spawn "$DEVICE_ID" "$PWD/$bench" --benchmark_qos=$qos --benchmark_threads=$threads \
+                    --benchmark_format=json $PROFILE_ARGS > "$out_dir/$file"; then
+                echo -e "${RED}❌ Profile run failed: QoS $qos, $threads thread(s)${NC}"
+                exit 1
+            fi
+            runs="$runs${runs:+,}
+    {\"qos\": \"$qos\", \"threads\": $threads, \"report\": \"$file\"}"
+            # Start every run from the same thermal state
+            sleep "$PROFILE_COOLDOWN"
+        done
+    done
+
+    cat > "$out_dir/report.json" <<EOF
+{
+  "platform": "ios_simulator",
+  "device": "$DEVICE_ID",
+  "soc": "$(sysctl -n machdep.cpu.brand_string 2>/dev/null || echo unknown)",
+  "os_version": "$(sw_vers -productVersion 2>/dev/null || echo unknown)",
+  "abi": "$(uname -m)",
+  "profile_args": "$PROFILE_ARGS",
+  "runs": [$runs
+  ]
+}
+EOF
+    echo -e "${GREEN}✅ Profile report: $out_dir/report.json${NC}"
+}
+
 # Function to cleanup
 cleanup() {
     echo -e "${YELLOW}Cleaning up...${NC}"
@@ -238,6 +336,18 @@ case "${1:-}" in
         echo "Building for iOS Simulator..."
         main
         ;;
+    "bench")
+        check_prerequisites
+        show_system_info
+        build_with_cmake $BENCHMARK_EXECUTABLE
+        run_benchmarks
+        ;;
+    "profile")
+        check_prerequisites
+        show_system_info
+        build_with_cmake $BENCHMARK_EXECUTABLE
+        run_profile
+        ;;
     "help"|"-h"|"--help")
         echo "ZeticML iOS CMake Test Runner"
         echo ""
@@ -248,12 +358,22 @@ case "${1:-}" in
         echo "  simulator    Build and run for iOS Simulator (default)"
         echo "  device       Build for iOS Device (requires code signing for testing)"
         echo "  build-only   Build for iOS but don't run tests"
+        echo "  bench        Build and run zetic_benchmarks; the JSON report goes to $RESULTS_DIR/"
+        echo "  profile      Run zetic_benchmarks per QoS class (performance/efficiency cores)"
+        echo "               and thread count: latency percentiles, throttling over sustained"
+        echo "               runs, peak RSS; reports in $RESULTS_DIR/profile_ios_*/"
         echo "  clean        Clean up build files"
         echo "  help         Show this help message"
         echo ""
         echo "Environment Variables:"
         echo "  IOS_PLATFORM         SIMULATOR or OS (default: SIMULATOR)"
         echo "  IOS_DEPLOYMENT_TARGET iOS version (default: 12.0)"
+        echo "  BENCHMARK_ARGS       Extra zetic_benchmarks flags (e.g. --benchmark_filter=mlp)"
+        echo "  PROFILE_ARGS         zetic_benchmarks flags of every profile run"
+        echo "                       (default: $PROFILE_ARGS)"
+        echo "  PROFILE_THREADS      Thread counts to profile (default: $PROFILE_THREADS)"
+        echo "  PROFILE_QOS          QoS classes to profile (default: $PROFILE_QOS)"
+        echo "  PROFILE_COOLDOWN     Seconds of cool-down between runs (default: $PROFILE_COOLDOWN)"
         echo ""
         echo "Prerequisites:"
         echo "  - macOS with Xcode and command line tools"
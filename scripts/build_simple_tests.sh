@@ -3,20 +3,73 @@
 
 echo "Building Neural Network Interface Unit Tests..."
 
+source "$(dirname "$0")/kernel_isa_objects.sh"
+
 # Create build directory
 mkdir -p build_tests
 cd build_tests
 
+CXXFLAGS="-std=c++17 -Wall -Wextra -O2 -pthread -I../src"
+
+# Kernel tables first, each with its ISA flags
+echo "Compiling per-ISA kernels..."
+if ! build_kernel_isa_objects "$CXXFLAGS"; then
+    echo "❌ Build failed!"
+    exit 1
+fi
+
 echo "Compiling unit tests..."
 
 # Compile the unit tests with separate implementation files
-g++ -std=c++17 -Wall -Wextra -O2 \
-    -I../src \
+g++ $CXXFLAGS \
     ../tests/test_neural_interface.cpp \
+    ../tests/test_gemm.cpp \
+    ../tests/test_kernels.cpp \
+    ../tests/test_model_loader.cpp \
+    ../tests/test_model_registry.cpp \
+    ../tests/test_model_handle.cpp \
+    ../tests/test_class_paging.cpp \
+    ../tests/test_result_cache.cpp \
+    ../tests/test_multi_head_model.cpp \
+    ../tests/test_memory_placement.cpp \
+    ../tests/test_dataset_reader.cpp \
+    ../tests/test_dataset_file.cpp \
+    ../tests/test_thread_pool.cpp \
+    ../tests/test_batch_scheduler.cpp \
+    ../tests/test_quantization.cpp \
+    ../tests/test_half_precision.cpp \
+    ../tests/test_graph_model.cpp \
+    ../tests/test_top_k.cpp \
+    ../tests/test_sparse_input.cpp \
+    ../tests/test_fixed_shape_models.cpp \
+    ../tests/test_instrumentation.cpp \
+    ../src/graph_model.cpp \
     ../src/linear_regression.cpp \
     ../src/logistic_regression.cpp \
     ../src/multi_class_classifier.cpp \
     ../src/two_layer_mlp.cpp \
+    ../src/fixed_shape_models.cpp \
+    ../src/gemm.cpp \
+    ../src/half_precision.cpp \
+    ../src/cpu_features.cpp \
+    ../src/kernels.cpp \
+    ../src/model_registry.cpp \
+    ../src/model_cache.cpp \
+    ../src/model_handle.cpp \
+    ../src/result_cache.cpp \
+    ../src/multi_head_model.cpp \
+    ../src/memory_placement.cpp \
+    ../src/replicated_model.cpp \
+    ../src/model_loader.cpp \
+    ../src/dataset_reader.cpp \
+    ../src/dataset_file.cpp \
+    ../src/thread_pool.cpp \
+    ../src/parallel_inference.cpp \
+    ../src/batch_scheduler.cpp \
+    ../src/int8_kernels.cpp \
+    ../src/quantization.cpp \
+    ../src/instrumentation.cpp \
+    "${KERNEL_ISA_OBJECTS[@]}" \
     -o neural_interface_tests
 
 if [ $? -eq 0 ]; then
@@ -0,0 +1,50 @@
+#!/bin/bash
+# Per-ISA kernel objects for the plain g++ build scripts
+# Sourced by build_simple_tests.sh and build_and_run_examples.sh. Each kernel
+# translation unit gets the same target flags CMakeLists.txt gives it, so the
+# AVX2 / AVX-512 / VNNI / dotprod tables are real kernels rather than the
+# empty stubs they compile to without them.
+
+KERNEL_ISA_SOURCES=(
+    kernels_scalar kernels_sse42 kernels_avx2 kernels_avx512 kernels_neon
+    int8_kernels_scalar int8_kernels_avx2 int8_kernels_avxvnni int8_kernels_avx512vnni
+    int8_kernels_neon int8_kernels_neon_dotprod
+)
+
+compiler_accepts() {
+    echo 'int main() { return 0; }' | g++ "$@" -x c++ - -o /dev/null >/dev/null 2>&1
+}
+
+# Target flags of one kernel source, empty for the baseline ones
+kernel_isa_flags() {
+    case "$(uname -m)" in
+        x86_64|amd64|i[3-6]86)
+            case "$1" in
+                kernels_sse42) echo "-msse4.2" ;;
+                kernels_avx2) echo "-mavx2 -mfma -mf16c" ;;
+                kernels_avx512) echo "-mavx512f -mavx2 -mfma" ;;
+                int8_kernels_avx2) echo "-mavx2" ;;
+                int8_kernels_avx512vnni) echo "-mavx512f -mavx512bw -mavx512vnni" ;;
+                # AVX-VNNI needs GCC 11 / Clang 12; older compilers build the stub
+                int8_kernels_avxvnni) compiler_accepts -mavxvnni && echo "-mavx2 -mavxvnni" ;;
+            esac
+            ;;
+        aarch64|arm64)
+            case "$1" in
+                int8_kernels_neon_dotprod)
+                    compiler_accepts -march=armv8.2-a+dotprod && echo "-march=armv8.2-a+dotprod" ;;
+            esac
+            ;;
+    esac
+}
+
+# Compile every kernel source from ../src with the given common flags;
+# the object files are listed in KERNEL_ISA_OBJECTS
+build_kernel_isa_objects() {
+    local cxxflags="$1"
+    KERNEL_ISA_OBJECTS=()
+    for name in "${KERNEL_ISA_SOURCES[@]}"; do
+        g++ $cxxflags $(kernel_isa_flags "$name") -c "../src/$name.cpp" -o "$name.o" || return 1
+        KERNEL_ISA_OBJECTS+=("$name.o")
+    done
+}
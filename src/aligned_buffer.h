@@ -0,0 +1,61 @@
+/**
+ * ZeticML Assignment - Aligned Storage
+ * Cache-line aligned allocator for weight and activation buffers
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace ZeticML {
+
+// Cache line / AVX-512 register width in bytes
+constexpr size_t kSimdAlignment = 64;
+
+// Number of floats per kSimdAlignment bytes
+constexpr size_t kSimdFloats = kSimdAlignment / sizeof(float);
+
+// Round a float count up to a whole number of aligned blocks
+constexpr size_t round_up_to_simd(size_t count) {
+    return (count + kSimdFloats - 1) / kSimdFloats * kSimdFloats;
+}
+
+/**
+ * std::allocator replacement that aligns every allocation to Alignment bytes
+ */
+template <typename T, size_t Alignment = kSimdAlignment>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+} // namespace ZeticML
@@ -0,0 +1,165 @@
+/**
+ * ZeticML Assignment - Micro-Batching Request Scheduler Implementation
+ */
+
+#include "batch_scheduler.h"
+#include "parallel_inference.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ZeticML {
+
+BatchScheduler::BatchScheduler(std::shared_ptr<const NeuralNetwork> model)
+    : BatchScheduler(std::move(model), Options()) {}
+
+BatchScheduler::BatchScheduler(std::shared_ptr<const NeuralNetwork> model, const Options& options)
+    : model_(std::move(model)), options_(options) {
+    if (!model_) {
+        throw std::invalid_argument("BatchScheduler requires a model");
+    }
+    if (options_.max_batch_size == 0) {
+        throw std::invalid_argument("max_batch_size must be positive");
+    }
+    input_buffer_.resize(options_.max_batch_size * model_->input_size());
+    output_buffer_.resize(options_.max_batch_size * model_->output_size());
+    dispatcher_ = std::thread([this] { dispatch_loop(); });
+}
+
+BatchScheduler::~BatchScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_.notify_all();
+    dispatcher_.join();
+}
+
+std::future<std::vector<float>> BatchScheduler::submit(std::vector<float> input) {
+    Request request;
+    request.input = std::move(input);
+    request.promise.emplace();
+    std::future<std::vector<float>> result = request.promise->get_future();
+    enqueue(std::move(request));
+    return result;
+}
+
+void BatchScheduler::submit(std::vector<float> input, Completion done) {
+    if (!done) {
+        throw std::invalid_argument("BatchScheduler::submit requires a completion");
+    }
+    Request request;
+    request.input = std::move(input);
+    request.done = std::move(done);
+    enqueue(std::move(request));
+}
+
+void BatchScheduler::enqueue(Request request) {
+    if (request.input.size() != model_->input_size()) {
+        throw std::invalid_argument("Input size mismatch");
+    }
+
+    size_t depth = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) {
+            throw std::runtime_error("BatchScheduler is shutting down");
+        }
+        request.enqueued = Clock::now();
+        queue_.push_back(std::move(request));
+        depth = queue_.size();
+        ++stats_.requests;
+        stats_.queue_depth.record(depth);
+    }
+
+    // The dispatcher only cares about the first arrival (starts the window)
+    // and the one that fills a batch
+    if (depth == 1 || depth >= options_.max_batch_size) {
+        ready_.notify_one();
+    }
+}
+
+BatchScheduler::Stats BatchScheduler::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void BatchScheduler::reset_stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_ = Stats();
+}
+
+void BatchScheduler::dispatch_loop() {
+    std::vector<Request> batch;
+    batch.reserve(options_.max_batch_size);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        ready_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;  // Stopped and drained
+        }
+
+        // Window opens with the oldest queued request
+        const Clock::time_point deadline = queue_.front().enqueued + options_.max_latency;
+        ready_.wait_until(lock, deadline, [this] {
+            return stop_ || queue_.size() >= options_.max_batch_size;
+        });
+
+        const size_t count = std::min(queue_.size(), options_.max_batch_size);
+        const Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            Request& request = queue_.front();
+            const auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+                start - request.enqueued);
+            stats_.queue_wait_us.record(static_cast<uint64_t>(std::max<int64_t>(0, waited.count())));
+            batch.push_back(std::move(request));
+            queue_.pop_front();
+        }
+        ++stats_.batches;
+        stats_.batch_size.record(count);
+
+        lock.unlock();
+        run_batch(batch);
+        batch.clear();
+        lock.lock();
+    }
+}
+
+void BatchScheduler::run_batch(std::vector<Request>& batch) {
+    const size_t in = model_->input_size();
+    const size_t out = model_->output_size();
+
+    for (size_t r = 0; r < batch.size(); ++r) {
+        std::copy(batch[r].input.begin(), batch[r].input.end(), input_buffer_.begin() + r * in);
+    }
+
+    try {
+        if (options_.pool != nullptr) {
+            parallel_forward_batch(*model_, input_buffer_.data(), batch.size(), output_buffer_.data(),
+                                   *options_.pool);
+        } else {
+            model_->forward_batch(input_buffer_.data(), batch.size(), output_buffer_.data(), context_);
+        }
+    } catch (...) {
+        const std::exception_ptr error = std::current_exception();
+        for (Request& request : batch) {
+            if (request.promise) {
+                request.promise->set_exception(error);
+            } else {
+                request.done(std::vector<float>(), error);
+            }
+        }
+        return;
+    }
+
+    for (size_t r = 0; r < batch.size(); ++r) {
+        const float* row = output_buffer_.data() + r * out;
+        if (batch[r].promise) {
+            batch[r].promise->set_value(std::vector<float>(row, row + out));
+        } else {
+            batch[r].done(std::vector<float>(row, row + out), nullptr);
+        }
+    }
+}
+
+} // namespace ZeticML
@@ -0,0 +1,162 @@
+/**
+ * ZeticML Assignment - Micro-Batching Request Scheduler
+ * Coalesces concurrent single-sample requests into batched inference
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include "histogram.h"
+#include "thread_pool.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// co_await support needs C++20 coroutines (ZETIC_CXX20=ON in CMake); the
+// callback and future APIs are always available
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#include <coroutine>
+#define ZETIC_HAS_COROUTINES 1
+#else
+#define ZETIC_HAS_COROUTINES 0
+#endif
+
+namespace ZeticML {
+
+/**
+ * Front end for online serving
+ * submit() queues one sample and returns a future for its output. A
+ * dispatcher thread collects queued samples until either max_batch_size of
+ * them are waiting or the oldest has waited max_latency, then runs them
+ * through the model's batched path and completes their futures. A failed
+ * batch fails every future in it with the same exception.
+ *
+ * Event-loop callers should use the asynchronous forms, which never block
+ * and need no thread hop to wait: submit(input, done) runs the completion
+ * on the dispatcher thread as soon as the batch finishes, and in C++20
+ * builds `co_await scheduler.async_forward(input)` resumes the coroutine
+ * there. Completions should stay short (post back to the loop for real
+ * work) and must not throw. With Options::pool set, each batch is split
+ * across that thread pool.
+ *
+ * The destructor stops accepting work, runs everything still queued and
+ * joins the dispatcher.
+ */
+class BatchScheduler {
+public:
+    struct Options {
+        size_t max_batch_size = 32;
+        std::chrono::microseconds max_latency{500};
+        ThreadPool* pool = nullptr;     // Run batches with parallel_forward_batch
+    };
+
+    // Completion of an asynchronous request: its output, or the exception
+    // that failed its batch (the output is empty then)
+    using Completion = std::function<void(std::vector<float> output, std::exception_ptr error)>;
+
+    struct Stats {
+        uint64_t requests = 0;
+        uint64_t batches = 0;
+        Histogram queue_depth;      // Queue length right after each submit
+        Histogram batch_size;       // Samples per dispatched batch
+        Histogram queue_wait_us;    // Submit to batch start, per request
+    };
+
+    explicit BatchScheduler(std::shared_ptr<const NeuralNetwork> model);
+    BatchScheduler(std::shared_ptr<const NeuralNetwork> model, const Options& options);
+    ~BatchScheduler();
+
+    BatchScheduler(const BatchScheduler&) = delete;
+    BatchScheduler& operator=(const BatchScheduler&) = delete;
+
+    // Throws std::invalid_argument on a wrong input size and
+    // std::runtime_error once the scheduler is shutting down
+    std::future<std::vector<float>> submit(std::vector<float> input);
+
+    // Same, reporting the result through done (called exactly once, on the
+    // dispatcher thread) instead of a future
+    void submit(std::vector<float> input, Completion done);
+
+#if ZETIC_HAS_COROUTINES
+    // `co_await` target of async_forward(); resumes on the dispatcher thread
+    class ForwardAwaitable {
+    public:
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            // The coroutine may resume (and destroy *this) before submit returns
+            scheduler_->submit(std::move(input_), [this, handle](std::vector<float> output, std::exception_ptr error) {
+                output_ = std::move(output);
+                error_ = error;
+                handle.resume();
+            });
+        }
+        std::vector<float> await_resume() {
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+            return std::move(output_);
+        }
+
+    private:
+        friend class BatchScheduler;
+        ForwardAwaitable(BatchScheduler* scheduler, std::vector<float> input)
+            : scheduler_(scheduler), input_(std::move(input)) {}
+
+        BatchScheduler* scheduler_;
+        std::vector<float> input_;
+        std::vector<float> output_;
+        std::exception_ptr error_;
+    };
+
+    // Awaitable submit: `auto output = co_await scheduler.async_forward(x);`
+    // Errors (including submit's) are rethrown from the co_await
+    ForwardAwaitable async_forward(std::vector<float> input) { return ForwardAwaitable(this, std::move(input)); }
+#endif
+
+    // Snapshot of the counters and histograms since construction / reset
+    Stats stats() const;
+    void reset_stats();
+
+    const Options& options() const { return options_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Completed through exactly one of promise / done
+    struct Request {
+        std::vector<float> input;
+        std::optional<std::promise<std::vector<float>>> promise;
+        Completion done;
+        Clock::time_point enqueued;
+    };
+
+    void enqueue(Request request);
+    void dispatch_loop();
+    void run_batch(std::vector<Request>& batch);
+
+    std::shared_ptr<const NeuralNetwork> model_;
+    Options options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<Request> queue_;
+    bool stop_ = false;
+    Stats stats_;
+
+    // Dispatcher-only state, reused across batches
+    InferenceContext context_;
+    std::vector<float> input_buffer_;
+    std::vector<float> output_buffer_;
+
+    std::thread dispatcher_;
+};
+
+} // namespace ZeticML
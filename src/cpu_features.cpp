@@ -0,0 +1,156 @@
+/**
+ * ZeticML Assignment - CPU Feature Detection
+ */
+
+#include "cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define ZETIC_ARCH_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ZETIC_ARCH_ARM64 1
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/auxv.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#endif
+
+namespace ZeticML {
+
+namespace {
+
+#if defined(ZETIC_ARCH_X86)
+
+void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned>(out[i]);
+    }
+#else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+}
+
+unsigned long long xgetbv0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax = 0, edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+CpuFeatures detect() {
+    CpuFeatures f;
+    unsigned regs[4];
+
+    cpuid(0, 0, regs);
+    const unsigned max_leaf = regs[0];
+    if (max_leaf < 1) {
+        return f;
+    }
+
+    cpuid(1, 0, regs);
+    const unsigned ecx1 = regs[2];
+    f.sse42 = (ecx1 >> 20) & 1;
+
+    // AVX state must be enabled by the OS (XCR0 bits 1-2), AVX-512 state
+    // additionally needs the opmask and upper ZMM bits (5-7)
+    const bool osxsave = (ecx1 >> 27) & 1;
+    const unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+    const bool os_avx = (xcr0 & 0x6) == 0x6;
+    const bool os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+    f.avx = os_avx && ((ecx1 >> 28) & 1);
+    f.fma = f.avx && ((ecx1 >> 12) & 1);
+    f.f16c = f.avx && ((ecx1 >> 29) & 1);
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, regs);
+        const unsigned ebx7 = regs[1];
+        const unsigned ecx7 = regs[2];
+        f.avx2 = f.avx && ((ebx7 >> 5) & 1);
+        f.avx512f = os_avx512 && ((ebx7 >> 16) & 1);
+        f.avx512bw = f.avx512f && ((ebx7 >> 30) & 1);
+        f.avx512vnni = f.avx512f && ((ecx7 >> 11) & 1);
+
+        cpuid(7, 1, regs);
+        f.avxvnni = f.avx2 && ((regs[0] >> 4) & 1);
+    }
+    return f;
+}
+
+#elif defined(ZETIC_ARCH_ARM64)
+
+CpuFeatures detect() {
+    CpuFeatures f;
+#if (defined(__linux__) || defined(__ANDROID__)) && defined(AT_HWCAP)
+    // HWCAP_ASIMD (bit 1); Advanced SIMD is architecturally mandatory on
+    // AArch64 but the kernel still reports it
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    f.neon = (hwcap & (1UL << 1)) != 0;
+    f.dotprod = (hwcap & (1UL << 20)) != 0;   // HWCAP_ASIMDDP
+#elif defined(__APPLE__)
+    f.neon = true;
+    int value = 0;
+    size_t size = sizeof(value);
+    f.dotprod = sysctlbyname("hw.optional.arm.FEAT_DotProd", &value, &size, nullptr, 0) == 0 &&
+                value != 0;
+#else
+    f.neon = true;
+#if defined(__ARM_FEATURE_DOTPROD)
+    f.dotprod = true;
+#endif
+#endif
+    return f;
+}
+
+#else
+
+CpuFeatures detect() {
+    return CpuFeatures();
+}
+
+#endif
+
+} // namespace
+
+std::string CpuFeatures::to_string() const {
+    std::string result;
+    auto add = [&result](bool present, const char* name) {
+        if (present) {
+            if (!result.empty()) {
+                result += ' ';
+            }
+            result += name;
+        }
+    };
+    add(sse42, "sse4.2");
+    add(avx, "avx");
+    add(avx2, "avx2");
+    add(fma, "fma");
+    add(f16c, "f16c");
+    add(avx512f, "avx512f");
+    add(avx512bw, "avx512bw");
+    add(avx512vnni, "avx512vnni");
+    add(avxvnni, "avxvnni");
+    add(neon, "neon");
+    add(dotprod, "dotprod");
+    return result.empty() ? "none" : result;
+}
+
+const CpuFeatures& cpu_features() {
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+} // namespace ZeticML
@@ -0,0 +1,40 @@
+/**
+ * ZeticML Assignment - CPU Feature Detection
+ * Queries the running CPU (CPUID on x86, HWCAP on ARM) once per process
+ */
+
+#pragma once
+
+#include <string>
+
+namespace ZeticML {
+
+/**
+ * Instruction set extensions usable by the current process
+ * A flag is only set when both the CPU and the OS (saved register state)
+ * support the extension.
+ */
+struct CpuFeatures {
+    // x86
+    bool sse42 = false;
+    bool avx = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool f16c = false;          // fp16 <-> fp32 conversions (vcvtph2ps)
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vnni = false;    // EVEX int8 dot products (vpdpbusd zmm)
+    bool avxvnni = false;       // VEX int8 dot products (vpdpbusd ymm)
+
+    // ARM
+    bool neon = false;
+    bool dotprod = false;       // SDOT / UDOT (Armv8.2 DotProd)
+
+    // Human-readable list of the detected extensions
+    std::string to_string() const;
+};
+
+// Features of the CPU this process runs on (detected on first call)
+const CpuFeatures& cpu_features();
+
+} // namespace ZeticML
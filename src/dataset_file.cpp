@@ -0,0 +1,411 @@
+/**
+ * ZeticML Assignment - Binary Dataset Files Implementation
+ */
+
+#include "dataset_file.h"
+#include "parallel_inference.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace ZeticML {
+
+namespace {
+
+size_t align_up(size_t offset) {
+    return (offset + kZdsAlignment - 1) / kZdsAlignment * kZdsAlignment;
+}
+
+constexpr size_t kColumnCapacity = 3;
+
+// Copy chunk for appending spooled columns
+constexpr size_t kCopyBytes = size_t(1) << 20;
+
+void pad_to(std::ofstream& out, size_t offset) {
+    static const char kZeros[kZdsAlignment] = {};
+    size_t position = static_cast<size_t>(out.tellp());
+    while (position < offset) {
+        const size_t pad = std::min(offset - position, sizeof(kZeros));
+        out.write(kZeros, static_cast<std::streamsize>(pad));
+        position += pad;
+    }
+}
+
+void write_floats(std::ofstream& out, const float* values, size_t count) {
+    out.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(count * sizeof(float)));
+}
+
+const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        ++p;
+    }
+    return p;
+}
+
+// Finds the next data line at or after p, moving p past it; line_number
+// counts every line consumed. False once the text is exhausted
+bool next_data_line(const char*& p, const char* end, const char*& line, const char*& line_end,
+                    size_t& line_number) {
+    while (p < end) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        line_end = newline != nullptr ? newline : end;
+        line = skip_blanks(p, line_end);
+        p = newline != nullptr ? newline + 1 : end;
+        ++line_number;
+        if (line != line_end && *line != '#') {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Calls fn(begin, end, line_number) for every data line of a mapped text file
+template <class Fn>
+void for_each_data_line(const MappedFile& file, Fn&& fn) {
+    const char* p = reinterpret_cast<const char*>(file.data());
+    const char* const end = p + file.size();
+    const char* line = nullptr;
+    const char* line_end = nullptr;
+    size_t line_number = 0;
+    while (next_data_line(p, end, line, line_end, line_number)) {
+        fn(line, line_end, line_number);
+    }
+}
+
+// Decided by the first data line alone, so only the file's head is read
+bool is_pipe_format(const MappedFile& file) {
+    const char* p = reinterpret_cast<const char*>(file.data());
+    const char* line = nullptr;
+    const char* line_end = nullptr;
+    size_t line_number = 0;
+    return next_data_line(p, p + file.size(), line, line_end, line_number) &&
+           std::memchr(line, '|', static_cast<size_t>(line_end - line)) != nullptr;
+}
+
+// `in | params | out` lines, read in one streaming pass
+size_t convert_pipe_dataset(const MappedFile& text, const std::string& text_path,
+                            const std::string& dataset_path) {
+    std::unique_ptr<DatasetWriter> writer;
+    std::vector<float> fields[3];
+    std::vector<float> unused;
+    size_t widths[3] = {};
+
+    for_each_data_line(text, [&](const char* begin, const char* end, size_t line_number) {
+        auto fail = [&](const std::string& error) {
+            throw std::runtime_error(error + " at line " + std::to_string(line_number) + " of " + text_path);
+        };
+        const char* cursor = begin;
+        for (size_t f = 0; f < 3; ++f) {
+            const char* bar = f < 2 ? static_cast<const char*>(
+                                          std::memchr(cursor, '|', static_cast<size_t>(end - cursor)))
+                                    : end;
+            if (bar == nullptr) {
+                fail("Expected three '|'-separated fields");
+            }
+            fields[f].clear();
+            bool has_outputs = false;
+            if (const char* error = parse_dataset_line(cursor, bar, fields[f], unused, has_outputs)) {
+                fail(error);
+            }
+            if (has_outputs) {
+                fail("Unexpected '->' in a '|'-separated dataset");
+            }
+            cursor = f < 2 ? bar + 1 : end;
+        }
+        if (writer == nullptr) {
+            for (size_t f = 0; f < 3; ++f) {
+                widths[f] = fields[f].size();
+            }
+            if (widths[0] == 0) {
+                fail("No input values");
+            }
+            writer = std::make_unique<DatasetWriter>(dataset_path, widths[0], widths[2], widths[1]);
+        }
+        for (size_t f = 0; f < 3; ++f) {
+            if (fields[f].size() != widths[f]) {
+                fail("Row width differs from the first row");
+            }
+        }
+        writer->append(fields[0].data(), fields[2].data(), fields[1].data(), 1);
+    });
+
+    if (writer == nullptr) {
+        throw std::runtime_error("No data lines in " + text_path);
+    }
+    return writer->finish();
+}
+
+} // namespace
+
+// ---------------- DatasetFile ----------------
+
+DatasetFile::DatasetFile(const std::string& path) : file_(std::make_shared<MappedFile>(path)) {
+    const unsigned char* data = file_->data();
+    const size_t size = file_->size();
+    if (size < sizeof(ZdsHeader) || std::memcmp(data, kZdsMagic, sizeof(kZdsMagic)) != 0) {
+        throw std::runtime_error("Not a .zds dataset: " + path);
+    }
+
+    ZdsHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version_major != kZdsVersionMajor) {
+        throw std::runtime_error("Unsupported .zds version " + std::to_string(header.version_major) + ": " + path);
+    }
+    const uint64_t table_bytes = static_cast<uint64_t>(header.column_count) * sizeof(ZdsColumn);
+    if (header.column_table_offset > size || table_bytes > size - header.column_table_offset) {
+        throw std::runtime_error("Truncated .zds column table: " + path);
+    }
+    rows_ = static_cast<size_t>(header.row_count);
+
+    for (uint32_t c = 0; c < header.column_count; ++c) {
+        ZdsColumn column;
+        std::memcpy(&column, data + header.column_table_offset + c * sizeof(ZdsColumn), sizeof(column));
+
+        size_t* width = nullptr;
+        const float** values = nullptr;
+        switch (static_cast<ZdsColumnKind>(column.kind)) {
+            case ZdsColumnKind::Input: width = &input_size_; values = &inputs_; break;
+            case ZdsColumnKind::Expected: width = &output_size_; values = &expected_; break;
+            case ZdsColumnKind::Parameters: width = &parameter_size_; values = &parameters_; break;
+            default: continue;      // Unknown column kinds are skipped
+        }
+        if (column.dtype != static_cast<uint32_t>(ZdsDType::Float32)) {
+            throw std::runtime_error("Unsupported .zds column dtype: " + path);
+        }
+        if (column.offset % kZdsAlignment != 0) {
+            throw std::runtime_error("Misaligned .zds column: " + path);
+        }
+        if (column.offset > size || column.size_bytes > size - column.offset) {
+            throw std::runtime_error("Truncated .zds column: " + path);
+        }
+        // Bound row_count * width by the file first so the product cannot wrap
+        const uint64_t available = (size - column.offset) / sizeof(float);
+        if (column.width != 0 && header.row_count > available / column.width) {
+            throw std::runtime_error("Truncated .zds column: " + path);
+        }
+        if (column.size_bytes != header.row_count * column.width * sizeof(float)) {
+            throw std::runtime_error("Inconsistent .zds column size: " + path);
+        }
+        *width = static_cast<size_t>(column.width);
+        *values = reinterpret_cast<const float*>(data + column.offset);
+    }
+    if (inputs_ == nullptr || input_size_ == 0) {
+        throw std::runtime_error("Missing .zds input column: " + path);
+    }
+}
+
+DatasetBatch DatasetFile::batch(size_t first, size_t count) const {
+    DatasetBatch batch;
+    first = std::min(first, rows_);
+    batch.rows = std::min(count, rows_ - first);
+    batch.input_size = input_size_;
+    batch.output_size = output_size_;
+    batch.first_line = first + 1;
+    batch.inputs = inputs_ + first * input_size_;
+    batch.expected = expected_ != nullptr ? expected_ + first * output_size_ : nullptr;
+    return batch;
+}
+
+// ---------------- DatasetWriter ----------------
+
+size_t DatasetWriter::table_end() {
+    return sizeof(ZdsHeader) + kColumnCapacity * sizeof(ZdsColumn);
+}
+
+DatasetWriter::DatasetWriter(const std::string& path, size_t input_size, size_t output_size,
+                             size_t parameter_size)
+    : path_(path), input_size_(input_size) {
+    if (input_size == 0) {
+        throw std::invalid_argument("Dataset needs at least one input value per row");
+    }
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    // Room for the header and a full column table; the inputs follow
+    pad_to(out_, align_up(table_end()));
+
+    auto open_spool = [&](Spool& spool, const char* name, size_t width) {
+        spool.width = width;
+        if (width > 0) {
+            spool.path = path + "." + name + ".tmp";
+            spool.stream.open(spool.path, std::ios::binary | std::ios::trunc);
+            if (!spool.stream) {
+                close_and_remove();
+                throw std::runtime_error("Cannot open file for writing: " + spool.path);
+            }
+        }
+    };
+    open_spool(expected_, "expected", output_size);
+    open_spool(parameters_, "parameters", parameter_size);
+}
+
+DatasetWriter::~DatasetWriter() {
+    if (!finished_) {
+        close_and_remove();
+    }
+}
+
+void DatasetWriter::close_and_remove() {
+    for (Spool* spool : {&expected_, &parameters_}) {
+        if (spool->stream.is_open()) {
+            spool->stream.close();
+        }
+        if (!spool->path.empty()) {
+            std::remove(spool->path.c_str());
+        }
+    }
+    if (out_.is_open()) {
+        out_.close();
+        if (!finished_) {
+            std::remove(path_.c_str());
+        }
+    }
+}
+
+void DatasetWriter::append(const float* inputs, const float* expected, const float* parameters, size_t rows) {
+    if (finished_) {
+        throw std::runtime_error("Dataset already finished: " + path_);
+    }
+    if (rows == 0) {
+        return;
+    }
+    if (inputs == nullptr || (expected_.width > 0 && expected == nullptr) ||
+        (parameters_.width > 0 && parameters == nullptr)) {
+        throw std::invalid_argument("Null dataset column");
+    }
+    write_floats(out_, inputs, rows * input_size_);
+    if (expected_.width > 0) {
+        write_floats(expected_.stream, expected, rows * expected_.width);
+    }
+    if (parameters_.width > 0) {
+        write_floats(parameters_.stream, parameters, rows * parameters_.width);
+    }
+    if (!out_ || !expected_.stream.good() || !parameters_.stream.good()) {
+        throw std::runtime_error("Failed to write dataset: " + path_);
+    }
+    rows_ += rows;
+}
+
+size_t DatasetWriter::finish() {
+    if (finished_) {
+        return rows_;
+    }
+    ZdsColumn columns[kColumnCapacity] = {};
+    uint32_t count = 0;
+    columns[count].kind = static_cast<uint32_t>(ZdsColumnKind::Input);
+    columns[count].dtype = static_cast<uint32_t>(ZdsDType::Float32);
+    columns[count].width = input_size_;
+    columns[count].offset = align_up(table_end());
+    columns[count].size_bytes = rows_ * input_size_ * sizeof(float);
+    size_t end = static_cast<size_t>(columns[count].offset + columns[count].size_bytes);
+    ++count;
+
+    // Append the spooled columns behind the inputs
+    std::vector<char> buffer(kCopyBytes);
+    for (auto [spool, kind] : {std::make_pair(&expected_, ZdsColumnKind::Expected),
+                               std::make_pair(&parameters_, ZdsColumnKind::Parameters)}) {
+        if (spool->width == 0) {
+            continue;
+        }
+        spool->stream.close();
+        std::ifstream in(spool->path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot reopen dataset spool: " + spool->path);
+        }
+        ZdsColumn& column = columns[count++];
+        column.kind = static_cast<uint32_t>(kind);
+        column.dtype = static_cast<uint32_t>(ZdsDType::Float32);
+        column.width = spool->width;
+        column.offset = align_up(end);
+        column.size_bytes = rows_ * spool->width * sizeof(float);
+        pad_to(out_, column.offset);
+        while (in) {
+            in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            out_.write(buffer.data(), in.gcount());
+        }
+        end = static_cast<size_t>(column.offset + column.size_bytes);
+    }
+
+    ZdsHeader header = {};
+    std::memcpy(header.magic, kZdsMagic, sizeof(kZdsMagic));
+    header.version_major = kZdsVersionMajor;
+    header.version_minor = kZdsVersionMinor;
+    header.row_count = rows_;
+    header.column_count = count;
+    header.column_table_offset = sizeof(ZdsHeader);
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_.write(reinterpret_cast<const char*>(columns), static_cast<std::streamsize>(count * sizeof(ZdsColumn)));
+    out_.close();
+    if (!out_) {
+        throw std::runtime_error("Failed to write dataset: " + path_);
+    }
+    finished_ = true;
+    close_and_remove();
+    return rows_;
+}
+
+// ---------------- Helpers ----------------
+
+void save_dataset_file(const std::string& path, size_t rows,
+                       const float* inputs, size_t input_size,
+                       const float* expected, size_t output_size,
+                       const float* parameters, size_t parameter_size) {
+    DatasetWriter writer(path, input_size, output_size, parameter_size);
+    writer.append(inputs, expected, parameters, rows);
+    writer.finish();
+}
+
+size_t convert_text_dataset(const std::string& text_path, const std::string& dataset_path,
+                            ThreadPool* pool) {
+    {
+        MappedFile text(text_path);
+        if (is_pipe_format(text)) {
+            return convert_pipe_dataset(text, text_path, dataset_path);
+        }
+    }
+
+    DatasetReader::Options options;
+    options.batch_rows = 4096;
+    options.pool = pool;
+    DatasetReader reader(text_path, options);
+    if (reader.input_size() == 0) {
+        throw std::runtime_error("No data lines in " + text_path);
+    }
+    DatasetWriter writer(dataset_path, reader.input_size(), reader.output_size());
+    DatasetBatch batch;
+    while (reader.next(batch)) {
+        writer.append(batch.inputs, batch.expected, nullptr, batch.rows);
+    }
+    return writer.finish();
+}
+
+size_t run_dataset(const NeuralNetwork& model, const DatasetFile& dataset, const DatasetBatchFunction& fn,
+                   size_t batch_rows, ThreadPool* pool) {
+    if (dataset.input_size() != model.input_size()) {
+        throw std::invalid_argument("Dataset input width does not match the model");
+    }
+    if (batch_rows == 0) {
+        throw std::invalid_argument("Dataset batch size must be positive");
+    }
+    std::vector<float> outputs;
+    InferenceContext context;
+    for (size_t first = 0; first < dataset.rows(); first += batch_rows) {
+        const DatasetBatch batch = dataset.batch(first, batch_rows);
+        outputs.resize(batch.rows * model.output_size());
+        if (pool != nullptr) {
+            parallel_forward_batch(model, batch.inputs, batch.rows, outputs.data(), *pool);
+        } else {
+            model.forward_batch(batch.inputs, batch.rows, outputs.data(), context);
+        }
+        if (fn) {
+            fn(batch, outputs.data());
+        }
+    }
+    return dataset.rows();
+}
+
+} // namespace ZeticML
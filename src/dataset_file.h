@@ -0,0 +1,129 @@
+/**
+ * ZeticML Assignment - Binary Dataset Files
+ * Zero-copy .zds reader, streaming writer and text converter
+ */
+
+#pragma once
+
+#include "dataset_format.h"
+#include "dataset_reader.h"
+#include "model_loader.h"
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace ZeticML {
+
+/**
+ * Memory-mapped .zds dataset
+ * Columns are used in place: inputs() is the whole rows x input_size block,
+ * batch() returns DatasetBatch views into the mapping. Absent columns have
+ * width 0 and a null pointer. Throws std::runtime_error on I/O errors or
+ * malformed files.
+ */
+class DatasetFile {
+public:
+    explicit DatasetFile(const std::string& path);
+
+    size_t rows() const { return rows_; }
+    size_t input_size() const { return input_size_; }
+    size_t output_size() const { return output_size_; }
+    size_t parameter_size() const { return parameter_size_; }
+
+    const float* inputs() const { return inputs_; }
+    const float* expected() const { return expected_; }
+    const float* parameters() const { return parameters_; }
+
+    Span<const float> input(size_t row) const {
+        return Span<const float>(inputs_ + row * input_size_, input_size_);
+    }
+    Span<const float> expected_output(size_t row) const {
+        return Span<const float>(expected_ + row * output_size_, output_size_);
+    }
+    Span<const float> row_parameters(size_t row) const {
+        return Span<const float>(parameters_ + row * parameter_size_, parameter_size_);
+    }
+
+    // Rows [first, first + count) clamped to the dataset, without copying
+    DatasetBatch batch(size_t first, size_t count) const;
+
+private:
+    std::shared_ptr<MappedFile> file_;
+    size_t rows_ = 0;
+    size_t input_size_ = 0;
+    size_t output_size_ = 0;
+    size_t parameter_size_ = 0;
+    const float* inputs_ = nullptr;
+    const float* expected_ = nullptr;
+    const float* parameters_ = nullptr;
+};
+
+/**
+ * Streaming .zds writer
+ * Rows are appended in any number of chunks. The input column goes straight
+ * to its final place in the file; the other columns are spooled to
+ * `<path>.<column>.tmp` files and appended by finish(), so memory use does
+ * not grow with the dataset. Widths of 0 leave a column out. The file is
+ * incomplete until finish() returns; a writer destroyed before that removes
+ * it. Throws std::runtime_error on I/O errors.
+ */
+class DatasetWriter {
+public:
+    DatasetWriter(const std::string& path, size_t input_size, size_t output_size,
+                  size_t parameter_size = 0);
+    ~DatasetWriter();
+
+    DatasetWriter(const DatasetWriter&) = delete;
+    DatasetWriter& operator=(const DatasetWriter&) = delete;
+
+    // rows x width values per present column; absent columns may be null
+    void append(const float* inputs, const float* expected, const float* parameters, size_t rows);
+
+    // Write the header and column table; returns the number of rows
+    size_t finish();
+
+private:
+    struct Spool {
+        std::string path;
+        std::ofstream stream;
+        size_t width = 0;
+    };
+
+    static size_t table_end();
+    void close_and_remove();
+
+    std::string path_;
+    std::ofstream out_;
+    size_t input_size_;
+    Spool expected_;
+    Spool parameters_;
+    size_t rows_ = 0;
+    bool finished_ = false;
+};
+
+// Write an in-memory dataset (rows x width blocks; widths of 0 are left out)
+void save_dataset_file(const std::string& path, size_t rows,
+                       const float* inputs, size_t input_size,
+                       const float* expected, size_t output_size,
+                       const float* parameters = nullptr, size_t parameter_size = 0);
+
+/**
+ * Convert a text dataset to .zds and return the number of rows
+ * Both text formats are recognized from the first data line:
+ *   in1,in2,... [-> out1,...]                (TestDataLoader / DatasetReader)
+ *   in1,... | param1,... | out1,...          (the tests/data demo files)
+ * The text is streamed, so files larger than memory convert fine. Throws
+ * std::runtime_error on I/O errors or malformed lines.
+ */
+size_t convert_text_dataset(const std::string& text_path, const std::string& dataset_path,
+                            ThreadPool* pool = nullptr);
+
+/**
+ * run_dataset() over a mapped .zds file: batches are views into the
+ * mapping, so the model reads its inputs straight from the page cache
+ */
+size_t run_dataset(const NeuralNetwork& model, const DatasetFile& dataset, const DatasetBatchFunction& fn,
+                   size_t batch_rows = 1024, ThreadPool* pool = nullptr);
+
+} // namespace ZeticML
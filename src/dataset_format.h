@@ -0,0 +1,67 @@
+/**
+ * ZeticML Assignment - .zds Dataset Format
+ * On-disk layout of binary columnar evaluation datasets
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ZeticML {
+
+/**
+ * .zds file layout (all integers little-endian):
+ *
+ *   [ZdsHeader              64 bytes]
+ *   [ZdsColumn x count      32 bytes each, at column_table_offset]
+ *   [column payloads, each starting on a 64-byte boundary]
+ *
+ * Every column is one row-major float32 block of row_count x width values,
+ * so a mapped file hands all inputs (or all expected outputs) of a dataset
+ * to forward_batch() as a single pointer, with no parsing or copying.
+ * Columns are identified by kind; readers skip kinds they do not know.
+ */
+
+constexpr char kZdsMagic[4] = {'Z', 'T', 'D', 'S'};
+constexpr uint16_t kZdsVersionMajor = 1;
+constexpr uint16_t kZdsVersionMinor = 0;
+constexpr size_t kZdsAlignment = 64;
+
+enum class ZdsColumnKind : uint32_t {
+    Input = 1,
+    Expected = 2,
+    Parameters = 3      // Per-row model parameters (the `|` demo files)
+};
+
+enum class ZdsDType : uint32_t {
+    Float32 = 1
+};
+
+#pragma pack(push, 1)
+
+struct ZdsHeader {
+    char magic[4];                  // kZdsMagic
+    uint16_t version_major;
+    uint16_t version_minor;
+    uint64_t row_count;
+    uint32_t column_count;
+    uint32_t reserved0;
+    uint64_t column_table_offset;
+    uint8_t reserved[32];
+};
+
+struct ZdsColumn {
+    uint32_t kind;                  // ZdsColumnKind
+    uint32_t dtype;                 // ZdsDType
+    uint64_t width;                 // Values per row
+    uint64_t offset;                // From start of file, kZdsAlignment aligned
+    uint64_t size_bytes;            // row_count * width * sizeof(float)
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(ZdsHeader) == 64, "ZdsHeader must be 64 bytes");
+static_assert(sizeof(ZdsColumn) == 32, "ZdsColumn must be 32 bytes");
+
+} // namespace ZeticML
@@ -0,0 +1,332 @@
+/**
+ * ZeticML Assignment - Streaming Dataset Reader Implementation
+ */
+
+#include "dataset_reader.h"
+#include "parallel_inference.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+// Rows per parallel parse task, and the smallest batch worth splitting
+constexpr size_t kParseGrain = 64;
+
+// Consumed bytes are released in multiples of this (a multiple of every
+// page size in use: 4 KB, 16 KB, 64 KB)
+constexpr size_t kReleaseGranule = size_t(4) << 20;
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+// Parse a float at p; from_chars where the library has it for floats
+inline const char* parse_float(const char* p, const char* end, float& value, const char*& error) {
+    if (*p == '+') {
+        ++p;
+    }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const std::from_chars_result r = std::from_chars(p, end, value);
+    if (r.ec == std::errc::result_out_of_range) {
+        error = "Value out of float range";
+        return nullptr;
+    }
+    if (r.ec != std::errc()) {
+        error = "Invalid number";
+        return nullptr;
+    }
+    return r.ptr;
+#else
+    // strtof needs a terminated string: copy the token (numbers are short)
+    char token[64];
+    size_t n = 0;
+    while (p + n < end && n < sizeof(token) - 1 && p[n] != ',' && !is_blank(p[n])) {
+        token[n] = p[n];
+        ++n;
+    }
+    token[n] = '\0';
+    char* stop = nullptr;
+    value = std::strtof(token, &stop);
+    if (stop == token) {
+        error = "Invalid number";
+        return nullptr;
+    }
+    return p + (stop - token);
+#endif
+}
+
+/**
+ * Parse a comma-separated list of floats in [p, end), calling put(value)
+ * for each; empty fields are skipped. put returns false to reject a value
+ * (row too wide). Returns nullptr on success or the error.
+ */
+template <class Put>
+const char* parse_list(const char* p, const char* end, Put&& put) {
+    const char* error = nullptr;
+    while (true) {
+        p = skip_blanks(p, end);
+        if (p == end) {
+            return nullptr;
+        }
+        if (*p != ',') {
+            float value;
+            p = parse_float(p, end, value, error);
+            if (p == nullptr) {
+                return error;
+            }
+            if (!put(value)) {
+                return "Row width differs from the first row";
+            }
+            p = skip_blanks(p, end);
+            if (p == end) {
+                return nullptr;
+            }
+            if (*p != ',') {
+                return "Expected ',' between values";
+            }
+        }
+        ++p;
+    }
+}
+
+// Position of "->" in [begin, end), or nullptr
+inline const char* find_arrow(const char* begin, const char* end) {
+    const char* p = begin;
+    while (p < end) {
+        p = static_cast<const char*>(std::memchr(p, '-', static_cast<size_t>(end - p)));
+        if (p == nullptr || p + 1 >= end) {
+            return nullptr;
+        }
+        if (p[1] == '>') {
+            return p;
+        }
+        ++p;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+const char* parse_dataset_line(const char* begin, const char* end,
+                               std::vector<float>& inputs, std::vector<float>& outputs,
+                               bool& has_outputs) {
+    const char* arrow = find_arrow(begin, end);
+    has_outputs = arrow != nullptr;
+    auto push_input = [&](float v) { inputs.push_back(v); return true; };
+    if (const char* error = parse_list(begin, has_outputs ? arrow : end, push_input)) {
+        return error;
+    }
+    if (has_outputs) {
+        auto push_output = [&](float v) { outputs.push_back(v); return true; };
+        return parse_list(arrow + 2, end, push_output);
+    }
+    return nullptr;
+}
+
+// ---------------- DatasetReader ----------------
+
+DatasetReader::DatasetReader(const std::string& path) : DatasetReader(path, Options()) {}
+
+DatasetReader::DatasetReader(const std::string& path, const Options& options)
+    : path_(path), options_(options) {
+    if (options_.batch_rows == 0) {
+        throw std::invalid_argument("Dataset batch size must be positive");
+    }
+    file_ = std::make_unique<MappedFile>(path);
+    file_->advise_sequential();
+    data_ = reinterpret_cast<const char*>(file_->data());
+    size_ = file_->size();
+
+    // The first data line fixes the row widths
+    Line line;
+    if (next_line(line)) {
+        std::vector<float> inputs, outputs;
+        if (const char* error = parse_dataset_line(line.begin, line.end, inputs, outputs, has_outputs_)) {
+            fail(line.number, error);
+        }
+        if (inputs.empty()) {
+            fail(line.number, "No input values");
+        }
+        input_size_ = inputs.size();
+        output_size_ = outputs.size();
+    }
+    offset_ = 0;
+    line_number_ = 0;
+}
+
+void DatasetReader::fail(size_t line_number, const char* error) const {
+    throw std::runtime_error(std::string(error) + " at line " + std::to_string(line_number) +
+                             " of " + path_);
+}
+
+bool DatasetReader::next_line(Line& line) {
+    while (offset_ < size_) {
+        const char* begin = data_ + offset_;
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', size_ - offset_));
+        const char* end = newline != nullptr ? newline : data_ + size_;
+        offset_ = static_cast<size_t>(end - data_) + (newline != nullptr ? 1 : 0);
+        ++line_number_;
+
+        const char* first = skip_blanks(begin, end);
+        if (first == end || *first == '#') {
+            continue;
+        }
+        line = Line{first, end, line_number_};
+        return true;
+    }
+    return false;
+}
+
+const char* DatasetReader::parse_row(const Line& line, float* inputs, float* expected) const {
+    const char* arrow = find_arrow(line.begin, line.end);
+    if ((arrow != nullptr) != has_outputs_) {
+        return has_outputs_ ? "Missing '->' separator" : "Unexpected '->' in a feature-only dataset";
+    }
+    size_t count = 0;
+    auto put_input = [&](float v) {
+        if (count == input_size_) {
+            return false;
+        }
+        inputs[count++] = v;
+        return true;
+    };
+    if (const char* error = parse_list(line.begin, arrow != nullptr ? arrow : line.end, put_input)) {
+        return error;
+    }
+    if (count != input_size_) {
+        return "Row width differs from the first row";
+    }
+    if (arrow != nullptr) {
+        count = 0;
+        auto put_output = [&](float v) {
+            if (count == output_size_) {
+                return false;
+            }
+            expected[count++] = v;
+            return true;
+        };
+        if (const char* error = parse_list(arrow + 2, line.end, put_output)) {
+            return error;
+        }
+        if (count != output_size_) {
+            return "Row width differs from the first row";
+        }
+    }
+    return nullptr;
+}
+
+void DatasetReader::parse_rows(size_t count) {
+    auto parse_range = [&](size_t begin, size_t end, size_t& failed) {
+        for (size_t r = begin; r < end; ++r) {
+            if (parse_row(lines_[r], inputs_.data() + r * input_size_,
+                          expected_.data() + r * output_size_) != nullptr) {
+                failed = r;
+                return;
+            }
+        }
+    };
+
+    size_t failed = count;
+    if (options_.pool != nullptr && options_.pool->size() > 1 && count >= 2 * kParseGrain) {
+        // Keep the earliest failing row so the error does not depend on scheduling
+        std::atomic<size_t> first_failed{count};
+        options_.pool->parallel_for(0, count, kParseGrain, [&](size_t begin, size_t end) {
+            size_t local = count;
+            parse_range(begin, end, local);
+            size_t seen = first_failed.load(std::memory_order_relaxed);
+            while (local < seen && !first_failed.compare_exchange_weak(seen, local)) {
+            }
+        });
+        failed = first_failed.load();
+    } else {
+        parse_range(0, count, failed);
+    }
+
+    if (failed < count) {
+        const Line& line = lines_[failed];
+        fail(line.number, parse_row(line, inputs_.data() + failed * input_size_,
+                                    expected_.data() + failed * output_size_));
+    }
+}
+
+bool DatasetReader::next(DatasetBatch& batch) {
+    lines_.clear();
+    Line line;
+    while (lines_.size() < options_.batch_rows && next_line(line)) {
+        lines_.push_back(line);
+    }
+    const size_t rows = lines_.size();
+    if (rows == 0) {
+        batch = DatasetBatch();
+        return false;
+    }
+
+    inputs_.resize(rows * input_size_);
+    expected_.resize(rows * output_size_);
+    parse_rows(rows);
+
+    if (options_.release_pages) {
+        // Everything before the read position has been copied into the batch
+        const size_t release_end = offset_ / kReleaseGranule * kReleaseGranule;
+        if (release_end > released_) {
+            file_->release(released_, release_end - released_);
+            released_ = release_end;
+        }
+    }
+
+    batch.rows = rows;
+    batch.input_size = input_size_;
+    batch.output_size = output_size_;
+    batch.first_line = lines_.front().number;
+    batch.inputs = inputs_.data();
+    batch.expected = expected_.data();
+    rows_read_ += rows;
+    return true;
+}
+
+void DatasetReader::rewind() {
+    offset_ = 0;
+    line_number_ = 0;
+    released_ = 0;
+    rows_read_ = 0;
+}
+
+// ---------------- Batched inference ----------------
+
+size_t run_dataset(const NeuralNetwork& model, DatasetReader& reader, const DatasetBatchFunction& fn) {
+    if (reader.input_size() != 0 && reader.input_size() != model.input_size()) {
+        throw std::invalid_argument("Dataset input width does not match the model");
+    }
+    std::vector<float> outputs;
+    InferenceContext context;
+    DatasetBatch batch;
+    size_t rows = 0;
+    while (reader.next(batch)) {
+        outputs.resize(batch.rows * model.output_size());
+        if (reader.pool() != nullptr) {
+            parallel_forward_batch(model, batch.inputs, batch.rows, outputs.data(), *reader.pool());
+        } else {
+            model.forward_batch(batch.inputs, batch.rows, outputs.data(), context);
+        }
+        if (fn) {
+            fn(batch, outputs.data());
+        }
+        rows += batch.rows;
+    }
+    return rows;
+}
+
+} // namespace ZeticML
@@ -0,0 +1,134 @@
+/**
+ * ZeticML Assignment - Streaming Dataset Reader
+ * Memory-mapped, chunked parsing of text datasets into contiguous batches
+ */
+
+#pragma once
+
+#include "model_loader.h"
+#include "neural_network_interface.h"
+#include "thread_pool.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * Parse one dataset line: `in1,in2,... [-> out1,out2,...]`
+ * Values are appended to `inputs` / `outputs` (outputs stay untouched when
+ * the line has no `->`). Spaces, tabs, a trailing '\r', empty fields and a
+ * leading '+' are accepted, like the old stringstream parser. Returns
+ * nullptr on success or a static description of the first error.
+ */
+const char* parse_dataset_line(const char* begin, const char* end,
+                               std::vector<float>& inputs, std::vector<float>& outputs,
+                               bool& has_outputs);
+
+/**
+ * One batch of rows, valid until the next DatasetReader::next() call
+ * inputs is rows x input_size and expected is rows x output_size, both
+ * row-major and contiguous, ready for forward_batch().
+ */
+struct DatasetBatch {
+    size_t rows = 0;
+    size_t input_size = 0;
+    size_t output_size = 0;         // 0 for feature-only files
+    size_t first_line = 0;          // 1-based text line (or .zds row) of the first row
+    const float* inputs = nullptr;
+    const float* expected = nullptr;
+
+    Span<const float> input(size_t row) const {
+        return Span<const float>(inputs + row * input_size, input_size);
+    }
+    Span<const float> expected_output(size_t row) const {
+        return Span<const float>(expected + row * output_size, output_size);
+    }
+};
+
+/**
+ * Streaming reader for `in... -> out...` text datasets (the TestDataLoader
+ * format; `#` comments and blank lines are skipped, `-> out...` is
+ * optional). The file is memory-mapped and walked once: next() finds the
+ * next batch_rows line boundaries with memchr and parses them with
+ * std::from_chars straight into the batch buffers, in parallel over the
+ * pool when one is given. Pages behind the read position are handed back
+ * to the OS, so resident memory stays at about one batch however large the
+ * file is.
+ *
+ * Every row must have the width of the first one. Malformed lines throw
+ * std::runtime_error naming the file and line; so do unreadable files.
+ */
+class DatasetReader {
+public:
+    struct Options {
+        size_t batch_rows = 1024;
+        ThreadPool* pool = nullptr;     // Parse rows in parallel when set
+        bool release_pages = true;      // Drop consumed pages from the mapping
+    };
+
+    explicit DatasetReader(const std::string& path);
+    DatasetReader(const std::string& path, const Options& options);
+
+    DatasetReader(const DatasetReader&) = delete;
+    DatasetReader& operator=(const DatasetReader&) = delete;
+
+    // Row widths, taken from the first data line (0 for an empty dataset)
+    size_t input_size() const { return input_size_; }
+    size_t output_size() const { return output_size_; }
+
+    // Fill the next batch; false once the file is exhausted
+    bool next(DatasetBatch& batch);
+
+    // Rows returned so far
+    size_t rows_read() const { return rows_read_; }
+
+    ThreadPool* pool() const { return options_.pool; }
+
+    // Start again from the first line
+    void rewind();
+
+private:
+    struct Line {
+        const char* begin;
+        const char* end;
+        size_t number;
+    };
+
+    bool next_line(Line& line);
+    const char* parse_row(const Line& line, float* inputs, float* expected) const;
+    void parse_rows(size_t count);
+    [[noreturn]] void fail(size_t line_number, const char* error) const;
+
+    std::string path_;
+    Options options_;
+    std::unique_ptr<MappedFile> file_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    size_t offset_ = 0;
+    size_t line_number_ = 0;
+    size_t released_ = 0;
+    size_t rows_read_ = 0;
+    size_t input_size_ = 0;
+    size_t output_size_ = 0;
+    bool has_outputs_ = false;
+
+    std::vector<Line> lines_;
+    std::vector<float> inputs_;
+    std::vector<float> expected_;
+};
+
+/**
+ * Run a model over a whole dataset, batch by batch, through forward_batch()
+ * (parallel_forward_batch() on the reader's pool when it has one). fn sees
+ * each batch with the model's outputs for it (rows x output_size). The
+ * output buffer and inference context are reused across batches. Returns
+ * the number of rows processed.
+ */
+using DatasetBatchFunction = std::function<void(const DatasetBatch&, const float* outputs)>;
+
+size_t run_dataset(const NeuralNetwork& model, DatasetReader& reader, const DatasetBatchFunction& fn);
+
+} // namespace ZeticML
@@ -0,0 +1,14 @@
+/**
+ * ZeticML Assignment - Fixed-Shape Models
+ * Instantiates the build-time default shape set
+ */
+
+#include "fixed_shape_models.h"
+
+namespace ZeticML {
+
+std::unique_ptr<NeuralNetwork> make_fixed_model(const NeuralNetwork& model) {
+    return make_fixed_model(model, DefaultFixedShapes{});
+}
+
+} // namespace ZeticML
@@ -0,0 +1,342 @@
+/**
+ * ZeticML Assignment - Fixed-Shape Models
+ * Compile-time sized variants of the four models for tiny, hot inference loops
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ZeticML {
+
+namespace fixed_detail {
+
+// f(integral_constant<size_t, 0>) ... f(integral_constant<size_t, N - 1>)
+template <class F, size_t... I>
+inline void unroll_impl(F&& f, std::index_sequence<I...>) {
+    (f(std::integral_constant<size_t, I>{}), ...);
+}
+
+template <size_t N, class F>
+inline void unroll(F&& f) {
+    unroll_impl(f, std::make_index_sequence<N>{});
+}
+
+template <size_t N>
+inline float dot(const float* w, const float* x) {
+    float sum = 0.0f;
+    unroll<N>([&](auto i) { sum += w[i] * x[i]; });
+    return sum;
+}
+
+inline float sigmoid(float x) {
+    return 1.0f / (1.0f + std::exp(-x));
+}
+
+template <size_t N>
+inline void softmax(float* x) {
+    float max_value = x[0];
+    unroll<N>([&](auto i) { max_value = x[i] > max_value ? x[i] : max_value; });
+    float sum = 0.0f;
+    unroll<N>([&](auto i) {
+        x[i] = std::exp(x[i] - max_value);
+        sum += x[i];
+    });
+    const float scale = 1.0f / sum;
+    unroll<N>([&](auto i) { x[i] *= scale; });
+}
+
+} // namespace fixed_detail
+
+/**
+ * Fixed-shape models
+ * Same math and public parameter order as the runtime models, but every
+ * size is a template argument: weights live in std::array members, every
+ * loop is unrolled at compile time and nothing is virtual. Meant for models
+ * with a few dozen parameters, where runtime sizes and dispatch cost more
+ * than the arithmetic. Construct from public-order parameters, or convert a
+ * loaded runtime model with to_fixed<Model>().
+ *
+ * Each model exposes kInputSize, kOutputSize, kParameterCount, type_name()
+ * and dimensions() matching its runtime counterpart.
+ */
+template <size_t In>
+class FixedLinearRegression {
+public:
+    static constexpr size_t kInputSize = In;
+    static constexpr size_t kOutputSize = 1;
+    static constexpr size_t kParameterCount = In + 1;
+
+    static std::string type_name() { return "linear"; }
+    static std::vector<size_t> dimensions() { return {In}; }
+    static std::string description() { return "Linear Regression <" + std::to_string(In) + ">"; }
+
+    FixedLinearRegression() = default;
+    explicit FixedLinearRegression(const float* parameters) {
+        fixed_detail::unroll<In>([&](auto i) { weights_[i] = parameters[i]; });
+        bias_ = parameters[In];
+    }
+
+    void forward(const float* input, float* output) const {
+        output[0] = bias_ + fixed_detail::dot<In>(weights_.data(), input);
+    }
+
+    float forward(const std::array<float, In>& input) const {
+        return bias_ + fixed_detail::dot<In>(weights_.data(), input.data());
+    }
+
+private:
+    std::array<float, In> weights_{};
+    float bias_ = 0.0f;
+};
+
+template <size_t In>
+class FixedLogisticRegression {
+public:
+    static constexpr size_t kInputSize = In;
+    static constexpr size_t kOutputSize = 1;
+    static constexpr size_t kParameterCount = In + 1;
+
+    static std::string type_name() { return "logistic"; }
+    static std::vector<size_t> dimensions() { return {In}; }
+    static std::string description() { return "Logistic Regression <" + std::to_string(In) + ">"; }
+
+    FixedLogisticRegression() = default;
+    explicit FixedLogisticRegression(const float* parameters) : linear_(parameters) {}
+
+    void forward(const float* input, float* output) const {
+        linear_.forward(input, output);
+        output[0] = fixed_detail::sigmoid(output[0]);
+    }
+
+    float forward(const std::array<float, In>& input) const {
+        return fixed_detail::sigmoid(linear_.forward(input));
+    }
+
+private:
+    FixedLinearRegression<In> linear_;
+};
+
+// Weights [Classes x In] row by row, then [Classes] biases
+template <size_t In, size_t Classes>
+class FixedMultiClassClassifier {
+public:
+    static constexpr size_t kInputSize = In;
+    static constexpr size_t kOutputSize = Classes;
+    static constexpr size_t kParameterCount = Classes * In + Classes;
+
+    static std::string type_name() { return "multiclass"; }
+    static std::vector<size_t> dimensions() { return {In, Classes}; }
+    static std::string description() {
+        return "Multi-Class Classifier <" + std::to_string(In) + ", " + std::to_string(Classes) + ">";
+    }
+
+    FixedMultiClassClassifier() = default;
+    explicit FixedMultiClassClassifier(const float* parameters) {
+        fixed_detail::unroll<Classes * In>([&](auto i) { weights_[i] = parameters[i]; });
+        fixed_detail::unroll<Classes>([&](auto c) { bias_[c] = parameters[Classes * In + c]; });
+    }
+
+    void forward(const float* input, float* output) const {
+        fixed_detail::unroll<Classes>([&](auto c) {
+            output[c] = bias_[c] + fixed_detail::dot<In>(weights_.data() + c * In, input);
+        });
+        fixed_detail::softmax<Classes>(output);
+    }
+
+    std::array<float, Classes> forward(const std::array<float, In>& input) const {
+        std::array<float, Classes> output;
+        forward(input.data(), output.data());
+        return output;
+    }
+
+private:
+    std::array<float, Classes * In> weights_{};
+    std::array<float, Classes> bias_{};
+};
+
+// Public order W1 [In x Hidden], b1, W2 [Hidden x Out], b2; stored transposed
+// so every unit is one contiguous dot product
+template <size_t In, size_t Hidden, size_t Out>
+class FixedTwoLayerMLP {
+public:
+    static constexpr size_t kInputSize = In;
+    static constexpr size_t kOutputSize = Out;
+    static constexpr size_t kParameterCount = In * Hidden + Hidden + Hidden * Out + Out;
+
+    static std::string type_name() { return "mlp"; }
+    static std::vector<size_t> dimensions() { return {In, Hidden, Out}; }
+    static std::string description() {
+        return "Two-Layer MLP <" + std::to_string(In) + ", " + std::to_string(Hidden) + ", " +
+               std::to_string(Out) + ">";
+    }
+
+    FixedTwoLayerMLP() = default;
+    explicit FixedTwoLayerMLP(const float* parameters) {
+        const float* W1 = parameters;
+        const float* b1 = W1 + In * Hidden;
+        const float* W2 = b1 + Hidden;
+        const float* b2 = W2 + Hidden * Out;
+        fixed_detail::unroll<In * Hidden>([&](auto k) {
+            w1_[(k % Hidden) * In + k / Hidden] = W1[k];
+        });
+        fixed_detail::unroll<Hidden>([&](auto h) { b1_[h] = b1[h]; });
+        fixed_detail::unroll<Hidden * Out>([&](auto k) {
+            w2_[(k % Out) * Hidden + k / Out] = W2[k];
+        });
+        fixed_detail::unroll<Out>([&](auto o) { b2_[o] = b2[o]; });
+    }
+
+    void forward(const float* input, float* output) const {
+        std::array<float, Hidden> hidden;
+        fixed_detail::unroll<Hidden>([&](auto h) {
+            const float v = b1_[h] + fixed_detail::dot<In>(w1_.data() + h * In, input);
+            hidden[h] = v > 0.0f ? v : 0.0f;
+        });
+        fixed_detail::unroll<Out>([&](auto o) {
+            output[o] = b2_[o] + fixed_detail::dot<Hidden>(w2_.data() + o * Hidden, hidden.data());
+        });
+    }
+
+    std::array<float, Out> forward(const std::array<float, In>& input) const {
+        std::array<float, Out> output;
+        forward(input.data(), output.data());
+        return output;
+    }
+
+private:
+    std::array<float, Hidden * In> w1_{};
+    std::array<float, Hidden> b1_{};
+    std::array<float, Out * Hidden> w2_{};
+    std::array<float, Out> b2_{};
+};
+
+/**
+ * Fixed-shape copy of a runtime model, or nullopt when its type name or
+ * dimensions differ from Model's. Parameters are read once (in fp32).
+ */
+template <class Model>
+std::optional<Model> to_fixed(const NeuralNetwork& model) {
+    if (model.type_name() != Model::type_name() || model.dimensions() != Model::dimensions()) {
+        return std::nullopt;
+    }
+    const std::vector<float> parameters = model.get_parameters();
+    return Model(parameters.data());
+}
+
+/**
+ * NeuralNetwork adapter over a fixed-shape model, for code that wants the
+ * unrolled math behind the polymorphic interface. One virtual call per
+ * forward remains; hot loops that know the shape should call the fixed
+ * model directly. Parameters keep the public order as their native layout.
+ */
+template <class Model>
+class FixedShapeModel : public NeuralNetwork {
+public:
+    FixedShapeModel() = default;
+    explicit FixedShapeModel(const NeuralNetwork& source) {
+        set_parameters(source.get_parameters());
+    }
+
+    const Model& model() const { return model_; }
+
+    std::unique_ptr<NeuralNetwork> clone() const override {
+        return std::make_unique<FixedShapeModel>(*this);
+    }
+
+    WeightBlock pack_parameters(Span<const float> parameters) const override {
+        check_size(parameters.size());
+        float* data = nullptr;
+        WeightBlock block = WeightBlock::allocate(parameters.size(), data);
+        std::copy(parameters.begin(), parameters.end(), data);
+        return block;
+    }
+
+    WeightBlock adopt_parameters(WeightBlock parameters) const override {
+        check_size(parameters.size());
+        return parameters;
+    }
+
+    void bind_parameters(WeightBlock block) override {
+        check_size(block.size());
+        model_ = Model(block.data());
+        block_ = std::move(block);
+    }
+
+    const WeightBlock& parameter_block() const override { return block_; }
+
+    std::vector<float> get_parameters() const override {
+        if (block_.size() == 0) {
+            return std::vector<float>(Model::kParameterCount, 0.0f);
+        }
+        return std::vector<float>(block_.data(), block_.data() + block_.size());
+    }
+
+    size_t input_size() const override { return Model::kInputSize; }
+    size_t output_size() const override { return Model::kOutputSize; }
+    std::string get_model_type() const override { return "Fixed-Shape " + Model::description(); }
+    std::string type_name() const override { return Model::type_name(); }
+    std::vector<size_t> dimensions() const override { return Model::dimensions(); }
+
+protected:
+    void run(const float* input, float* output, InferenceContext& context) const override {
+        (void)context;
+        model_.forward(input, output);
+    }
+
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   InferenceContext& context) const override {
+        (void)context;
+        for (size_t r = 0; r < batch_size; ++r) {
+            model_.forward(input + r * Model::kInputSize, output + r * Model::kOutputSize);
+        }
+    }
+
+private:
+    static void check_size(size_t size) {
+        if (size != Model::kParameterCount) {
+            throw std::invalid_argument("Parameter count mismatch for " + Model::description());
+        }
+    }
+
+    Model model_;
+    WeightBlock block_;
+};
+
+/**
+ * Build-time set of fixed shapes for make_fixed_model()
+ * DefaultFixedShapes covers the shapes of the demo data in tests/data; pass
+ * another FixedShapeList to specialize for other deployments.
+ */
+template <class... Models>
+struct FixedShapeList {};
+
+using DefaultFixedShapes = FixedShapeList<
+    FixedLinearRegression<3>,
+    FixedLogisticRegression<2>,
+    FixedMultiClassClassifier<4, 3>,
+    FixedTwoLayerMLP<2, 3, 2>,
+    FixedTwoLayerMLP<8, 16, 4>>;
+
+// Fixed-shape replacement for model from the first matching entry of the
+// list, or nullptr when none matches the model's type and dimensions
+template <class... Models>
+std::unique_ptr<NeuralNetwork> make_fixed_model(const NeuralNetwork& model, FixedShapeList<Models...>) {
+    std::unique_ptr<NeuralNetwork> result;
+    (void)((model.type_name() == Models::type_name() && model.dimensions() == Models::dimensions() &&
+            (result = std::make_unique<FixedShapeModel<Models>>(model), true)) ||
+           ...);
+    return result;
+}
+
+std::unique_ptr<NeuralNetwork> make_fixed_model(const NeuralNetwork& model);
+
+} // namespace ZeticML
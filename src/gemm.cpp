@@ -0,0 +1,89 @@
+/**
+ * ZeticML Assignment - Packed GEMM
+ * Panel packing; the blocked micro-kernels live in the per-ISA kernel tables
+ */
+
+#include "gemm.h"
+#include "kernels.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+constexpr size_t NR = PackedMatrix::kPanelWidth;
+
+} // namespace
+
+size_t PackedMatrix::packed_size(size_t rows, size_t cols) {
+    return (cols + NR - 1) / NR * rows * NR;
+}
+
+void PackedMatrix::pack_into(const float* src, size_t ld, size_t rows, size_t cols, float* dst) {
+    const size_t num_panels = (cols + NR - 1) / NR;
+    for (size_t p = 0; p < num_panels; ++p) {
+        float* out = dst + p * rows * NR;
+        const size_t col0 = p * NR;
+        const size_t width = std::min(NR, cols - col0);
+        for (size_t k = 0; k < rows; ++k) {
+            const float* row = src + k * ld + col0;
+            for (size_t j = 0; j < NR; ++j) {
+                out[k * NR + j] = j < width ? row[j] : 0.0f;
+            }
+        }
+    }
+}
+
+PackedMatrix PackedMatrix::view(const float* packed, size_t rows, size_t cols) {
+    PackedMatrix m;
+    m.view_ = packed;
+    m.rows_ = rows;
+    m.cols_ = cols;
+    m.num_panels_ = (cols + NR - 1) / NR;
+    return m;
+}
+
+PackedMatrix::PackedMatrix(size_t rows, size_t cols)
+    : rows_(rows), cols_(cols), num_panels_((cols + NR - 1) / NR) {
+    storage_.assign(packed_size(rows, cols), 0.0f);
+}
+
+void PackedMatrix::pack(const float* src, size_t ld) {
+    pack_into(src, ld, rows_, cols_, storage_.data());
+}
+
+void PackedMatrix::unpack(float* dst, size_t ld) const {
+    for (size_t p = 0; p < num_panels_; ++p) {
+        const float* src = panel(p);
+        const size_t col0 = p * NR;
+        const size_t width = std::min(NR, cols_ - col0);
+        for (size_t k = 0; k < rows_; ++k) {
+            for (size_t j = 0; j < width; ++j) {
+                dst[k * ld + col0 + j] = src[k * NR + j];
+            }
+        }
+    }
+}
+
+void gemm_packed(const float* A, size_t M, size_t lda,
+                 const PackedMatrix& B, const float* bias, Epilogue epilogue,
+                 float* C, size_t ldc) {
+    const float* panels = B.num_panels() > 0 ? B.panel(0) : nullptr;
+    kernels().gemm(A, M, lda, panels, B.rows(), B.cols(), bias, epilogue, C, ldc);
+}
+
+void gemm_packed_half(const float* A, size_t M, size_t lda,
+                      const uint16_t* B_panels, WeightPrecision precision, size_t K, size_t N,
+                      const float* bias, Epilogue epilogue, float* C, size_t ldc) {
+    const KernelTable& k = kernels();
+    if (precision == WeightPrecision::Float16) {
+        k.gemm_f16(A, M, lda, B_panels, K, N, bias, epilogue, C, ldc);
+    } else if (precision == WeightPrecision::BFloat16) {
+        k.gemm_bf16(A, M, lda, B_panels, K, N, bias, epilogue, C, ldc);
+    } else {
+        throw std::invalid_argument("gemm_packed_half needs a 16-bit precision");
+    }
+}
+
+} // namespace ZeticML
@@ -0,0 +1,90 @@
+/**
+ * ZeticML Assignment - Packed GEMM Kernels
+ * Cache-blocked single-precision matrix multiply used by dense layers
+ */
+
+#pragma once
+
+#include "aligned_buffer.h"
+#include "half_precision.h"
+#include <vector>
+#include <cstddef>
+
+namespace ZeticML {
+
+// Operation fused into the GEMM store, applied after the bias add while the
+// tile is still in registers
+enum class Epilogue {
+    None,
+    Relu,
+    Sigmoid
+};
+
+/**
+ * Right-hand matrix B [K x N] repacked into column panels for the micro-kernel
+ * Panel p holds columns [p*kPanelWidth, (p+1)*kPanelWidth) stored as K
+ * consecutive rows of kPanelWidth floats; the last panel is zero-padded.
+ * Packing is done once (at set_parameters time), never on the inference path.
+ *
+ * A PackedMatrix either owns its panels or views panels stored elsewhere
+ * (e.g. inside a model's WeightBlock or a memory-mapped file).
+ */
+class PackedMatrix {
+public:
+    static constexpr size_t kPanelWidth = 16;
+
+    // Floats needed to hold a packed [rows x cols] matrix
+    static size_t packed_size(size_t rows, size_t cols);
+
+    // Pack a row-major [rows x cols] source with leading dimension ld into dst
+    // (packed_size(rows, cols) floats)
+    static void pack_into(const float* src, size_t ld, size_t rows, size_t cols, float* dst);
+
+    // Non-owning view over already packed panels
+    static PackedMatrix view(const float* packed, size_t rows, size_t cols);
+
+    PackedMatrix() = default;
+
+    // Owning, zero-filled matrix
+    PackedMatrix(size_t rows, size_t cols);
+
+    // Pack a row-major [rows x cols] source with leading dimension ld
+    // (owning matrices only)
+    void pack(const float* src, size_t ld);
+
+    // Reverse of pack(): write the logical matrix back as row-major
+    void unpack(float* dst, size_t ld) const;
+
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    size_t num_panels() const { return num_panels_; }
+    const float* data() const { return storage_.empty() ? view_ : storage_.data(); }
+    const float* panel(size_t p) const { return data() + p * rows_ * kPanelWidth; }
+
+private:
+    AlignedVector<float> storage_;
+    const float* view_ = nullptr;
+    size_t rows_ = 0;
+    size_t cols_ = 0;
+    size_t num_panels_ = 0;
+};
+
+/**
+ * C[M x N] = epilogue(A[M x K] * B + bias)
+ * A and C are row-major with leading dimensions lda / ldc. bias has N entries
+ * and may be nullptr. B.rows() must equal K.
+ * Runs the register-blocked micro-kernel of the active kernel table.
+ */
+void gemm_packed(const float* A, size_t M, size_t lda,
+                 const PackedMatrix& B, const float* bias, Epilogue epilogue,
+                 float* C, size_t ldc);
+
+/**
+ * Same with B's panels (PackedMatrix layout for a logical [K x N] matrix)
+ * stored as 16-bit weights; precision must be Float16 or BFloat16
+ */
+void gemm_packed_half(const float* A, size_t M, size_t lda,
+                      const uint16_t* B_panels, WeightPrecision precision, size_t K, size_t N,
+                      const float* bias, Epilogue epilogue, float* C, size_t ldc);
+
+} // namespace ZeticML
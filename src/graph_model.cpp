@@ -0,0 +1,960 @@
+/**
+ * ZeticML Assignment - Layer Graph Engine Implementation
+ * Planning pass, native parameter layout and tiled execution
+ */
+
+#include "graph_model.h"
+#include "kernels.h"
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+
+namespace ZeticML {
+
+namespace {
+
+// Rows per tile; the intermediates of one tile stay in L2 between layers
+constexpr size_t kRowTile = 64;
+
+// Bytes of weights per class block of a Rows layer; the block stays in L2
+// while every row of the tile streams past it
+constexpr size_t kClassBlockBytes = 256 * 1024;
+
+constexpr size_t kNoStep = static_cast<size_t>(-1);
+
+// Floats taken by `count` weights at the given precision
+size_t weight_words(size_t count, WeightPrecision precision) {
+    if (precision == WeightPrecision::Float32) {
+        return count;
+    }
+    // Two 16-bit weights per float slot, section kept cache-line aligned
+    return round_up_to_simd((count + 1) / 2);
+}
+
+// dst[c * rows + r] = src[r * cols + c]
+void transpose(const float* src, size_t rows, size_t cols, float* dst) {
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < cols; ++c) {
+            dst[c * rows + r] = src[r * cols + c];
+        }
+    }
+}
+
+// Pack a row-major [rows x cols] matrix into panels at the given precision
+void pack_panels(const float* src, size_t rows, size_t cols, WeightPrecision precision,
+                 float* dst) {
+    if (precision == WeightPrecision::Float32) {
+        PackedMatrix::pack_into(src, cols, rows, cols, dst);
+        return;
+    }
+    AlignedVector<float> panels(PackedMatrix::packed_size(rows, cols));
+    PackedMatrix::pack_into(src, cols, rows, cols, panels.data());
+    narrow_weights(panels.data(), panels.size(), precision, reinterpret_cast<uint16_t*>(dst));
+}
+
+// Inverse of pack_panels() into a row-major [rows x cols] matrix
+void unpack_panels(const float* src, size_t rows, size_t cols, WeightPrecision precision,
+                   float* dst) {
+    if (precision == WeightPrecision::Float32) {
+        PackedMatrix::view(src, rows, cols).unpack(dst, cols);
+        return;
+    }
+    AlignedVector<float> panels(PackedMatrix::packed_size(rows, cols));
+    widen_weights(reinterpret_cast<const uint16_t*>(src), panels.size(), precision, panels.data());
+    PackedMatrix::view(panels.data(), rows, cols).unpack(dst, cols);
+}
+
+void copy_rows(const float* src, size_t lds, size_t rows, size_t width, float* dst, size_t ldd) {
+    for (size_t r = 0; r < rows; ++r) {
+        std::copy(src + r * lds, src + r * lds + width, dst + r * ldd);
+    }
+}
+
+// Elementwise activation in place over [rows x width] with leading dimension ld
+void apply_activation(LayerOp op, float* x, size_t ld, size_t rows, size_t width) {
+    const KernelTable& k = kernels();
+    if (op == LayerOp::Softmax) {
+        for (size_t r = 0; r < rows; ++r) {
+            k.softmax(x + r * ld, width);
+        }
+        return;
+    }
+    if (ld == width) {
+        // Contiguous tile: one call over every element
+        width *= rows;
+        rows = 1;
+    }
+    for (size_t r = 0; r < rows; ++r) {
+        float* row = x + r * ld;
+        if (op == LayerOp::Sigmoid) {
+            k.sigmoid(row, width);
+        } else {
+            for (size_t i = 0; i < width; ++i) {
+                row[i] = std::max(row[i], 0.0f);
+            }
+        }
+    }
+}
+
+const char* op_name(LayerOp op) {
+    switch (op) {
+        case LayerOp::Input: return "input";
+        case LayerOp::Dense: return "dense";
+        case LayerOp::Relu: return "relu";
+        case LayerOp::Sigmoid: return "sigmoid";
+        case LayerOp::Softmax: return "softmax";
+        case LayerOp::Add: return "add";
+        case LayerOp::Concat: return "concat";
+    }
+    return "unknown";
+}
+
+const char* kernel_name(DenseKernel kernel) {
+    switch (kernel) {
+        case DenseKernel::Auto: return "auto";
+        case DenseKernel::Dot: return "dot";
+        case DenseKernel::Rows: return "rows";
+        case DenseKernel::Panels: return "panels";
+    }
+    return "unknown";
+}
+
+bool is_activation(LayerOp op) {
+    return op == LayerOp::Relu || op == LayerOp::Sigmoid || op == LayerOp::Softmax;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// LayerGraph
+
+LayerGraph::LayerGraph(size_t input_size) {
+    LayerNode input;
+    input.width = input_size;
+    nodes_.push_back(input);
+}
+
+void LayerGraph::check(TensorId tensor) const {
+    if (tensor >= nodes_.size()) {
+        throw std::invalid_argument("Unknown tensor " + std::to_string(tensor));
+    }
+}
+
+TensorId LayerGraph::append(LayerNode node) {
+    nodes_.push_back(std::move(node));
+    if (!output_fixed_) {
+        output_ = nodes_.size() - 1;
+    }
+    return nodes_.size() - 1;
+}
+
+TensorId LayerGraph::dense(TensorId x, size_t units, WeightOrder order, DenseKernel kernel) {
+    check(x);
+    if (kernel == DenseKernel::Dot && units != 1) {
+        throw std::invalid_argument("Dot dense layers have exactly one unit");
+    }
+    LayerNode node;
+    node.op = LayerOp::Dense;
+    node.inputs = {x};
+    node.width = units;
+    node.kernel = kernel;
+    node.order = order;
+    return append(std::move(node));
+}
+
+TensorId LayerGraph::relu(TensorId x) {
+    check(x);
+    LayerNode node;
+    node.op = LayerOp::Relu;
+    node.inputs = {x};
+    node.width = nodes_[x].width;
+    return append(std::move(node));
+}
+
+TensorId LayerGraph::sigmoid(TensorId x) {
+    check(x);
+    LayerNode node;
+    node.op = LayerOp::Sigmoid;
+    node.inputs = {x};
+    node.width = nodes_[x].width;
+    return append(std::move(node));
+}
+
+TensorId LayerGraph::softmax(TensorId x) {
+    check(x);
+    LayerNode node;
+    node.op = LayerOp::Softmax;
+    node.inputs = {x};
+    node.width = nodes_[x].width;
+    return append(std::move(node));
+}
+
+TensorId LayerGraph::add(TensorId a, TensorId b) {
+    check(a);
+    check(b);
+    if (nodes_[a].width != nodes_[b].width) {
+        throw std::invalid_argument("Add inputs differ in width");
+    }
+    LayerNode node;
+    node.op = LayerOp::Add;
+    node.inputs = {a, b};
+    node.width = nodes_[a].width;
+    return append(std::move(node));
+}
+
+TensorId LayerGraph::concat(const std::vector<TensorId>& parts) {
+    if (parts.empty()) {
+        throw std::invalid_argument("Concat needs at least one input");
+    }
+    LayerNode node;
+    node.op = LayerOp::Concat;
+    for (TensorId part : parts) {
+        check(part);
+        node.width += nodes_[part].width;
+    }
+    node.inputs = parts;
+    return append(std::move(node));
+}
+
+void LayerGraph::set_output(TensorId tensor) {
+    check(tensor);
+    output_ = tensor;
+    output_fixed_ = true;
+}
+
+size_t LayerGraph::parameter_count() const {
+    size_t count = 0;
+    for (const LayerNode& node : nodes_) {
+        if (node.op == LayerOp::Dense) {
+            count += nodes_[node.inputs[0]].width * node.width + node.width;
+        }
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// GraphModel: planning
+
+GraphModel::GraphModel(LayerGraph graph) : graph_(std::move(graph)) {
+    if (graph_.output() == graph_.input()) {
+        throw std::invalid_argument("Layer graph has no layers");
+    }
+    plan();
+#if ZETIC_ENABLE_INSTRUMENTATION
+    step_scopes_.resize(steps_.size());
+#endif
+    layout_parameters();
+    float* unused = nullptr;
+    params_ = WeightBlock::allocate(native_count_, unused);
+}
+
+void GraphModel::plan() {
+    const std::vector<LayerNode>& nodes = graph_.nodes();
+    const size_t count = nodes.size();
+
+    // Consumers per tensor; the graph output counts as one
+    std::vector<size_t> uses(count, 0);
+    std::vector<TensorId> consumer(count, 0);
+    for (TensorId t = 1; t < count; ++t) {
+        for (TensorId in : nodes[t].inputs) {
+            ++uses[in];
+            consumer[in] = t;
+        }
+    }
+    ++uses[graph_.output()];
+    auto sole_consumer = [&](TensorId t) -> const LayerNode* {
+        return uses[t] == 1 && t != graph_.output() ? &nodes[consumer[t]] : nullptr;
+    };
+
+    // alias[t]: the tensor whose storage t shares (itself when it has its own)
+    std::vector<TensorId> alias(count);
+    for (TensorId t = 0; t < count; ++t) {
+        alias[t] = t;
+    }
+    auto root = [&](TensorId t) {
+        while (alias[t] != t) {
+            t = alias[t];
+        }
+        return t;
+    };
+    // Only an exclusively consumed layer output may be overwritten in place
+    auto exclusive = [&](TensorId t) { return t != graph_.input() && uses[t] == 1; };
+
+    std::vector<size_t> producer(count, kNoStep);
+    dense_.clear();
+    steps_.clear();
+    for (TensorId t = 1; t < count; ++t) {
+        const LayerNode& node = nodes[t];
+        Step step;
+        step.op = node.op;
+        step.inputs = node.inputs;
+        step.output = t;
+
+        if (node.op == LayerOp::Dense) {
+            DenseLayer layer;
+            layer.inputs = nodes[node.inputs[0]].width;
+            layer.units = node.width;
+            layer.order = node.order;
+            layer.kernel = node.kernel;
+            if (layer.kernel == DenseKernel::Auto) {
+                const LayerNode* next = sole_consumer(t);
+                if (layer.units == 1) {
+                    layer.kernel = DenseKernel::Dot;
+                } else if (next != nullptr && next->op == LayerOp::Softmax) {
+                    layer.kernel = DenseKernel::Rows;
+                } else {
+                    layer.kernel = DenseKernel::Panels;
+                }
+            }
+            step.dense = dense_.size();
+            dense_.push_back(layer);
+        } else if (is_activation(node.op)) {
+            const TensorId x = node.inputs[0];
+            if (exclusive(x)) {
+                alias[t] = x;
+                Step* source = producer[x] != kNoStep ? &steps_[producer[x]] : nullptr;
+                if (source != nullptr && source->op == LayerOp::Dense &&
+                    source->activation == LayerOp::Input) {
+                    // Fused into the producing layer's store
+                    source->activation = node.op;
+                    producer[t] = producer[x];
+                    continue;
+                }
+            }
+        } else if (node.op == LayerOp::Add) {
+            const TensorId a = node.inputs[0], b = node.inputs[1];
+            if (exclusive(a)) {
+                alias[t] = a;
+            } else if (exclusive(b)) {
+                alias[t] = b;
+            }
+        }
+        producer[t] = steps_.size();
+        steps_.push_back(std::move(step));
+    }
+
+    // Concat parts owned by nobody else are written straight into the slice
+    struct Placement {
+        TensorId target = 0;
+        size_t column = 0;
+        bool placed = false;
+    };
+    std::vector<Placement> placement(count);
+    for (TensorId t = 1; t < count; ++t) {
+        if (nodes[t].op != LayerOp::Concat) {
+            continue;
+        }
+        size_t column = 0;
+        for (TensorId part : nodes[t].inputs) {
+            const TensorId r = root(part);
+            if (exclusive(part) && !placement[r].placed) {
+                placement[r] = {t, column, true};
+            }
+            column += nodes[part].width;
+        }
+    }
+
+    // Resolve storage: input, caller's output, a concat slice or a region
+    const TensorId output_root = root(graph_.output());
+    std::vector<TensorRef> resolved(count);
+    std::vector<bool> done(count, false);
+    regions_.clear();
+    auto resolve = [&](TensorId r, auto& self) -> TensorRef {
+        if (done[r]) {
+            return resolved[r];
+        }
+        TensorRef ref;
+        if (r == graph_.input()) {
+            ref.region = kInputRegion;
+        } else if (r == output_root) {
+            ref.region = kOutputRegion;
+        } else if (placement[r].placed) {
+            ref = self(root(placement[r].target), self);
+            ref.column += placement[r].column;
+        } else {
+            ref.region = regions_.size();
+            regions_.push_back({0, nodes[r].width});
+        }
+        done[r] = true;
+        resolved[r] = ref;
+        return ref;
+    };
+    refs_.assign(count, TensorRef());
+    for (TensorId t = 0; t < count; ++t) {
+        refs_[t] = resolve(root(t), resolve);
+    }
+
+    // Concats whose parts all landed in place need no step
+    auto in_place = [&](const Step& step) {
+        size_t column = refs_[step.output].column;
+        for (TensorId part : step.inputs) {
+            if (refs_[part].region != refs_[step.output].region || refs_[part].column != column) {
+                return false;
+            }
+            column += nodes[part].width;
+        }
+        return true;
+    };
+    steps_.erase(std::remove_if(steps_.begin(), steps_.end(), [&](const Step& step) {
+        return step.op == LayerOp::Concat && in_place(step);
+    }), steps_.end());
+
+    plan_memory();
+}
+
+void GraphModel::plan_memory() {
+    // Lifetime of each region: first to last step that touches it
+    const size_t count = regions_.size();
+    std::vector<size_t> first(count, kNoStep), last(count, 0);
+    auto touch = [&](TensorId t, size_t s) {
+        const size_t region = refs_[t].region;
+        if (region < count) {
+            first[region] = std::min(first[region], s);
+            last[region] = std::max(last[region], s);
+        }
+    };
+    for (size_t s = 0; s < steps_.size(); ++s) {
+        touch(steps_[s].output, s);
+        for (TensorId in : steps_[s].inputs) {
+            touch(in, s);
+        }
+    }
+
+    // Widest first, each at the lowest offset clear of every placed region
+    // whose lifetime overlaps its own
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return regions_[a].width > regions_[b].width;
+    });
+
+    std::vector<size_t> placed;
+    workspace_width_ = 0;
+    tensor_width_ = 0;
+    for (size_t i : order) {
+        std::vector<size_t> conflicts;
+        for (size_t j : placed) {
+            if (first[j] <= last[i] && first[i] <= last[j]) {
+                conflicts.push_back(j);
+            }
+        }
+        std::sort(conflicts.begin(), conflicts.end(), [&](size_t a, size_t b) {
+            return regions_[a].offset < regions_[b].offset;
+        });
+
+        size_t offset = 0;
+        for (size_t j : conflicts) {
+            if (offset + regions_[i].width <= regions_[j].offset) {
+                break;
+            }
+            offset = std::max(offset, regions_[j].offset + regions_[j].width);
+        }
+        regions_[i].offset = offset;
+        placed.push_back(i);
+        workspace_width_ = std::max(workspace_width_, offset + regions_[i].width);
+        tensor_width_ += regions_[i].width;
+    }
+}
+
+void GraphModel::layout_parameters() {
+    size_t end = 0;
+    size_t public_offset = 0;
+    bool is_public = precision_ == WeightPrecision::Float32;
+    for (DenseLayer& layer : dense_) {
+        layer.weights = round_up_to_simd(end);
+        is_public = is_public && layer.weights == end;
+        layer.public_offset = public_offset;
+        public_offset += layer.inputs * layer.units + layer.units;
+
+        switch (layer.kernel) {
+            case DenseKernel::Dot:
+                layer.bias = layer.weights + layer.inputs;
+                end = layer.bias + 1;
+                break;
+            case DenseKernel::Rows:
+                layer.stride = round_up_to_simd(layer.inputs);
+                layer.bias = layer.weights + weight_words(layer.units * layer.stride, precision_);
+                end = layer.bias + layer.units;
+                is_public = is_public && layer.stride == layer.inputs &&
+                            layer.order == WeightOrder::OutputMajor;
+                break;
+            case DenseKernel::Panels:
+            case DenseKernel::Auto:
+                layer.bias = layer.weights +
+                             weight_words(PackedMatrix::packed_size(layer.inputs, layer.units), precision_);
+                end = layer.bias + round_up_to_simd(layer.units);
+                is_public = false;
+                break;
+        }
+    }
+    native_count_ = end;
+    native_is_public_ = is_public;
+}
+
+std::string GraphModel::step_summary(const Step& step) const {
+    std::string summary = op_name(step.op);
+    if (step.op == LayerOp::Dense) {
+        const DenseLayer& layer = dense_[step.dense];
+        summary += std::string("[") + kernel_name(layer.kernel) + "]";
+        if (step.activation != LayerOp::Input) {
+            summary += std::string("+") + op_name(step.activation);
+        }
+        return summary + " " + std::to_string(layer.inputs) + "->" + std::to_string(layer.units);
+    }
+    const TensorRef& in = refs_[step.inputs[0]];
+    const TensorRef& out = refs_[step.output];
+    if (step.op != LayerOp::Concat && in.region == out.region && in.column == out.column) {
+        summary += "[in-place]";
+    }
+    return summary + " " + std::to_string(graph_.node(step.output).width);
+}
+
+std::string GraphModel::plan_summary() const {
+    std::string summary;
+    for (const Step& step : steps_) {
+        if (!summary.empty()) {
+            summary += "\n";
+        }
+        summary += step_summary(step);
+    }
+    return summary;
+}
+
+#if ZETIC_ENABLE_INSTRUMENTATION
+uint32_t GraphModel::step_scope(size_t step) const {
+    return step_scopes_[step].get([&] {
+        return instrumentation_name() + "/" + std::to_string(step) + ":" + step_summary(steps_[step]);
+    });
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// GraphModel: execution
+
+size_t GraphModel::class_block(const DenseLayer& layer) const {
+    const size_t block = kClassBlockBytes / (layer.stride * precision_bytes(precision_) + 1);
+    return std::max<size_t>(4, block / 4 * 4);
+}
+
+void GraphModel::row_logits(const DenseLayer& layer, const float* x, size_t c0, size_t count,
+                            float* out) const {
+    const KernelTable& k = kernels();
+    const float* weights = params_.data() + layer.weights;
+    const float* bias = params_.data() + layer.bias + c0;
+    const size_t offset = c0 * layer.stride;
+    switch (precision_) {
+        case WeightPrecision::Float32:
+            k.matvec(weights + offset, layer.stride, bias, count, x, layer.inputs, out);
+            break;
+        case WeightPrecision::Float16:
+            k.matvec_f16(reinterpret_cast<const uint16_t*>(weights) + offset, layer.stride, bias, count,
+                         x, layer.inputs, out);
+            break;
+        case WeightPrecision::BFloat16:
+            k.matvec_bf16(reinterpret_cast<const uint16_t*>(weights) + offset, layer.stride, bias, count,
+                          x, layer.inputs, out);
+            break;
+    }
+}
+
+GraphModel::WeightRows GraphModel::weight_rows(size_t dense_index) const {
+    const DenseLayer& layer = dense_[dense_index];
+    WeightRows rows;
+    rows.data = reinterpret_cast<const unsigned char*>(params_.data() + layer.weights);
+    rows.row_bytes = layer.stride * precision_bytes(precision_);
+    rows.rows = layer.units;
+    return rows;
+}
+
+float GraphModel::sparse_logit(const SparseVector& input) const {
+    validate_sparse(input, graph_.input_size());
+    const DenseLayer& layer = dense_.front();
+    const float* base = params_.data();
+    return base[layer.bias] + kernels().sparse_dot(base + layer.weights, input.indices.data(),
+                                                   input.values.data(), input.nnz());
+}
+
+void GraphModel::sparse_logits(const CsrMatrix& batch, float* output) const {
+    validate_sparse(batch, graph_.input_size());
+    if (batch.rows() > 0 && output == nullptr) {
+        throw std::invalid_argument("Null batch buffer");
+    }
+    const KernelTable& k = kernels();
+    const DenseLayer& layer = dense_.front();
+    const float* base = params_.data();
+    for (size_t r = 0; r < batch.rows(); ++r) {
+        const SparseVector row = batch.row(r);
+        output[r] = base[layer.bias] + k.sparse_dot(base + layer.weights, row.indices.data(),
+                                                    row.values.data(), row.nnz());
+    }
+}
+
+void GraphModel::run_dense(const DenseLayer& layer, LayerOp activation, const float* x, size_t ldx,
+                           size_t rows, float* y, size_t ldy) const {
+    const KernelTable& k = kernels();
+    const float* base = params_.data();
+    const float* weights = base + layer.weights;
+    const uint16_t* half_weights = reinterpret_cast<const uint16_t*>(weights);
+    const float* bias = base + layer.bias;
+    bool fused = false;
+
+    switch (layer.kernel) {
+        case DenseKernel::Dot:
+            for (size_t r = 0; r < rows; ++r) {
+                y[r * ldy] = bias[0] + k.dot(weights, x + r * ldx, layer.inputs);
+            }
+            break;
+
+        case DenseKernel::Rows: {
+            // Class blocks outer, rows inner: each block of weight rows is
+            // read from memory once per group of rows instead of once per
+            // sample. The activation runs on each block of logits while it
+            // is still in L1; a softmax folds the block into per-row online
+            // (max, sum) statistics and only normalizes at the end.
+            const size_t block = class_block(layer);
+            float row_max[kRowTile];
+            float row_sum[kRowTile];
+            fused = true;
+
+            for (size_t r0 = 0; r0 < rows; r0 += kRowTile) {
+                const size_t group = std::min(kRowTile, rows - r0);
+                std::fill(row_max, row_max + group, std::numeric_limits<float>::lowest());
+                std::fill(row_sum, row_sum + group, 0.0f);
+
+                for (size_t c0 = 0; c0 < layer.units; c0 += block) {
+                    const size_t classes = std::min(block, layer.units - c0);
+                    for (size_t r = 0; r < group; ++r) {
+                        float* out = y + (r0 + r) * ldy + c0;
+                        row_logits(layer, x + (r0 + r) * ldx, c0, classes, out);
+                        if (activation == LayerOp::Softmax) {
+                            k.softmax_stats(out, classes, &row_max[r], &row_sum[r]);
+                        } else if (activation != LayerOp::Input) {
+                            apply_activation(activation, out, classes, 1, classes);
+                        }
+                    }
+                }
+
+                if (activation == LayerOp::Softmax) {
+                    for (size_t r = 0; r < group; ++r) {
+                        k.softmax_normalize(y + (r0 + r) * ldy, layer.units, row_max[r], row_sum[r]);
+                    }
+                }
+            }
+            break;
+        }
+
+        case DenseKernel::Panels:
+        case DenseKernel::Auto: {
+            // ReLU and sigmoid run on the accumulators before the store
+            Epilogue epilogue = Epilogue::None;
+            if (activation == LayerOp::Relu) {
+                epilogue = Epilogue::Relu;
+            } else if (activation == LayerOp::Sigmoid) {
+                epilogue = Epilogue::Sigmoid;
+            }
+            fused = epilogue != Epilogue::None;
+            if (precision_ == WeightPrecision::Float32) {
+                k.gemm(x, rows, ldx, layer.units > 0 ? weights : nullptr, layer.inputs, layer.units,
+                       bias, epilogue, y, ldy);
+            } else {
+                gemm_packed_half(x, rows, ldx, half_weights, precision_, layer.inputs, layer.units,
+                                 bias, epilogue, y, ldy);
+            }
+            break;
+        }
+    }
+
+    if (activation != LayerOp::Input && !fused) {
+        apply_activation(activation, y, ldy, rows, layer.units);
+    }
+}
+
+void GraphModel::execute(const float* input, size_t batch_size, float* output,
+                         Workspace& workspace) const {
+    const size_t I = graph_.input_size();
+    const size_t O = graph_.output_size();
+
+    // A graph without intermediates runs the whole batch as one tile
+    const size_t tile = regions_.empty() ? batch_size : std::min(kRowTile, batch_size);
+    float* scratch = regions_.empty() ? nullptr : workspace.acquire(workspace_size(batch_size));
+
+    for (size_t r0 = 0; r0 < batch_size; r0 += tile) {
+        const size_t rows = std::min(tile, batch_size - r0);
+
+        auto writable = [&](TensorId t, size_t& ld) -> float* {
+            const TensorRef& ref = refs_[t];
+            if (ref.region == kOutputRegion) {
+                ld = O;
+                return output + r0 * O + ref.column;
+            }
+            const Region& region = regions_[ref.region];
+            ld = region.width;
+            return scratch + tile * region.offset + ref.column;
+        };
+        auto readable = [&](TensorId t, size_t& ld) -> const float* {
+            if (refs_[t].region == kInputRegion) {
+                ld = I;
+                return input + r0 * I + refs_[t].column;
+            }
+            return writable(t, ld);
+        };
+
+        for (const Step& step : steps_) {
+            const size_t width = graph_.node(step.output).width;
+            ZETIC_INSTRUMENT_SCOPE(record, step_scope(static_cast<size_t>(&step - steps_.data())), rows,
+                                   rows * width * sizeof(float));
+            size_t ldx = 0, ldy = 0;
+            float* y = writable(step.output, ldy);
+
+            switch (step.op) {
+                case LayerOp::Dense: {
+                    const float* x = readable(step.inputs[0], ldx);
+                    run_dense(dense_[step.dense], step.activation, x, ldx, rows, y, ldy);
+                    break;
+                }
+                case LayerOp::Relu:
+                case LayerOp::Sigmoid:
+                case LayerOp::Softmax: {
+                    const float* x = readable(step.inputs[0], ldx);
+                    if (x != y) {
+                        copy_rows(x, ldx, rows, width, y, ldy);
+                    }
+                    apply_activation(step.op, y, ldy, rows, width);
+                    break;
+                }
+                case LayerOp::Add: {
+                    size_t lda = 0, ldb = 0;
+                    const float* a = readable(step.inputs[0], lda);
+                    const float* b = readable(step.inputs[1], ldb);
+                    for (size_t r = 0; r < rows; ++r) {
+                        for (size_t i = 0; i < width; ++i) {
+                            y[r * ldy + i] = a[r * lda + i] + b[r * ldb + i];
+                        }
+                    }
+                    break;
+                }
+                case LayerOp::Concat: {
+                    size_t column = 0;
+                    for (TensorId part : step.inputs) {
+                        const size_t part_width = graph_.node(part).width;
+                        const float* x = readable(part, ldx);
+                        if (x != y + column) {
+                            copy_rows(x, ldx, rows, part_width, y + column, ldy);
+                        }
+                        column += part_width;
+                    }
+                    break;
+                }
+                case LayerOp::Input:
+                    break;
+            }
+        }
+    }
+}
+
+size_t GraphModel::workspace_size(size_t batch_size) const {
+    return std::min(kRowTile, batch_size) * workspace_width_;
+}
+
+void GraphModel::run(const float* input, float* output, InferenceContext& context) const {
+    execute(input, 1, output, context.workspace());
+}
+
+void GraphModel::run_batch(const float* input, size_t batch_size, float* output,
+                           InferenceContext& context) const {
+    execute(input, batch_size, output, context.workspace());
+}
+
+// ---------------------------------------------------------------------------
+// GraphModel: parameters
+
+WeightBlock GraphModel::pack_parameters(Span<const float> parameters) const {
+    if (parameters.size() != graph_.parameter_count()) {
+        throw std::invalid_argument("Parameter size mismatch");
+    }
+
+    float* dst = nullptr;
+    WeightBlock block = WeightBlock::allocate(native_count_, dst);
+
+    // Per Dense layer: weights in the layer's public order, then biases
+    for (const DenseLayer& layer : dense_) {
+        const size_t in = layer.inputs, units = layer.units;
+        const float* W = parameters.data() + layer.public_offset;
+        const float* b = W + in * units;
+        std::vector<float> reordered;
+
+        switch (layer.kernel) {
+            case DenseKernel::Dot:
+                std::copy(W, W + in, dst + layer.weights);
+                break;
+
+            case DenseKernel::Rows: {
+                // Output-major rows into the padded layout; padding stays zero
+                const float* rows = W;
+                if (layer.order == WeightOrder::InputMajor) {
+                    reordered.resize(in * units);
+                    transpose(W, in, units, reordered.data());
+                    rows = reordered.data();
+                }
+                uint16_t* half_dst = reinterpret_cast<uint16_t*>(dst + layer.weights);
+                for (size_t o = 0; o < units; ++o) {
+                    if (precision_ == WeightPrecision::Float32) {
+                        std::copy(rows + o * in, rows + (o + 1) * in, dst + layer.weights + o * layer.stride);
+                    } else {
+                        narrow_weights(rows + o * in, in, precision_, half_dst + o * layer.stride);
+                    }
+                }
+                break;
+            }
+
+            case DenseKernel::Panels:
+            case DenseKernel::Auto: {
+                const float* matrix = W;
+                if (layer.order == WeightOrder::OutputMajor) {
+                    reordered.resize(in * units);
+                    transpose(W, units, in, reordered.data());
+                    matrix = reordered.data();
+                }
+                pack_panels(matrix, in, units, precision_, dst + layer.weights);
+                break;
+            }
+        }
+        std::copy(b, b + units, dst + layer.bias);
+    }
+    return block;
+}
+
+WeightBlock GraphModel::adopt_parameters(WeightBlock parameters) const {
+    if (native_is_public_ && parameters.size() == native_count_) {
+        return parameters;
+    }
+    return pack_parameters(Span<const float>(parameters.data(), parameters.size()));
+}
+
+void GraphModel::bind_parameters(WeightBlock block) {
+    if (block.size() != native_count_) {
+        throw std::invalid_argument("Parameter size mismatch");
+    }
+    params_ = std::move(block);
+    zero_params_ = false;
+}
+
+const WeightBlock& GraphModel::parameter_block() const {
+    return params_;
+}
+
+std::vector<float> GraphModel::get_parameters() const {
+    std::vector<float> parameters(graph_.parameter_count());
+    const float* base = params_.data();
+
+    for (const DenseLayer& layer : dense_) {
+        const size_t in = layer.inputs, units = layer.units;
+        float* W = parameters.data() + layer.public_offset;
+        float* b = W + in * units;
+        std::vector<float> reordered;
+
+        switch (layer.kernel) {
+            case DenseKernel::Dot:
+                std::copy(base + layer.weights, base + layer.weights + in, W);
+                break;
+
+            case DenseKernel::Rows: {
+                float* rows = W;
+                if (layer.order == WeightOrder::InputMajor) {
+                    reordered.resize(in * units);
+                    rows = reordered.data();
+                }
+                const uint16_t* half_src = reinterpret_cast<const uint16_t*>(base + layer.weights);
+                for (size_t o = 0; o < units; ++o) {
+                    if (precision_ == WeightPrecision::Float32) {
+                        const float* row = base + layer.weights + o * layer.stride;
+                        std::copy(row, row + in, rows + o * in);
+                    } else {
+                        widen_weights(half_src + o * layer.stride, in, precision_, rows + o * in);
+                    }
+                }
+                if (layer.order == WeightOrder::InputMajor) {
+                    transpose(rows, units, in, W);
+                }
+                break;
+            }
+
+            case DenseKernel::Panels:
+            case DenseKernel::Auto: {
+                float* matrix = W;
+                if (layer.order == WeightOrder::OutputMajor) {
+                    reordered.resize(in * units);
+                    matrix = reordered.data();
+                }
+                unpack_panels(base + layer.weights, in, units, precision_, matrix);
+                if (layer.order == WeightOrder::OutputMajor) {
+                    transpose(matrix, in, units, W);
+                }
+                break;
+            }
+        }
+        std::copy(base + layer.bias, base + layer.bias + units, b);
+    }
+    return parameters;
+}
+
+WeightPrecision GraphModel::weight_precision() const {
+    return precision_;
+}
+
+void GraphModel::set_weight_precision(WeightPrecision precision) {
+    if (precision == precision_) {
+        return;
+    }
+    for (const DenseLayer& layer : dense_) {
+        if (layer.kernel == DenseKernel::Dot && precision != WeightPrecision::Float32) {
+            // Single-unit layers have no 16-bit kernel
+            NeuralNetwork::set_weight_precision(precision);
+        }
+    }
+    if (zero_params_) {
+        // Nothing set or bound yet: zeros re-layout as zeros, without the
+        // unpack / repack pass (load_zetic_model() binds right after this)
+        precision_ = precision;
+        layout_parameters();
+        float* unused = nullptr;
+        params_ = WeightBlock::allocate(native_count_, unused);
+        return;
+    }
+    const std::vector<float> parameters = get_parameters();
+    precision_ = precision;
+    layout_parameters();
+    bind_parameters(pack_parameters(Span<const float>(parameters)));
+}
+
+// ---------------------------------------------------------------------------
+// GraphModel: metadata
+
+std::unique_ptr<NeuralNetwork> GraphModel::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<GraphModel>(*this);
+}
+
+size_t GraphModel::input_size() const {
+    return graph_.input_size();
+}
+
+size_t GraphModel::output_size() const {
+    return graph_.output_size();
+}
+
+std::string GraphModel::get_model_type() const {
+    return "Layer Graph (" + std::to_string(dense_.size()) + " dense layers)";
+}
+
+std::string GraphModel::type_name() const {
+    return "graph";
+}
+
+std::vector<size_t> GraphModel::dimensions() const {
+    return {input_size(), output_size()};
+}
+
+} // namespace ZeticML
@@ -0,0 +1,252 @@
+/**
+ * ZeticML Assignment - Layer Graph Engine
+ * Generic DAG of dense layers and activations with a planning pass
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include "gemm.h"
+#include "sparse_input.h"
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+enum class LayerOp {
+    Input,
+    Dense,
+    Relu,
+    Sigmoid,
+    Softmax,
+    Add,
+    Concat
+};
+
+/**
+ * Storage and kernel of a Dense layer's weights
+ * Auto lets the planner choose: Dot for a single unit, Rows when the layer
+ * feeds a softmax (wide classifier heads), Panels otherwise.
+ */
+enum class DenseKernel {
+    Auto,
+    Dot,      // One unit: [weights(in)][bias], a dot product per row
+    Rows,     // [units x round_up_to_simd(in)] padded rows, then [units] biases; class-blocked matvec
+    Panels    // GEMM panels for [in x units], then biases padded to 16 floats
+};
+
+// Order of a Dense layer's weights in the public parameter vector
+enum class WeightOrder {
+    InputMajor,   // W[i * units + o]
+    OutputMajor   // W[o * inputs + i]
+};
+
+// Tensor 0 is the graph input; node k produces tensor k
+using TensorId = size_t;
+
+struct LayerNode {
+    LayerOp op = LayerOp::Input;
+    std::vector<TensorId> inputs;
+    size_t width = 0;                           // Features per row of the produced tensor
+    DenseKernel kernel = DenseKernel::Auto;     // Dense only
+    WeightOrder order = WeightOrder::InputMajor; // Dense only
+};
+
+/**
+ * Layer graph description
+ * Built in topological order: every call appends one node and returns the
+ * tensor it produces. The graph output is the last node added unless
+ * set_output() picks another tensor. Each Dense layer contributes [W, b] to
+ * the public parameter vector, in node order.
+ */
+class LayerGraph {
+public:
+    explicit LayerGraph(size_t input_size);
+
+    TensorId input() const { return 0; }
+    TensorId dense(TensorId x, size_t units, WeightOrder order = WeightOrder::InputMajor,
+                   DenseKernel kernel = DenseKernel::Auto);
+    TensorId relu(TensorId x);
+    TensorId sigmoid(TensorId x);
+    TensorId softmax(TensorId x);
+    TensorId add(TensorId a, TensorId b);
+    TensorId concat(const std::vector<TensorId>& parts);
+    void set_output(TensorId tensor);
+
+    const std::vector<LayerNode>& nodes() const { return nodes_; }
+    const LayerNode& node(TensorId tensor) const { return nodes_.at(tensor); }
+    TensorId output() const { return output_; }
+    size_t input_size() const { return nodes_[0].width; }
+    size_t output_size() const { return nodes_[output_].width; }
+
+    // Floats in the public parameter vector
+    size_t parameter_count() const;
+
+private:
+    TensorId append(LayerNode node);
+    void check(TensorId tensor) const;
+
+    std::vector<LayerNode> nodes_;
+    TensorId output_ = 0;
+    bool output_fixed_ = false;
+};
+
+/**
+ * Model executing a LayerGraph
+ *
+ * The planning pass (run once at construction) resolves Auto kernels, fuses
+ * each activation into the Dense layer producing its only input, runs
+ * single-consumer activations and adds in place, lets the producers of a
+ * Concat write straight into their column slice, and maps the graph output
+ * onto the caller's buffer.
+ *
+ * Fused activations never take an extra pass over memory: Panels layers
+ * apply ReLU / sigmoid to the GEMM accumulators before the store, and Rows
+ * layers apply them to each block of logits while it is in L1. A fused
+ * softmax folds every block into an online (max, sum) per row and
+ * normalizes once at the end.
+ *
+ * Memory plan: every remaining intermediate tensor gets an offset in one
+ * activation arena. Offsets come from the tensors' lifetimes over the step
+ * sequence; tensors that are never live at the same time share memory.
+ * The arena is sized at construction for a tile of up to 64 rows and taken
+ * from the context's workspace in a single block, so inference allocates
+ * nothing once the workspace has grown (or after prepare()). Batches run
+ * tile by tile so intermediates stay cache resident.
+ *
+ * Native layout: the Dense layers in node order, each section starting on a
+ * 16-float boundary (see DenseKernel). With fp16 / bf16 storage the Rows and
+ * Panels weight sections hold 16-bit values; biases stay fp32. Graphs with a
+ * Dot layer store fp32 only.
+ */
+class GraphModel : public NeuralNetwork {
+public:
+    explicit GraphModel(LayerGraph graph);
+
+    const LayerGraph& graph() const { return graph_; }
+
+    // Execution steps after planning, one line each (e.g. "dense[panels]+relu 8->64")
+    std::string plan_summary() const;
+    size_t num_steps() const { return steps_.size(); }
+
+    // Floats per tile row of the activation arena, and what the intermediate
+    // tensors would take without lifetime-based reuse
+    size_t arena_floats_per_row() const { return workspace_width_; }
+    size_t tensor_floats_per_row() const { return tensor_width_; }
+
+    size_t workspace_size(size_t batch_size) const override;
+
+    // Implementation of NeuralNetwork interface
+    std::unique_ptr<NeuralNetwork> clone() const override;
+    WeightBlock pack_parameters(Span<const float> parameters) const override;
+    WeightBlock adopt_parameters(WeightBlock parameters) const override;
+    void bind_parameters(WeightBlock block) override;
+    const WeightBlock& parameter_block() const override;
+    std::vector<float> get_parameters() const override;
+    WeightPrecision weight_precision() const override;
+    void set_weight_precision(WeightPrecision precision) override;
+    size_t input_size() const override;
+    size_t output_size() const override;
+    std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+protected:
+    void run(const float* input, float* output, InferenceContext& context) const override;
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   InferenceContext& context) const override;
+
+    /**
+     * Direct access to a Rows-kernel Dense layer (index among the Dense
+     * layers, in node order) for presets with their own output modes:
+     * classes per block that keeps the block's weights in L2, and the logits
+     * of classes [c0, c0 + count) for one input row, bias added
+     */
+    size_t class_block(size_t dense_index) const { return class_block(dense_[dense_index]); }
+    void row_logits(size_t dense_index, const float* x, size_t c0, size_t count, float* out) const {
+        row_logits(dense_[dense_index], x, c0, count, out);
+    }
+
+    // Where that layer's weight rows sit in the parameter block: row r is
+    // the row_bytes bytes at data + r * row_bytes (padding included)
+    struct WeightRows {
+        const unsigned char* data = nullptr;
+        size_t row_bytes = 0;
+        size_t rows = 0;
+    };
+    WeightRows weight_rows(size_t dense_index) const;
+
+    /**
+     * Sparse inputs for graphs whose first Dense layer is a Dot layer on the
+     * input: bias + w . x over the non-zeros only (the activation is left to
+     * the preset). Indices are validated; cost is proportional to nnz.
+     */
+    float sparse_logit(const SparseVector& input) const;
+    void sparse_logits(const CsrMatrix& batch, float* output) const;
+
+private:
+    struct DenseLayer {
+        size_t inputs = 0;
+        size_t units = 0;
+        DenseKernel kernel = DenseKernel::Dot;
+        WeightOrder order = WeightOrder::InputMajor;
+        size_t stride = 0;          // Rows: padded row length
+        size_t weights = 0;         // Section offsets (floats) in the native block
+        size_t bias = 0;
+        size_t public_offset = 0;   // Start of [W, b] in the public vector
+    };
+
+    // Where a tensor lives: a region and the column of its first feature
+    struct TensorRef {
+        size_t region = 0;
+        size_t column = 0;
+    };
+
+    struct Step {
+        LayerOp op = LayerOp::Input;
+        size_t dense = 0;                       // Dense: index into dense_
+        LayerOp activation = LayerOp::Input;    // Dense: fused activation (Input = none)
+        std::vector<TensorId> inputs;
+        TensorId output = 0;
+    };
+
+    // Arena region: [tile rows x width] floats at tile_rows * offset
+    struct Region {
+        size_t offset = 0;
+        size_t width = 0;
+    };
+
+    static constexpr size_t kInputRegion = static_cast<size_t>(-1);
+    static constexpr size_t kOutputRegion = static_cast<size_t>(-2);
+
+    void plan();
+    void plan_memory();
+    void layout_parameters();
+    void execute(const float* input, size_t batch_size, float* output, Workspace& workspace) const;
+    void run_dense(const DenseLayer& layer, LayerOp activation, const float* x, size_t ldx,
+                   size_t rows, float* y, size_t ldy) const;
+    std::string step_summary(const Step& step) const;
+    size_t class_block(const DenseLayer& layer) const;
+    void row_logits(const DenseLayer& layer, const float* x, size_t c0, size_t count,
+                    float* out) const;
+
+    LayerGraph graph_;
+    std::vector<DenseLayer> dense_;
+    std::vector<Step> steps_;
+    std::vector<TensorRef> refs_;       // Per tensor
+    std::vector<Region> regions_;
+    size_t workspace_width_ = 0;        // Floats per tile row of the arena
+    size_t tensor_width_ = 0;           // Sum of region widths
+    size_t native_count_ = 0;
+    bool native_is_public_ = false;
+    WeightPrecision precision_ = WeightPrecision::Float32;
+    WeightBlock params_;
+    bool zero_params_ = true;           // Still the constructor's zero block
+
+#if ZETIC_ENABLE_INSTRUMENTATION
+    uint32_t step_scope(size_t step) const;
+    std::vector<LazyScope> step_scopes_;    // Per step, named "<model>/<step>:<summary>"
+#endif
+};
+
+} // namespace ZeticML
@@ -0,0 +1,126 @@
+/**
+ * ZeticML Assignment - 16-bit Weight Storage Implementation
+ */
+
+#include "half_precision.h"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+uint32_t float_bits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bits_float(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+const char* precision_name(WeightPrecision precision) {
+    switch (precision) {
+        case WeightPrecision::Float32:  return "fp32";
+        case WeightPrecision::Float16:  return "fp16";
+        case WeightPrecision::BFloat16: return "bf16";
+    }
+    return "unknown";
+}
+
+size_t precision_bytes(WeightPrecision precision) {
+    return precision == WeightPrecision::Float32 ? 4 : 2;
+}
+
+uint16_t float_to_half(float value) {
+    uint32_t x = float_bits(value);
+    const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000);
+    x &= 0x7FFFFFFF;
+
+    if (x >= 0x7F800000) {
+        return sign | (x > 0x7F800000 ? 0x7E00 : 0x7C00);     // NaN (quiet) / Inf
+    }
+    if (x >= 0x477FF000) {
+        return sign | 0x7C00;                                   // Rounds past 65504
+    }
+    if (x < 0x38800000) {
+        // Subnormal half: multiples of 2^-24; the scaling is exact and
+        // nearbyint rounds to nearest even
+        return sign | static_cast<uint16_t>(std::nearbyint(bits_float(x) * 16777216.0f));
+    }
+
+    // Normal: rebias the exponent, round the 13 dropped mantissa bits to even
+    x += 0xC8000FFF + ((x >> 13) & 1);     // (15 - 127) << 23, plus rounding
+    return sign | static_cast<uint16_t>(x >> 13);
+}
+
+float half_to_float(uint16_t bits) {
+    const uint32_t sign = static_cast<uint32_t>(bits & 0x8000) << 16;
+    uint32_t exponent = (bits >> 10) & 0x1F;
+    uint32_t mantissa = bits & 0x3FF;
+
+    if (exponent == 0x1F) {
+        return bits_float(sign | 0x7F800000 | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            return bits_float(sign);
+        }
+        // Subnormal: normalize into an fp32 exponent
+        exponent = 113;
+        while ((mantissa & 0x400) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        return bits_float(sign | (exponent << 23) | ((mantissa & 0x3FF) << 13));
+    }
+    return bits_float(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+uint16_t float_to_bfloat16(float value) {
+    const uint32_t x = float_bits(value);
+    if ((x & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>((x >> 16) | 0x40);        // Keep NaN quiet
+    }
+    return static_cast<uint16_t>((x + 0x7FFF + ((x >> 16) & 1)) >> 16);
+}
+
+float bfloat16_to_float(uint16_t bits) {
+    return bits_float(static_cast<uint32_t>(bits) << 16);
+}
+
+void narrow_weights(const float* src, size_t n, WeightPrecision precision, uint16_t* dst) {
+    if (precision == WeightPrecision::Float16) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = float_to_half(src[i]);
+        }
+    } else if (precision == WeightPrecision::BFloat16) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = float_to_bfloat16(src[i]);
+        }
+    } else {
+        throw std::invalid_argument("narrow_weights needs a 16-bit precision");
+    }
+}
+
+void widen_weights(const uint16_t* src, size_t n, WeightPrecision precision, float* dst) {
+    if (precision == WeightPrecision::Float16) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = half_to_float(src[i]);
+        }
+    } else if (precision == WeightPrecision::BFloat16) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = bfloat16_to_float(src[i]);
+        }
+    } else {
+        throw std::invalid_argument("widen_weights needs a 16-bit precision");
+    }
+}
+
+} // namespace ZeticML
@@ -0,0 +1,44 @@
+/**
+ * ZeticML Assignment - 16-bit Weight Storage
+ * IEEE fp16 / bfloat16 formats and their conversions to and from fp32
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ZeticML {
+
+/**
+ * Precision a model keeps its weights in
+ * Float16 and BFloat16 halve weight memory; kernels widen the values to fp32
+ * in registers, so all arithmetic (and every bias) stays fp32. Float16 keeps
+ * more mantissa (10 bits, range +-65504), BFloat16 keeps fp32's exponent
+ * range with 7 mantissa bits.
+ */
+enum class WeightPrecision {
+    Float32,
+    Float16,
+    BFloat16
+};
+
+// "fp32", "fp16", "bf16"
+const char* precision_name(WeightPrecision precision);
+
+// Bytes per stored weight
+size_t precision_bytes(WeightPrecision precision);
+
+// Scalar conversions; narrowing rounds to nearest even and keeps NaN / Inf
+uint16_t float_to_half(float value);
+float half_to_float(uint16_t bits);
+uint16_t float_to_bfloat16(float value);
+float bfloat16_to_float(uint16_t bits);
+
+// Narrow n floats into 16-bit storage (precision must not be Float32)
+void narrow_weights(const float* src, size_t n, WeightPrecision precision, uint16_t* dst);
+
+// Widen n stored 16-bit weights back to fp32
+void widen_weights(const uint16_t* src, size_t n, WeightPrecision precision, float* dst);
+
+} // namespace ZeticML
@@ -0,0 +1,178 @@
+/**
+ * ZeticML Assignment - Value Histogram
+ * HDR-style log-linear histogram for serving metrics and latency profiles
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ZeticML {
+
+/**
+ * Histogram of non-negative integer samples (batch sizes, queue depths,
+ * nanoseconds). Values below 16 get one bucket each; above that every
+ * power-of-two range [2^e, 2^(e+1)) is split into 8 linear sub-buckets, so
+ * any recorded value is resolved to within 12.5% (HdrHistogram with 3
+ * significant bits) over the full 64-bit range in 496 buckets.
+ * Count, min, max and mean are exact; percentiles are resolved to a
+ * bucket's upper bound (clamped to the observed range). Not thread-safe:
+ * owners record under their own lock and hand out copies, or record into
+ * per-thread AtomicHistograms and merge them when read.
+ */
+class Histogram {
+public:
+    static constexpr size_t kSubBucketBits = 3;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits;
+    static constexpr size_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    void record(uint64_t value) {
+        ++buckets_[bucket_index(value)];
+        ++count_;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    // Add another histogram's samples to this one
+    void merge(const Histogram& other) {
+        for (size_t b = 0; b < kBuckets; ++b) {
+            buckets_[b] += other.buckets_[b];
+        }
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t sum() const { return sum_; }
+    uint64_t min() const { return count_ == 0 ? 0 : min_; }
+    uint64_t max() const { return max_; }
+    double mean() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_) / count_; }
+
+    // Smallest bucket bound covering `fraction` (0..1) of the samples
+    uint64_t percentile(double fraction) const {
+        if (count_ == 0) {
+            return 0;
+        }
+        const double clamped = std::min(std::max(fraction, 0.0), 1.0);
+        const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(clamped * count_ + 0.5));
+        uint64_t seen = 0;
+        for (size_t b = 0; b < kBuckets; ++b) {
+            seen += buckets_[b];
+            if (seen >= target) {
+                return std::max(min(), std::min(max_, bucket_upper_bound(b)));
+            }
+        }
+        return max_;
+    }
+
+    uint64_t bucket_count(size_t bucket) const { return buckets_[bucket]; }
+
+    // Smallest and largest values that fall into `bucket`
+    static uint64_t bucket_lower_bound(size_t bucket) {
+        const size_t shift = bucket_shift(bucket);
+        return static_cast<uint64_t>(bucket - shift * kSubBuckets) << shift;
+    }
+
+    static uint64_t bucket_upper_bound(size_t bucket) {
+        return bucket_lower_bound(bucket) + ((uint64_t(1) << bucket_shift(bucket)) - 1);
+    }
+
+    // index = shift * 8 + (value >> shift) with shift = max(0, log2(value) - 3)
+    static size_t bucket_index(uint64_t value) {
+        const size_t log2 = value == 0 ? 0 : highest_bit(value);
+        const size_t shift = log2 > kSubBucketBits ? log2 - kSubBucketBits : 0;
+        return shift * kSubBuckets + static_cast<size_t>(value >> shift);
+    }
+
+    void reset() { *this = Histogram(); }
+
+private:
+    friend class AtomicHistogram;
+
+    static size_t bucket_shift(size_t bucket) {
+        const size_t octave = bucket / kSubBuckets;
+        return octave > 0 ? octave - 1 : 0;
+    }
+
+    static size_t highest_bit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - static_cast<size_t>(__builtin_clzll(value));
+#else
+        size_t bit = 0;
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    std::array<uint64_t, kBuckets> buckets_{};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t min_ = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ = 0;
+};
+
+/**
+ * Single-writer Histogram for lock-free per-thread recording
+ * One thread calls record(); any thread may call merge_into() concurrently
+ * and sees a consistent-enough view (each field is read atomically, the
+ * fields together are not a snapshot). Every update is a relaxed load and
+ * store, so recording costs no read-modify-write or fence.
+ */
+class AtomicHistogram {
+public:
+    void record(uint64_t value) {
+        bump(buckets_[Histogram::bucket_index(value)], 1);
+        bump(count_, 1);
+        bump(sum_, value);
+        if (value < min_.load(std::memory_order_relaxed)) {
+            min_.store(value, std::memory_order_relaxed);
+        }
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void merge_into(Histogram& out) const {
+        for (size_t b = 0; b < Histogram::kBuckets; ++b) {
+            out.buckets_[b] += buckets_[b].load(std::memory_order_relaxed);
+        }
+        out.count_ += count_.load(std::memory_order_relaxed);
+        out.sum_ += sum_.load(std::memory_order_relaxed);
+        out.min_ = std::min(out.min_, min_.load(std::memory_order_relaxed));
+        out.max_ = std::max(out.max_, max_.load(std::memory_order_relaxed));
+    }
+
+    // Not safe against a concurrent record(); for quiescent resets
+    void reset() {
+        for (auto& b : buckets_) {
+            b.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, Histogram::kBuckets> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace ZeticML
@@ -0,0 +1,43 @@
+/**
+ * ZeticML Assignment - Per-Thread Inference Context
+ * Mutable scratch state kept apart from the immutable, shareable model
+ */
+
+#pragma once
+
+#include "workspace.h"
+
+namespace ZeticML {
+
+/**
+ * Scratch memory for one in-flight inference
+ * Models are immutable once parameters are bound, so a single instance can
+ * serve many threads at once as long as each thread brings its own context.
+ * Contexts are cheap to create, grow on first use and are not thread-safe
+ * themselves: use one per thread (or per concurrent request).
+ */
+class InferenceContext {
+private:
+    Workspace workspace_;
+
+public:
+    InferenceContext() = default;
+
+    InferenceContext(const InferenceContext&) = delete;
+    InferenceContext& operator=(const InferenceContext&) = delete;
+    InferenceContext(InferenceContext&&) = default;
+    InferenceContext& operator=(InferenceContext&&) = default;
+
+    Workspace& workspace() { return workspace_; }
+
+    // Drop all scratch memory (it is reacquired on next use)
+    void release() { workspace_.release(); }
+
+    // Context used by the overloads that take none; one per thread
+    static InferenceContext& thread_default() {
+        thread_local InferenceContext context;
+        return context;
+    }
+};
+
+} // namespace ZeticML
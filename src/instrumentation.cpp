@@ -0,0 +1,152 @@
+/**
+ * ZeticML Assignment - Hot-Path Instrumentation
+ * Stats sink shards, registration and merging
+ */
+
+#include "instrumentation.h"
+#include <sstream>
+
+namespace ZeticML {
+
+namespace {
+
+// Overflow slot for scopes registered past kMaxScopes
+constexpr uint32_t kOverflowScope = StatsSink::kMaxScopes;
+
+} // namespace
+
+std::string ScopeStats::to_string() const {
+    std::ostringstream out;
+    out << name << ": " << calls << " calls, " << samples << " samples, " << bytes << " bytes"
+        << ", latency ns mean " << static_cast<uint64_t>(latency_ns.mean())
+        << " p50 " << latency_ns.percentile(0.5)
+        << " p99 " << latency_ns.percentile(0.99)
+        << " max " << latency_ns.max()
+        << ", batch mean " << batch_size.mean();
+    return out.str();
+}
+
+StatsSink::Shard::~Shard() {
+    for (auto& slot : slots) {
+        delete slot.load(std::memory_order_relaxed);
+    }
+}
+
+StatsSink& StatsSink::global() {
+    // Leaked on purpose: threads may still record during static destruction
+    static StatsSink* sink = new StatsSink();
+    return *sink;
+}
+
+uint32_t StatsSink::scope_id(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (names_[i] == name) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    if (names_.size() >= kMaxScopes) {
+        return kOverflowScope;
+    }
+    names_.push_back(name);
+    return static_cast<uint32_t>(names_.size() - 1);
+}
+
+StatsSink::Shard& StatsSink::local_shard() {
+    thread_local Shard* shard = nullptr;
+    if (shard == nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shards_.push_back(std::make_unique<Shard>());
+        shard = shards_.back().get();
+    }
+    return *shard;
+}
+
+void StatsSink::record(uint32_t scope, uint64_t latency_ns, uint64_t samples, uint64_t bytes) {
+    if (scope > kOverflowScope) {
+        scope = kOverflowScope;
+    }
+    std::atomic<Counters*>& slot = local_shard().slots[scope];
+    Counters* counters = slot.load(std::memory_order_relaxed);
+    if (counters == nullptr) {
+        counters = new Counters();
+        slot.store(counters, std::memory_order_release);
+    }
+    auto bump = [](std::atomic<uint64_t>& counter, uint64_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    };
+    bump(counters->calls, 1);
+    bump(counters->samples, samples);
+    bump(counters->bytes, bytes);
+    counters->latency_ns.record(latency_ns);
+    counters->batch_size.record(samples);
+}
+
+ScopeStats StatsSink::merge(uint32_t scope) const {
+    ScopeStats stats;
+    stats.name = scope < names_.size() ? names_[scope] : "(overflow)";
+    for (const auto& shard : shards_) {
+        const Counters* counters = shard->slots[scope].load(std::memory_order_acquire);
+        if (counters == nullptr) {
+            continue;
+        }
+        stats.calls += counters->calls.load(std::memory_order_relaxed);
+        stats.samples += counters->samples.load(std::memory_order_relaxed);
+        stats.bytes += counters->bytes.load(std::memory_order_relaxed);
+        counters->latency_ns.merge_into(stats.latency_ns);
+        counters->batch_size.merge_into(stats.batch_size);
+    }
+    return stats;
+}
+
+ScopeStats StatsSink::stats(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (names_[i] == name) {
+            return merge(static_cast<uint32_t>(i));
+        }
+    }
+    ScopeStats empty;
+    empty.name = name;
+    return empty;
+}
+
+std::vector<ScopeStats> StatsSink::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<ScopeStats> result;
+    for (uint32_t i = 0; i <= kOverflowScope; ++i) {
+        if (i >= names_.size() && i != kOverflowScope) {
+            continue;
+        }
+        ScopeStats stats = merge(i);
+        if (stats.calls > 0) {
+            result.push_back(std::move(stats));
+        }
+    }
+    return result;
+}
+
+std::string StatsSink::report() const {
+    std::string text;
+    for (const ScopeStats& stats : snapshot()) {
+        text += stats.to_string() + "\n";
+    }
+    return text;
+}
+
+void StatsSink::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& shard : shards_) {
+        for (auto& slot : shard->slots) {
+            if (Counters* counters = slot.load(std::memory_order_acquire)) {
+                counters->calls.store(0, std::memory_order_relaxed);
+                counters->samples.store(0, std::memory_order_relaxed);
+                counters->bytes.store(0, std::memory_order_relaxed);
+                counters->latency_ns.reset();
+                counters->batch_size.reset();
+            }
+        }
+    }
+}
+
+} // namespace ZeticML
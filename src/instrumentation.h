@@ -0,0 +1,169 @@
+/**
+ * ZeticML Assignment - Hot-Path Instrumentation
+ * Per-model and per-layer call counts, latency histograms and throughput
+ *
+ * Build with -DZETIC_INSTRUMENTATION=ON (ZETIC_ENABLE_INSTRUMENTATION=1) to
+ * record every forward_into() / forward_batch() call and every GraphModel
+ * step into the global StatsSink. Without it the ZETIC_INSTRUMENT_SCOPE
+ * hooks expand to nothing and models carry no extra members, so the
+ * inference path is exactly the uninstrumented one. The flag changes class
+ * layouts: every translation unit of a program must agree on it.
+ */
+
+#pragma once
+
+#include "histogram.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef ZETIC_ENABLE_INSTRUMENTATION
+#define ZETIC_ENABLE_INSTRUMENTATION 0
+#endif
+
+namespace ZeticML {
+
+// Merged view of one instrumented scope (a model or one of its layers)
+struct ScopeStats {
+    std::string name;
+    uint64_t calls = 0;
+    uint64_t samples = 0;           // Rows processed
+    uint64_t bytes = 0;             // Input + output bytes processed
+    Histogram latency_ns;           // Per call
+    Histogram batch_size;           // Rows per call
+
+    std::string to_string() const;
+};
+
+/**
+ * Process-wide sink for instrumented scopes
+ * Scopes are registered by name once (under a lock) and recorded by id.
+ * Each thread records into its own shard with relaxed single-writer
+ * atomics, so record() takes no lock and shares no cache line with other
+ * threads; stats() / snapshot() merge all shards when read. Shards of
+ * finished threads are kept, so no samples are lost.
+ */
+class StatsSink {
+public:
+    static constexpr uint32_t kMaxScopes = 1024;
+
+    // Whether the library's own hooks are compiled in
+    static constexpr bool enabled() { return ZETIC_ENABLE_INSTRUMENTATION != 0; }
+
+    static StatsSink& global();
+
+    // Id of a named scope; scopes past kMaxScopes share an overflow scope
+    uint32_t scope_id(const std::string& name);
+
+    // Lock-free; safe from any thread
+    void record(uint32_t scope, uint64_t latency_ns, uint64_t samples, uint64_t bytes);
+
+    // Merged statistics of one scope (zero calls if never recorded)
+    ScopeStats stats(const std::string& name) const;
+
+    // All scopes with at least one call, in registration order
+    std::vector<ScopeStats> snapshot() const;
+
+    // One ScopeStats::to_string() line per recorded scope
+    std::string report() const;
+
+    // Zero every counter; samples recorded concurrently may be lost
+    void reset();
+
+    StatsSink(const StatsSink&) = delete;
+    StatsSink& operator=(const StatsSink&) = delete;
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> bytes{0};
+        AtomicHistogram latency_ns;
+        AtomicHistogram batch_size;
+    };
+
+    // One thread's counters; slots are created by the owner and published
+    // with a release store
+    struct Shard {
+        std::array<std::atomic<Counters*>, kMaxScopes + 1> slots{};
+        ~Shard();
+    };
+
+    StatsSink() = default;
+    Shard& local_shard();
+    ScopeStats merge(uint32_t scope) const;
+
+    mutable std::mutex mutex_;
+    std::vector<std::string> names_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+/**
+ * Scope id resolved on first use and cached; copies keep the id
+ * (models hold one per instrumented scope when instrumentation is on)
+ */
+class LazyScope {
+public:
+    LazyScope() = default;
+    LazyScope(const LazyScope& other) : id_(other.id_.load(std::memory_order_relaxed)) {}
+    LazyScope& operator=(const LazyScope& other) {
+        id_.store(other.id_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    template <class NameFn>
+    uint32_t get(NameFn&& name) const {
+        uint32_t id = id_.load(std::memory_order_relaxed);
+        if (id == kUnassigned) {
+            id = StatsSink::global().scope_id(name());
+            id_.store(id, std::memory_order_relaxed);
+        }
+        return id;
+    }
+
+    // Forget the id, e.g. after the scope's name changed
+    void clear() { id_.store(kUnassigned, std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t kUnassigned = UINT32_MAX;
+    mutable std::atomic<uint32_t> id_{kUnassigned};
+};
+
+// Times its own lifetime and records it into a scope
+class ScopedRecord {
+public:
+    ScopedRecord(uint32_t scope, uint64_t samples, uint64_t bytes)
+        : scope_(scope), samples_(samples), bytes_(bytes), start_(std::chrono::steady_clock::now()) {}
+
+    ~ScopedRecord() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        StatsSink::global().record(
+            scope_, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            samples_, bytes_);
+    }
+
+    ScopedRecord(const ScopedRecord&) = delete;
+    ScopedRecord& operator=(const ScopedRecord&) = delete;
+
+private:
+    uint32_t scope_;
+    uint64_t samples_;
+    uint64_t bytes_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace ZeticML
+
+// ZETIC_INSTRUMENT_SCOPE(var, scope_id, samples, bytes): record the rest of
+// the enclosing block; the arguments are not evaluated when disabled
+#if ZETIC_ENABLE_INSTRUMENTATION
+#define ZETIC_INSTRUMENT_SCOPE(var, scope, samples, bytes) \
+    const ::ZeticML::ScopedRecord var((scope), (samples), (bytes))
+#else
+#define ZETIC_INSTRUMENT_SCOPE(var, scope, samples, bytes) ((void)0)
+#endif
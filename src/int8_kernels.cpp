@@ -0,0 +1,74 @@
+/**
+ * ZeticML Assignment - INT8 Kernel Dispatch
+ */
+
+#include "int8_kernels.h"
+#include "cpu_features.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace ZeticML {
+
+namespace {
+
+bool cpu_supports(Int8KernelIsa isa) {
+    const CpuFeatures& f = cpu_features();
+    switch (isa) {
+        case Int8KernelIsa::Scalar:      return true;
+        case Int8KernelIsa::AVX2:        return f.avx2;
+        case Int8KernelIsa::AVXVNNI:     return f.avx2 && f.avxvnni;
+        case Int8KernelIsa::AVX512VNNI:  return f.avx512f && f.avx512bw && f.avx512vnni;
+        case Int8KernelIsa::NEON:        return f.neon;
+        case Int8KernelIsa::NEONDotProd: return f.neon && f.dotprod;
+    }
+    return false;
+}
+
+const Int8KernelTable* compiled_table(Int8KernelIsa isa) {
+    switch (isa) {
+        case Int8KernelIsa::Scalar:      return detail::int8_kernels_scalar();
+        case Int8KernelIsa::AVX2:        return detail::int8_kernels_avx2();
+        case Int8KernelIsa::AVXVNNI:     return detail::int8_kernels_avxvnni();
+        case Int8KernelIsa::AVX512VNNI:  return detail::int8_kernels_avx512vnni();
+        case Int8KernelIsa::NEON:        return detail::int8_kernels_neon();
+        case Int8KernelIsa::NEONDotProd: return detail::int8_kernels_neon_dotprod();
+    }
+    return nullptr;
+}
+
+const Int8KernelTable* select_table() {
+    auto tables = available_int8_kernel_tables();
+
+    if (const char* forced = std::getenv("ZETIC_KERNEL_ISA")) {
+        for (const Int8KernelTable* table : tables) {
+            if (std::strcmp(table->name, forced) == 0) {
+                return table;
+            }
+        }
+    }
+    return tables.front();
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernel_table(Int8KernelIsa isa) {
+    return cpu_supports(isa) ? compiled_table(isa) : nullptr;
+}
+
+std::vector<const Int8KernelTable*> available_int8_kernel_tables() {
+    std::vector<const Int8KernelTable*> tables;
+    for (Int8KernelIsa isa : {Int8KernelIsa::AVX512VNNI, Int8KernelIsa::AVXVNNI, Int8KernelIsa::AVX2,
+                              Int8KernelIsa::NEONDotProd, Int8KernelIsa::NEON, Int8KernelIsa::Scalar}) {
+        if (const Int8KernelTable* table = int8_kernel_table(isa)) {
+            tables.push_back(table);
+        }
+    }
+    return tables;
+}
+
+const Int8KernelTable& int8_kernels() {
+    static const Int8KernelTable* selected = select_table();
+    return *selected;
+}
+
+} // namespace ZeticML
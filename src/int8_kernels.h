@@ -0,0 +1,76 @@
+/**
+ * ZeticML Assignment - Runtime-Dispatched INT8 Kernels
+ * Signed 8-bit dot products with 32-bit accumulation
+ *
+ * Same scheme as kernels.h: every variant lives in its own translation unit
+ * (int8_kernels_<isa>.cpp) built with that ISA's flags and is picked at run
+ * time. Variants use the widest int8 dot-product instruction available:
+ * VPDPBUSD (AVX-512 VNNI / AVX-VNNI), SDOT (Armv8.2 DotProd), or widening
+ * multiply-adds on plain AVX2 / NEON.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ZeticML {
+
+// Row strides and vector lengths handed to the int8 kernels are multiples of
+// this many elements (zero-padded), so kernels never need a scalar tail
+constexpr size_t kInt8Block = 64;
+
+inline size_t round_up_to_int8_block(size_t n) {
+    return (n + kInt8Block - 1) / kInt8Block * kInt8Block;
+}
+
+enum class Int8KernelIsa {
+    Scalar,
+    AVX2,
+    AVXVNNI,
+    AVX512VNNI,
+    NEON,
+    NEONDotProd
+};
+
+/**
+ * Quantized values are symmetric and restricted to [-127, 127] (never -128),
+ * which keeps the sign-transfer tricks used by the x86 variants exact.
+ */
+struct Int8KernelTable {
+    Int8KernelIsa isa;
+    const char* name;
+
+    // out[r] = sum_k W[r * stride + k] * x[k] for k < n; n is a multiple of
+    // kInt8Block and rows may be zero. Pointers may be unaligned.
+    void (*matvec)(const int8_t* W, size_t stride, size_t rows,
+                   const int8_t* x, size_t n, int32_t* out);
+};
+
+/**
+ * INT8 table for the running CPU
+ * Chosen on first use: the best variant the CPU supports, unless
+ * ZETIC_KERNEL_ISA names an available int8 variant (scalar, avx2, avx-vnni,
+ * avx512-vnni, neon, neon-dotprod).
+ */
+const Int8KernelTable& int8_kernels();
+
+// Table for a specific variant, or nullptr if not compiled in / unsupported
+const Int8KernelTable* int8_kernel_table(Int8KernelIsa isa);
+
+// All variants usable on this CPU, best first (always ends with Scalar)
+std::vector<const Int8KernelTable*> available_int8_kernel_tables();
+
+namespace detail {
+
+const Int8KernelTable* int8_kernels_scalar();
+const Int8KernelTable* int8_kernels_avx2();
+const Int8KernelTable* int8_kernels_avxvnni();
+const Int8KernelTable* int8_kernels_avx512vnni();
+const Int8KernelTable* int8_kernels_neon();
+const Int8KernelTable* int8_kernels_neon_dotprod();
+
+} // namespace detail
+
+} // namespace ZeticML
@@ -0,0 +1,92 @@
+/**
+ * ZeticML Assignment - AVX2 INT8 Kernels
+ * VPMADDUBSW-based s8 x s8 dot products; built with -mavx2
+ */
+
+#include "int8_kernels.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// s8 x s8 via the unsigned x signed multiply-add: |x| * (w with x's sign).
+// With both operands in [-127, 127] a pair sum is at most 2 * 127 * 127,
+// so the saturating 16-bit step never saturates.
+inline __m256i dot_step(__m256i acc, __m256i x_abs, __m256i x, __m256i w, __m256i ones) {
+    const __m256i pairs = _mm256_maddubs_epi16(x_abs, _mm256_sign_epi8(w, x));
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, ones));
+}
+
+inline int32_t hsum_epi32(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+}
+
+void matvec_avx2(const int8_t* W, size_t stride, size_t rows,
+                 const int8_t* x, size_t n, int32_t* out) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    size_t r = 0;
+
+    // Four rows share each activation load
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t* w0 = W + r * stride;
+        const int8_t* w1 = w0 + stride;
+        const int8_t* w2 = w1 + stride;
+        const int8_t* w3 = w2 + stride;
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+        for (size_t k = 0; k < n; k += 32) {
+            const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + k));
+            const __m256i xa = _mm256_abs_epi8(xv);
+            acc0 = dot_step(acc0, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w0 + k)), ones);
+            acc1 = dot_step(acc1, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w1 + k)), ones);
+            acc2 = dot_step(acc2, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w2 + k)), ones);
+            acc3 = dot_step(acc3, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w3 + k)), ones);
+        }
+        out[r] = hsum_epi32(acc0);
+        out[r + 1] = hsum_epi32(acc1);
+        out[r + 2] = hsum_epi32(acc2);
+        out[r + 3] = hsum_epi32(acc3);
+    }
+
+    for (; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t k = 0; k < n; k += 32) {
+            const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + k));
+            acc = dot_step(acc, _mm256_abs_epi8(xv), xv,
+                           _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + k)), ones);
+        }
+        out[r] = hsum_epi32(acc);
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_avx2() {
+    static const Int8KernelTable table = {Int8KernelIsa::AVX2, "avx2", matvec_avx2};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const Int8KernelTable* int8_kernels_avx2() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
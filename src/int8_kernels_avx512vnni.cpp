@@ -0,0 +1,89 @@
+/**
+ * ZeticML Assignment - AVX-512 VNNI INT8 Kernels
+ * 512-bit VPDPBUSD; built with -mavx512f -mavx512bw -mavx512vnni
+ */
+
+#include "int8_kernels.h"
+
+#if (defined(__AVX512VNNI__) || defined(ZETIC_ENABLE_AVX512VNNI)) && defined(__AVX512BW__)
+
+#include <immintrin.h>
+
+// Same spurious GCC 12 warnings as kernels_avx512.cpp (GCC bug 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// One kInt8Block (64 bytes) per step. There is no VPSIGNB for ZMM, so the
+// weights take x's sign through a masked negate instead.
+inline __m512i dot_step(__m512i acc, __m512i x_abs, __mmask64 x_negative, __m512i w) {
+    const __m512i w_signed = _mm512_mask_sub_epi8(w, x_negative, _mm512_setzero_si512(), w);
+    return _mm512_dpbusd_epi32(acc, x_abs, w_signed);
+}
+
+void matvec_avx512vnni(const int8_t* W, size_t stride, size_t rows,
+                       const int8_t* x, size_t n, int32_t* out) {
+    size_t r = 0;
+
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t* w0 = W + r * stride;
+        const int8_t* w1 = w0 + stride;
+        const int8_t* w2 = w1 + stride;
+        const int8_t* w3 = w2 + stride;
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512();
+        __m512i acc2 = _mm512_setzero_si512(), acc3 = _mm512_setzero_si512();
+        for (size_t k = 0; k < n; k += 64) {
+            const __m512i xv = _mm512_loadu_si512(x + k);
+            const __m512i xa = _mm512_abs_epi8(xv);
+            const __mmask64 neg = _mm512_movepi8_mask(xv);
+            acc0 = dot_step(acc0, xa, neg, _mm512_loadu_si512(w0 + k));
+            acc1 = dot_step(acc1, xa, neg, _mm512_loadu_si512(w1 + k));
+            acc2 = dot_step(acc2, xa, neg, _mm512_loadu_si512(w2 + k));
+            acc3 = dot_step(acc3, xa, neg, _mm512_loadu_si512(w3 + k));
+        }
+        out[r] = _mm512_reduce_add_epi32(acc0);
+        out[r + 1] = _mm512_reduce_add_epi32(acc1);
+        out[r + 2] = _mm512_reduce_add_epi32(acc2);
+        out[r + 3] = _mm512_reduce_add_epi32(acc3);
+    }
+
+    for (; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        __m512i acc = _mm512_setzero_si512();
+        for (size_t k = 0; k < n; k += 64) {
+            const __m512i xv = _mm512_loadu_si512(x + k);
+            acc = dot_step(acc, _mm512_abs_epi8(xv), _mm512_movepi8_mask(xv),
+                           _mm512_loadu_si512(w + k));
+        }
+        out[r] = _mm512_reduce_add_epi32(acc);
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_avx512vnni() {
+    static const Int8KernelTable table = {Int8KernelIsa::AVX512VNNI, "avx512-vnni", matvec_avx512vnni};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const Int8KernelTable* int8_kernels_avx512vnni() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
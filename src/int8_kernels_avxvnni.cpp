@@ -0,0 +1,88 @@
+/**
+ * ZeticML Assignment - AVX-VNNI INT8 Kernels
+ * 256-bit VPDPBUSD (VEX encoding); built with -mavx2 -mavxvnni
+ */
+
+#include "int8_kernels.h"
+
+#if (defined(__AVXVNNI__) || defined(ZETIC_ENABLE_AVXVNNI)) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// VPDPBUSD multiplies unsigned by signed bytes; |x| and w carrying x's sign
+// give the signed product exactly and accumulate four of them per lane
+inline __m256i dot_step(__m256i acc, __m256i x_abs, __m256i x, __m256i w) {
+    return _mm256_dpbusd_avx_epi32(acc, x_abs, _mm256_sign_epi8(w, x));
+}
+
+inline int32_t hsum_epi32(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s);
+}
+
+void matvec_avxvnni(const int8_t* W, size_t stride, size_t rows,
+                    const int8_t* x, size_t n, int32_t* out) {
+    size_t r = 0;
+
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t* w0 = W + r * stride;
+        const int8_t* w1 = w0 + stride;
+        const int8_t* w2 = w1 + stride;
+        const int8_t* w3 = w2 + stride;
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+        for (size_t k = 0; k < n; k += 32) {
+            const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + k));
+            const __m256i xa = _mm256_abs_epi8(xv);
+            acc0 = dot_step(acc0, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w0 + k)));
+            acc1 = dot_step(acc1, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w1 + k)));
+            acc2 = dot_step(acc2, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w2 + k)));
+            acc3 = dot_step(acc3, xa, xv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w3 + k)));
+        }
+        out[r] = hsum_epi32(acc0);
+        out[r + 1] = hsum_epi32(acc1);
+        out[r + 2] = hsum_epi32(acc2);
+        out[r + 3] = hsum_epi32(acc3);
+    }
+
+    for (; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t k = 0; k < n; k += 32) {
+            const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + k));
+            acc = dot_step(acc, _mm256_abs_epi8(xv), xv,
+                           _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + k)));
+        }
+        out[r] = hsum_epi32(acc);
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_avxvnni() {
+    static const Int8KernelTable table = {Int8KernelIsa::AVXVNNI, "avx-vnni", matvec_avxvnni};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const Int8KernelTable* int8_kernels_avxvnni() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * ZeticML Assignment - NEON INT8 Kernels
+ * AArch64 widening multiply-accumulate (SMULL / SMLAL2 / SADALP)
+ */
+
+#include "int8_kernels.h"
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+#include <arm_neon.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// 16 products per step: two widening multiplies into int16 (at most
+// 2 * 127 * 127, no overflow), pairwise-accumulated into int32 lanes
+inline int32x4_t dot_step(int32x4_t acc, int8x16_t w, int8x16_t x) {
+    int16x8_t products = vmull_s8(vget_low_s8(w), vget_low_s8(x));
+    products = vmlal_high_s8(products, w, x);
+    return vpadalq_s16(acc, products);
+}
+
+void matvec_neon(const int8_t* W, size_t stride, size_t rows,
+                 const int8_t* x, size_t n, int32_t* out) {
+    size_t r = 0;
+
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t* w0 = W + r * stride;
+        const int8_t* w1 = w0 + stride;
+        const int8_t* w2 = w1 + stride;
+        const int8_t* w3 = w2 + stride;
+        int32x4_t acc0 = vdupq_n_s32(0), acc1 = vdupq_n_s32(0);
+        int32x4_t acc2 = vdupq_n_s32(0), acc3 = vdupq_n_s32(0);
+        for (size_t k = 0; k < n; k += 16) {
+            const int8x16_t xv = vld1q_s8(x + k);
+            acc0 = dot_step(acc0, vld1q_s8(w0 + k), xv);
+            acc1 = dot_step(acc1, vld1q_s8(w1 + k), xv);
+            acc2 = dot_step(acc2, vld1q_s8(w2 + k), xv);
+            acc3 = dot_step(acc3, vld1q_s8(w3 + k), xv);
+        }
+        out[r] = vaddvq_s32(acc0);
+        out[r + 1] = vaddvq_s32(acc1);
+        out[r + 2] = vaddvq_s32(acc2);
+        out[r + 3] = vaddvq_s32(acc3);
+    }
+
+    for (; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        int32x4_t acc = vdupq_n_s32(0);
+        for (size_t k = 0; k < n; k += 16) {
+            acc = dot_step(acc, vld1q_s8(w + k), vld1q_s8(x + k));
+        }
+        out[r] = vaddvq_s32(acc);
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_neon() {
+    static const Int8KernelTable table = {Int8KernelIsa::NEON, "neon", matvec_neon};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const Int8KernelTable* int8_kernels_neon() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
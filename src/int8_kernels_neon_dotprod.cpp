@@ -0,0 +1,73 @@
+/**
+ * ZeticML Assignment - NEON DotProd INT8 Kernels
+ * Armv8.2 SDOT; built with -march=armv8.2-a+dotprod
+ */
+
+#include "int8_kernels.h"
+
+#if defined(__ARM_NEON) && defined(__aarch64__) && defined(__ARM_FEATURE_DOTPROD)
+
+#include <arm_neon.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// SDOT: each int32 lane accumulates four adjacent s8 x s8 products
+void matvec_neon_dotprod(const int8_t* W, size_t stride, size_t rows,
+                         const int8_t* x, size_t n, int32_t* out) {
+    size_t r = 0;
+
+    for (; r + 4 <= rows; r += 4) {
+        const int8_t* w0 = W + r * stride;
+        const int8_t* w1 = w0 + stride;
+        const int8_t* w2 = w1 + stride;
+        const int8_t* w3 = w2 + stride;
+        int32x4_t acc0 = vdupq_n_s32(0), acc1 = vdupq_n_s32(0);
+        int32x4_t acc2 = vdupq_n_s32(0), acc3 = vdupq_n_s32(0);
+        for (size_t k = 0; k < n; k += 16) {
+            const int8x16_t xv = vld1q_s8(x + k);
+            acc0 = vdotq_s32(acc0, vld1q_s8(w0 + k), xv);
+            acc1 = vdotq_s32(acc1, vld1q_s8(w1 + k), xv);
+            acc2 = vdotq_s32(acc2, vld1q_s8(w2 + k), xv);
+            acc3 = vdotq_s32(acc3, vld1q_s8(w3 + k), xv);
+        }
+        out[r] = vaddvq_s32(acc0);
+        out[r + 1] = vaddvq_s32(acc1);
+        out[r + 2] = vaddvq_s32(acc2);
+        out[r + 3] = vaddvq_s32(acc3);
+    }
+
+    for (; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        int32x4_t acc = vdupq_n_s32(0);
+        for (size_t k = 0; k < n; k += 16) {
+            acc = vdotq_s32(acc, vld1q_s8(w + k), vld1q_s8(x + k));
+        }
+        out[r] = vaddvq_s32(acc);
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_neon_dotprod() {
+    static const Int8KernelTable table = {Int8KernelIsa::NEONDotProd, "neon-dotprod", matvec_neon_dotprod};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const Int8KernelTable* int8_kernels_neon_dotprod() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
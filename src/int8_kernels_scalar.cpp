@@ -0,0 +1,32 @@
+/**
+ * ZeticML Assignment - Scalar INT8 Kernels
+ * Portable baseline; always compiled and always selectable
+ */
+
+#include "int8_kernels.h"
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+void matvec_scalar(const int8_t* W, size_t stride, size_t rows,
+                   const int8_t* x, size_t n, int32_t* out) {
+    for (size_t r = 0; r < rows; ++r) {
+        const int8_t* w = W + r * stride;
+        int32_t acc = 0;
+        for (size_t k = 0; k < n; ++k) {
+            acc += static_cast<int32_t>(w[k]) * static_cast<int32_t>(x[k]);
+        }
+        out[r] = acc;
+    }
+}
+
+} // namespace
+
+const Int8KernelTable* int8_kernels_scalar() {
+    static const Int8KernelTable table = {Int8KernelIsa::Scalar, "scalar", matvec_scalar};
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
@@ -0,0 +1,72 @@
+/**
+ * ZeticML Assignment - Kernel Dispatch
+ */
+
+#include "kernels.h"
+#include "cpu_features.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace ZeticML {
+
+namespace {
+
+bool cpu_supports(KernelIsa isa) {
+    const CpuFeatures& f = cpu_features();
+    switch (isa) {
+        case KernelIsa::Scalar: return true;
+        case KernelIsa::SSE42:  return f.sse42;
+        case KernelIsa::AVX2:   return f.avx2 && f.fma && f.f16c;
+        case KernelIsa::AVX512: return f.avx512f && f.avx2 && f.fma;
+        case KernelIsa::NEON:   return f.neon;
+    }
+    return false;
+}
+
+const KernelTable* compiled_table(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::Scalar: return detail::kernels_scalar();
+        case KernelIsa::SSE42:  return detail::kernels_sse42();
+        case KernelIsa::AVX2:   return detail::kernels_avx2();
+        case KernelIsa::AVX512: return detail::kernels_avx512();
+        case KernelIsa::NEON:   return detail::kernels_neon();
+    }
+    return nullptr;
+}
+
+const KernelTable* select_table() {
+    auto tables = available_kernel_tables();
+
+    if (const char* forced = std::getenv("ZETIC_KERNEL_ISA")) {
+        for (const KernelTable* table : tables) {
+            if (std::strcmp(table->name, forced) == 0) {
+                return table;
+            }
+        }
+    }
+    return tables.front();
+}
+
+} // namespace
+
+const KernelTable* kernel_table(KernelIsa isa) {
+    return cpu_supports(isa) ? compiled_table(isa) : nullptr;
+}
+
+std::vector<const KernelTable*> available_kernel_tables() {
+    std::vector<const KernelTable*> tables;
+    for (KernelIsa isa : {KernelIsa::AVX512, KernelIsa::AVX2, KernelIsa::SSE42,
+                          KernelIsa::NEON, KernelIsa::Scalar}) {
+        if (const KernelTable* table = kernel_table(isa)) {
+            tables.push_back(table);
+        }
+    }
+    return tables;
+}
+
+const KernelTable& kernels() {
+    static const KernelTable* selected = select_table();
+    return *selected;
+}
+
+} // namespace ZeticML
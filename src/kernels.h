@@ -0,0 +1,110 @@
+/**
+ * ZeticML Assignment - Runtime-Dispatched Compute Kernels
+ * One kernel table per instruction set, selected once at startup
+ *
+ * Each ISA variant lives in its own translation unit (kernels_<isa>.cpp)
+ * compiled with that ISA's flags, so a single binary runs on any CPU of the
+ * target architecture and still uses the widest vectors available.
+ */
+
+#pragma once
+
+#include "gemm.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ZeticML {
+
+enum class KernelIsa {
+    Scalar,
+    SSE42,
+    AVX2,
+    AVX512,
+    NEON
+};
+
+/**
+ * Primitive kernels used by the models
+ * All pointers may be unaligned; n / rows may be zero.
+ */
+struct KernelTable {
+    KernelIsa isa;
+    const char* name;
+
+    // Sum of a[i] * b[i]
+    float (*dot)(const float* a, const float* b, size_t n);
+
+    // Sum of w[indices[i]] * values[i] over nnz sparse entries
+    float (*sparse_dot)(const float* w, const uint32_t* indices, const float* values, size_t nnz);
+
+    // out[r] = bias[r] + dot(W + r * stride, x, n); bias may be nullptr
+    void (*matvec)(const float* W, size_t stride, const float* bias, size_t rows,
+                   const float* x, size_t n, float* out);
+
+    // x[i] = 1 / (1 + exp(-x[i])) in place
+    void (*sigmoid)(float* x, size_t n);
+
+    // Numerically stable softmax in place; online: one pass for the max and
+    // the sum, one to normalize
+    void (*softmax)(float* x, size_t n);
+
+    // Online softmax over a row produced in chunks. softmax_stats() folds a
+    // chunk into the running (*max, *sum), starting from (lowest float, 0),
+    // while the chunk is still in cache; softmax_normalize() then writes
+    // x[i] = exp(x[i] - max) / sum over the whole row.
+    void (*softmax_stats)(const float* x, size_t n, float* max, float* sum);
+    void (*softmax_normalize)(float* x, size_t n, float max, float sum);
+
+    // x[i] = max(0, x[i] + bias[i]) in place
+    void (*bias_relu)(float* x, const float* bias, size_t n);
+
+    // C = epilogue(A * B + bias) with B given as PackedMatrix panels for a
+    // logical [K x N] matrix; see gemm_packed()
+    void (*gemm)(const float* A, size_t M, size_t lda,
+                 const float* B_panels, size_t K, size_t N,
+                 const float* bias, Epilogue epilogue,
+                 float* C, size_t ldc);
+
+    // matvec / gemm with the weights stored as IEEE fp16 or bfloat16 bit
+    // patterns (see half_precision.h), widened to fp32 in registers
+    void (*matvec_f16)(const uint16_t* W, size_t stride, const float* bias, size_t rows,
+                       const float* x, size_t n, float* out);
+    void (*matvec_bf16)(const uint16_t* W, size_t stride, const float* bias, size_t rows,
+                        const float* x, size_t n, float* out);
+    void (*gemm_f16)(const float* A, size_t M, size_t lda,
+                     const uint16_t* B_panels, size_t K, size_t N,
+                     const float* bias, Epilogue epilogue,
+                     float* C, size_t ldc);
+    void (*gemm_bf16)(const float* A, size_t M, size_t lda,
+                      const uint16_t* B_panels, size_t K, size_t N,
+                      const float* bias, Epilogue epilogue,
+                      float* C, size_t ldc);
+};
+
+/**
+ * Kernel table for the running CPU
+ * Chosen on first use: the widest compiled-in ISA the CPU supports, unless
+ * the ZETIC_KERNEL_ISA environment variable (scalar, sse4.2, avx2, avx512,
+ * neon) names another available variant.
+ */
+const KernelTable& kernels();
+
+// Table for a specific ISA, or nullptr if not compiled in / unsupported here
+const KernelTable* kernel_table(KernelIsa isa);
+
+// All variants usable on this CPU, best first (always ends with Scalar)
+std::vector<const KernelTable*> available_kernel_tables();
+
+namespace detail {
+
+// Per-ISA tables; return nullptr when the TU was built without that ISA
+const KernelTable* kernels_scalar();
+const KernelTable* kernels_sse42();
+const KernelTable* kernels_avx2();
+const KernelTable* kernels_avx512();
+const KernelTable* kernels_neon();
+
+} // namespace detail
+
+} // namespace ZeticML
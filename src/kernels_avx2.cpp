@@ -0,0 +1,90 @@
+/**
+ * ZeticML Assignment - AVX2 Kernels
+ * 256-bit vectors with FMA and F16C; built with -mavx2 -mfma -mf16c
+ */
+
+#include "kernels.h"
+
+#if defined(__AVX2__) && ((defined(__FMA__) && defined(__F16C__)) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+struct Avx2Ops {
+    using Reg = __m256;
+    static constexpr size_t kWidth = 8;
+    static constexpr size_t kGemmRows = 4;   // 8 accumulators + 2 B + A of 16 YMM
+
+    static Reg zero() { return _mm256_setzero_ps(); }
+    static Reg set1(float v) { return _mm256_set1_ps(v); }
+    static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static Reg gather(const float* base, const uint32_t* idx) {
+        return _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), 4);
+    }
+    static void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(a, b, c); }
+    static Reg floor(Reg v) { return _mm256_floor_ps(v); }
+    static Reg pow2(Reg n) {
+        __m256i e = _mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+    }
+    static float hsum(Reg v) {
+        __m128 lo = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+        lo = _mm_add_ss(lo, _mm_movehdup_ps(lo));
+        return _mm_cvtss_f32(lo);
+    }
+    static float hmax(Reg v) {
+        __m128 lo = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        lo = _mm_max_ps(lo, _mm_movehl_ps(lo, lo));
+        lo = _mm_max_ss(lo, _mm_movehdup_ps(lo));
+        return _mm_cvtss_f32(lo);
+    }
+    static Reg load_f16(const uint16_t* p) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    static Reg load_bf16(const uint16_t* p) {
+        const __m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(h, 16));
+    }
+};
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
+
+#include "kernels_impl.h"
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_avx2() {
+    static const KernelTable table = make_kernel_table<Avx2Ops>(KernelIsa::AVX2, "avx2");
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_avx2() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
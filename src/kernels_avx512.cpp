@@ -0,0 +1,87 @@
+/**
+ * ZeticML Assignment - AVX-512 Kernels
+ * 512-bit vectors (AVX-512F); built with -mavx512f -mavx2 -mfma
+ */
+
+#include "kernels.h"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+// GCC 12 reports its own _mm512_undefined_* placeholders inside the intrinsic
+// headers as uninitialized (GCC bug 105593); the warnings are spurious
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+struct Avx512Ops {
+    using Reg = __m512;
+    static constexpr size_t kWidth = 16;
+    static constexpr size_t kGemmRows = 8;   // One ZMM per row: 8 independent FMA chains
+
+    static Reg zero() { return _mm512_setzero_ps(); }
+    static Reg set1(float v) { return _mm512_set1_ps(v); }
+    static Reg load(const float* p) { return _mm512_loadu_ps(p); }
+    static Reg gather(const float* base, const uint32_t* idx) {
+        return _mm512_i32gather_ps(_mm512_loadu_si512(idx), base, 4);
+    }
+    static void store(float* p, Reg v) { _mm512_storeu_ps(p, v); }
+    static Reg add(Reg a, Reg b) { return _mm512_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm512_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm512_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm512_div_ps(a, b); }
+    static Reg min(Reg a, Reg b) { return _mm512_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm512_max_ps(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm512_fmadd_ps(a, b, c); }
+    static Reg floor(Reg v) { return _mm512_roundscale_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static Reg pow2(Reg n) {
+        __m512i e = _mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(127));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(e, 23));
+    }
+    static float hsum(Reg v) { return _mm512_reduce_add_ps(v); }
+    static float hmax(Reg v) { return _mm512_reduce_max_ps(v); }
+    static Reg load_f16(const uint16_t* p) {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+    static Reg load_bf16(const uint16_t* p) {
+        const __m512i h = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(h, 16));
+    }
+};
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
+
+#include "kernels_impl.h"
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_avx512() {
+    static const KernelTable table = make_kernel_table<Avx512Ops>(KernelIsa::AVX512, "avx512");
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_avx512() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
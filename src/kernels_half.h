@@ -0,0 +1,50 @@
+/**
+ * ZeticML Assignment - Scalar 16-bit Widening for the Kernel TUs
+ * Included by kernels_impl.h and by ops types that widen fp16 / bf16 without
+ * conversion instructions; same anonymous-namespace rule as kernels_impl.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+// Same results as half_to_float / bfloat16_to_float (half_precision.h)
+inline float bits_to_float(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float f16_to_float(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+    if (exponent == 0x1F) {
+        return bits_to_float(sign | 0x7F800000 | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            return bits_to_float(sign);
+        }
+        exponent = 113;
+        while ((mantissa & 0x400) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        return bits_to_float(sign | (exponent << 23) | ((mantissa & 0x3FF) << 13));
+    }
+    return bits_to_float(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline float bf16_to_float(uint16_t h) {
+    return bits_to_float(static_cast<uint32_t>(h) << 16);
+}
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
@@ -0,0 +1,464 @@
+/**
+ * ZeticML Assignment - Kernel Implementations (ISA-generic)
+ * Included once by each kernels_<isa>.cpp after it defines its vector ops
+ *
+ * Every algorithm here is written against a small vector-ops type `V`:
+ *   Reg, kWidth, kGemmRows, zero, set1, load, gather (kWidth floats at
+ *   base[idx[i]]), store, add, sub, mul, div,
+ *   min, max, fmadd(a, b, c) = a * b + c, floor, pow2 (2^n for integral n),
+ *   hsum, hmax, load_f16 / load_bf16 (kWidth 16-bit weights widened to fp32)
+ * so the scalar, SSE4.2, AVX2, AVX-512 and NEON tables share one source and
+ * only differ in register width and the instructions each op lowers to.
+ * Everything lives in an anonymous namespace: each including TU gets its own
+ * copy compiled with its own target flags. Do not call inline library
+ * functions (std::min, std::max, numeric_limits, ...) from here: their
+ * out-of-line copies are merged across TUs by the linker, and a copy built
+ * with AVX flags could end up running on a CPU without AVX.
+ */
+
+#pragma once
+
+#include "kernels.h"
+#include "kernels_half.h"
+#include <cstring>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+inline float min_f(float a, float b) { return a < b ? a : b; }
+inline float max_f(float a, float b) { return a > b ? a : b; }
+inline size_t min_size(size_t a, size_t b) { return a < b ? a : b; }
+
+/**
+ * How matvec / gemm read their weight operand: fp32 directly, or 16-bit
+ * values widened in registers. Elem is the stored type.
+ */
+template <class V>
+struct Fp32Weights {
+    using Elem = float;
+    static typename V::Reg load(const float* p) { return V::load(p); }
+    static float scalar(float w) { return w; }
+};
+
+template <class V>
+struct Fp16Weights {
+    using Elem = uint16_t;
+    static typename V::Reg load(const uint16_t* p) { return V::load_f16(p); }
+    static float scalar(uint16_t w) { return f16_to_float(w); }
+};
+
+template <class V>
+struct Bf16Weights {
+    using Elem = uint16_t;
+    static typename V::Reg load(const uint16_t* p) { return V::load_bf16(p); }
+    static float scalar(uint16_t w) { return bf16_to_float(w); }
+};
+
+constexpr float kLowestFloat = -3.402823466e+38f;
+
+// Cephes exp: exp(x) = 2^n * p(r), r = x - n * ln2, |r| <= ln2 / 2
+constexpr float kExpHi = 88.3762626647949f;
+constexpr float kExpLo = -87.3365447504019f;
+constexpr float kLog2e = 1.44269504088896341f;
+constexpr float kExpC1 = 0.693359375f;
+constexpr float kExpC2 = -2.12194440e-4f;
+constexpr float kExpP0 = 1.9875691500e-4f;
+constexpr float kExpP1 = 1.3981999507e-3f;
+constexpr float kExpP2 = 8.3334519073e-3f;
+constexpr float kExpP3 = 4.1665795894e-2f;
+constexpr float kExpP4 = 1.6666665459e-1f;
+constexpr float kExpP5 = 5.0000001201e-1f;
+
+template <class V>
+inline typename V::Reg exp_v(typename V::Reg x) {
+    using R = typename V::Reg;
+    x = V::min(V::max(x, V::set1(kExpLo)), V::set1(kExpHi));
+    R n = V::floor(V::fmadd(x, V::set1(kLog2e), V::set1(0.5f)));
+    x = V::sub(x, V::mul(n, V::set1(kExpC1)));
+    x = V::sub(x, V::mul(n, V::set1(kExpC2)));
+    R y = V::set1(kExpP0);
+    y = V::fmadd(y, x, V::set1(kExpP1));
+    y = V::fmadd(y, x, V::set1(kExpP2));
+    y = V::fmadd(y, x, V::set1(kExpP3));
+    y = V::fmadd(y, x, V::set1(kExpP4));
+    y = V::fmadd(y, x, V::set1(kExpP5));
+    y = V::fmadd(y, V::mul(x, x), V::add(x, V::set1(1.0f)));
+    return V::mul(y, V::pow2(n));
+}
+
+// Scalar exp for loop tails, evaluated in one lane of exp_v so it rounds
+// exactly like the vector body (same fmadd chain, whether or not that is a
+// fused multiply-add, and no reliance on the compiler contracting scalar
+// code): results do not depend on an element's position within the vector
+template <class V>
+inline float exp_scalar(float x) {
+    return V::hmax(exp_v<V>(V::set1(x)));
+}
+
+// Sum of w[i] * x[i] with w read through the weight loader L
+template <class V, class L>
+float weighted_dot(const typename L::Elem* w, const float* x, size_t n) {
+    constexpr size_t W = V::kWidth;
+    auto acc0 = V::zero(), acc1 = V::zero(), acc2 = V::zero(), acc3 = V::zero();
+    size_t i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = V::fmadd(L::load(w + i), V::load(x + i), acc0);
+        acc1 = V::fmadd(L::load(w + i + W), V::load(x + i + W), acc1);
+        acc2 = V::fmadd(L::load(w + i + 2 * W), V::load(x + i + 2 * W), acc2);
+        acc3 = V::fmadd(L::load(w + i + 3 * W), V::load(x + i + 3 * W), acc3);
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = V::fmadd(L::load(w + i), V::load(x + i), acc0);
+    }
+    float sum = V::hsum(V::add(V::add(acc0, acc1), V::add(acc2, acc3)));
+    for (; i < n; ++i) {
+        sum += L::scalar(w[i]) * x[i];
+    }
+    return sum;
+}
+
+template <class V>
+float dot_impl(const float* a, const float* b, size_t n) {
+    return weighted_dot<V, Fp32Weights<V>>(a, b, n);
+}
+
+// Sum of w[indices[i]] * values[i]: cost follows nnz, not the dense width
+template <class V>
+float sparse_dot_impl(const float* w, const uint32_t* indices, const float* values, size_t nnz) {
+    constexpr size_t W = V::kWidth;
+    auto acc0 = V::zero(), acc1 = V::zero();
+    size_t i = 0;
+    for (; i + 2 * W <= nnz; i += 2 * W) {
+        acc0 = V::fmadd(V::gather(w, indices + i), V::load(values + i), acc0);
+        acc1 = V::fmadd(V::gather(w, indices + i + W), V::load(values + i + W), acc1);
+    }
+    for (; i + W <= nnz; i += W) {
+        acc0 = V::fmadd(V::gather(w, indices + i), V::load(values + i), acc0);
+    }
+    float sum = V::hsum(V::add(acc0, acc1));
+    for (; i < nnz; ++i) {
+        sum += w[indices[i]] * values[i];
+    }
+    return sum;
+}
+
+template <class V, class L = Fp32Weights<V>>
+void matvec_impl(const typename L::Elem* W, size_t stride, const float* bias, size_t rows,
+                 const float* x, size_t n, float* out) {
+    constexpr size_t VW = V::kWidth;
+    size_t r = 0;
+
+    // Four weight rows per pass share each load of x
+    for (; r + 4 <= rows; r += 4) {
+        const typename L::Elem* w0 = W + (r + 0) * stride;
+        const typename L::Elem* w1 = W + (r + 1) * stride;
+        const typename L::Elem* w2 = W + (r + 2) * stride;
+        const typename L::Elem* w3 = W + (r + 3) * stride;
+        auto acc0 = V::zero(), acc1 = V::zero(), acc2 = V::zero(), acc3 = V::zero();
+        size_t i = 0;
+        for (; i + VW <= n; i += VW) {
+            auto xv = V::load(x + i);
+            acc0 = V::fmadd(L::load(w0 + i), xv, acc0);
+            acc1 = V::fmadd(L::load(w1 + i), xv, acc1);
+            acc2 = V::fmadd(L::load(w2 + i), xv, acc2);
+            acc3 = V::fmadd(L::load(w3 + i), xv, acc3);
+        }
+        float s0 = V::hsum(acc0), s1 = V::hsum(acc1), s2 = V::hsum(acc2), s3 = V::hsum(acc3);
+        for (; i < n; ++i) {
+            s0 += L::scalar(w0[i]) * x[i];
+            s1 += L::scalar(w1[i]) * x[i];
+            s2 += L::scalar(w2[i]) * x[i];
+            s3 += L::scalar(w3[i]) * x[i];
+        }
+        out[r + 0] = s0;
+        out[r + 1] = s1;
+        out[r + 2] = s2;
+        out[r + 3] = s3;
+    }
+    for (; r < rows; ++r) {
+        out[r] = weighted_dot<V, L>(W + r * stride, x, n);
+    }
+
+    if (bias != nullptr) {
+        for (size_t c = 0; c < rows; ++c) {
+            out[c] += bias[c];
+        }
+    }
+}
+
+template <class V>
+void sigmoid_impl(float* x, size_t n) {
+    constexpr size_t W = V::kWidth;
+    const auto one = V::set1(1.0f);
+    const auto zero = V::zero();
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        auto e = exp_v<V>(V::sub(zero, V::load(x + i)));
+        V::store(x + i, V::div(one, V::add(one, e)));
+    }
+    for (; i < n; ++i) {
+        x[i] = 1.0f / (1.0f + exp_scalar<V>(-x[i]));
+    }
+}
+
+// Row chunk folded per softmax_stats() call: small enough to be re-read
+// from L1 by the exp pass right after the max pass
+constexpr size_t kSoftmaxChunk = 1024;
+
+template <class V>
+void softmax_stats_impl(const float* x, size_t n, float* max, float* sum) {
+    if (n == 0) {
+        return;
+    }
+    constexpr size_t W = V::kWidth;
+
+    // Chunk max, then rescale the running sum to the new max
+    float chunk_max = kLowestFloat;
+    size_t i = 0;
+    if (n >= W) {
+        auto vmax = V::load(x);
+        for (i = W; i + W <= n; i += W) {
+            vmax = V::max(vmax, V::load(x + i));
+        }
+        chunk_max = V::hmax(vmax);
+    }
+    for (; i < n; ++i) {
+        chunk_max = max_f(chunk_max, x[i]);
+    }
+    const float new_max = max_f(*max, chunk_max);
+    float total = *sum != 0.0f ? *sum * exp_scalar<V>(*max - new_max) : 0.0f;
+
+    // Exponentials of the (cache-hot) chunk, summed without being stored
+    const auto vshift = V::set1(new_max);
+    auto vsum = V::zero();
+    for (i = 0; i + W <= n; i += W) {
+        vsum = V::add(vsum, exp_v<V>(V::sub(V::load(x + i), vshift)));
+    }
+    float chunk_sum = V::hsum(vsum);
+    for (; i < n; ++i) {
+        chunk_sum += exp_scalar<V>(x[i] - new_max);
+    }
+    *max = new_max;
+    *sum = total + chunk_sum;
+}
+
+template <class V>
+void softmax_normalize_impl(float* x, size_t n, float max, float sum) {
+    constexpr size_t W = V::kWidth;
+    const float scale = 1.0f / sum;
+    const auto vshift = V::set1(max);
+    const auto vscale = V::set1(scale);
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        V::store(x + i, V::mul(exp_v<V>(V::sub(V::load(x + i), vshift)), vscale));
+    }
+    for (; i < n; ++i) {
+        x[i] = exp_scalar<V>(x[i] - max) * scale;
+    }
+}
+
+template <class V>
+void softmax_impl(float* x, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    // Pass 1: running max and sum chunk by chunk; pass 2: normalize
+    float max_value = kLowestFloat, sum_exp = 0.0f;
+    for (size_t i = 0; i < n; i += kSoftmaxChunk) {
+        softmax_stats_impl<V>(x + i, min_size(kSoftmaxChunk, n - i), &max_value, &sum_exp);
+    }
+    softmax_normalize_impl<V>(x, n, max_value, sum_exp);
+}
+
+template <class V>
+void bias_relu_impl(float* x, const float* bias, size_t n) {
+    constexpr size_t W = V::kWidth;
+    const auto zero = V::zero();
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        V::store(x + i, V::max(zero, V::add(V::load(x + i), V::load(bias + i))));
+    }
+    for (; i < n; ++i) {
+        x[i] = max_f(0.0f, x[i] + bias[i]);
+    }
+}
+
+// ==================== Packed GEMM ====================
+
+constexpr size_t kGemmNR = PackedMatrix::kPanelWidth;
+constexpr size_t kGemmKC = 256;   // K block: one panel slice is KC * NR floats (16 KB)
+constexpr size_t kGemmMC = 64;    // M block: rows of A that stay hot in L2 per panel
+
+/**
+ * Micro-kernel: ROWS x NR tile of C over one K block
+ * Accumulators stay in registers (NR / kWidth vectors per row). On the first
+ * K block the tile starts from the bias, otherwise from the partial sums
+ * already in C; the epilogue runs on the last K block.
+ */
+template <class V, class L, size_t ROWS>
+void gemm_micro_kernel(const float* A, size_t lda, const typename L::Elem* panel, size_t kc,
+                       const float* bias, bool first, bool last, Epilogue epilogue,
+                       float* C, size_t ldc, size_t cols) {
+    using R = typename V::Reg;
+    constexpr size_t W = V::kWidth;
+    constexpr size_t NV = kGemmNR / W;
+    static_assert(kGemmNR % W == 0, "panel width must be a multiple of the vector width");
+
+    R acc[ROWS][NV];
+    float edge[kGemmNR];
+
+    for (size_t r = 0; r < ROWS; ++r) {
+        const float* src = nullptr;
+        if (first) {
+            src = bias;
+        } else {
+            src = C + r * ldc;
+        }
+        if (src == nullptr || cols < kGemmNR) {
+            for (size_t j = 0; j < kGemmNR; ++j) {
+                edge[j] = (src != nullptr && j < cols) ? src[j] : 0.0f;
+            }
+            src = edge;
+        }
+        for (size_t v = 0; v < NV; ++v) {
+            acc[r][v] = V::load(src + v * W);
+        }
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        const typename L::Elem* b = panel + k * kGemmNR;
+        R bv[NV];
+        for (size_t v = 0; v < NV; ++v) {
+            bv[v] = L::load(b + v * W);
+        }
+        for (size_t r = 0; r < ROWS; ++r) {
+            const R a = V::set1(A[r * lda + k]);
+            for (size_t v = 0; v < NV; ++v) {
+                acc[r][v] = V::fmadd(a, bv[v], acc[r][v]);
+            }
+        }
+    }
+
+    if (last && epilogue == Epilogue::Relu) {
+        const R zero = V::zero();
+        for (size_t r = 0; r < ROWS; ++r) {
+            for (size_t v = 0; v < NV; ++v) {
+                acc[r][v] = V::max(zero, acc[r][v]);
+            }
+        }
+    } else if (last && epilogue == Epilogue::Sigmoid) {
+        const R zero = V::zero();
+        const R one = V::set1(1.0f);
+        for (size_t r = 0; r < ROWS; ++r) {
+            for (size_t v = 0; v < NV; ++v) {
+                acc[r][v] = V::div(one, V::add(one, exp_v<V>(V::sub(zero, acc[r][v]))));
+            }
+        }
+    }
+
+    for (size_t r = 0; r < ROWS; ++r) {
+        if (cols == kGemmNR) {
+            for (size_t v = 0; v < NV; ++v) {
+                V::store(C + r * ldc + v * W, acc[r][v]);
+            }
+        } else {
+            for (size_t v = 0; v < NV; ++v) {
+                V::store(edge + v * W, acc[r][v]);
+            }
+            for (size_t j = 0; j < cols; ++j) {
+                C[r * ldc + j] = edge[j];
+            }
+        }
+    }
+}
+
+template <class V, class L, size_t ROWS>
+void gemm_rows(size_t rows, const float* A, size_t lda, const typename L::Elem* panel, size_t kc,
+               const float* bias, bool first, bool last, Epilogue epilogue,
+               float* C, size_t ldc, size_t cols) {
+    if (rows == ROWS) {
+        gemm_micro_kernel<V, L, ROWS>(A, lda, panel, kc, bias, first, last, epilogue, C, ldc, cols);
+    } else if constexpr (ROWS > 1) {
+        gemm_rows<V, L, ROWS - 1>(rows, A, lda, panel, kc, bias, first, last, epilogue, C, ldc, cols);
+    }
+}
+
+template <class V, class L = Fp32Weights<V>>
+void gemm_impl(const float* A, size_t M, size_t lda,
+               const typename L::Elem* B_panels, size_t K, size_t N,
+               const float* bias, Epilogue epilogue,
+               float* C, size_t ldc) {
+    constexpr size_t MR = V::kGemmRows;
+    const size_t num_panels = (N + kGemmNR - 1) / kGemmNR;
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    // K == 0 degenerates to C = epilogue(bias)
+    if (K == 0) {
+        for (size_t m = 0; m < M; ++m) {
+            for (size_t n = 0; n < N; ++n) {
+                float v = bias != nullptr ? bias[n] : 0.0f;
+                if (epilogue == Epilogue::Relu) {
+                    v = max_f(0.0f, v);
+                } else if (epilogue == Epilogue::Sigmoid) {
+                    v = 1.0f / (1.0f + exp_scalar<V>(-v));
+                }
+                C[m * ldc + n] = v;
+            }
+        }
+        return;
+    }
+
+    for (size_t m0 = 0; m0 < M; m0 += kGemmMC) {
+        const size_t mc = min_size(kGemmMC, M - m0);
+
+        for (size_t p = 0; p < num_panels; ++p) {
+            const size_t col0 = p * kGemmNR;
+            const size_t cols = min_size(kGemmNR, N - col0);
+            const typename L::Elem* panel = B_panels + p * K * kGemmNR;
+            const float* panel_bias = bias != nullptr ? bias + col0 : nullptr;
+
+            for (size_t k0 = 0; k0 < K; k0 += kGemmKC) {
+                const size_t kc = min_size(kGemmKC, K - k0);
+                const bool first = k0 == 0;
+                const bool last = k0 + kc == K;
+
+                for (size_t m = 0; m < mc; m += MR) {
+                    const size_t rows = min_size(MR, mc - m);
+                    gemm_rows<V, L, MR>(rows,
+                                        A + (m0 + m) * lda + k0, lda,
+                                        panel + k0 * kGemmNR, kc,
+                                        panel_bias, first, last, epilogue,
+                                        C + (m0 + m) * ldc + col0, ldc, cols);
+                }
+            }
+        }
+    }
+}
+
+template <class V>
+KernelTable make_kernel_table(KernelIsa isa, const char* name) {
+    KernelTable table;
+    table.isa = isa;
+    table.name = name;
+    table.dot = &dot_impl<V>;
+    table.sparse_dot = &sparse_dot_impl<V>;
+    table.matvec = &matvec_impl<V>;
+    table.sigmoid = &sigmoid_impl<V>;
+    table.softmax = &softmax_impl<V>;
+    table.softmax_stats = &softmax_stats_impl<V>;
+    table.softmax_normalize = &softmax_normalize_impl<V>;
+    table.bias_relu = &bias_relu_impl<V>;
+    table.gemm = &gemm_impl<V>;
+    table.matvec_f16 = &matvec_impl<V, Fp16Weights<V>>;
+    table.matvec_bf16 = &matvec_impl<V, Bf16Weights<V>>;
+    table.gemm_f16 = &gemm_impl<V, Fp16Weights<V>>;
+    table.gemm_bf16 = &gemm_impl<V, Bf16Weights<V>>;
+    return table;
+}
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
@@ -0,0 +1,79 @@
+/**
+ * ZeticML Assignment - NEON Kernels
+ * AArch64 Advanced SIMD (128-bit, fused multiply-add)
+ */
+
+#include "kernels.h"
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+#include <arm_neon.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+struct NeonOps {
+    using Reg = float32x4_t;
+    static constexpr size_t kWidth = 4;
+    static constexpr size_t kGemmRows = 4;   // 16 accumulators of 32 V registers
+
+    static Reg zero() { return vdupq_n_f32(0.0f); }
+    static Reg set1(float v) { return vdupq_n_f32(v); }
+    static Reg load(const float* p) { return vld1q_f32(p); }
+    // No gather instruction: assemble the lanes
+    static Reg gather(const float* base, const uint32_t* idx) {
+        Reg v = vdupq_n_f32(base[idx[0]]);
+        v = vsetq_lane_f32(base[idx[1]], v, 1);
+        v = vsetq_lane_f32(base[idx[2]], v, 2);
+        return vsetq_lane_f32(base[idx[3]], v, 3);
+    }
+    static void store(float* p, Reg v) { vst1q_f32(p, v); }
+    static Reg add(Reg a, Reg b) { return vaddq_f32(a, b); }
+    static Reg sub(Reg a, Reg b) { return vsubq_f32(a, b); }
+    static Reg mul(Reg a, Reg b) { return vmulq_f32(a, b); }
+    static Reg div(Reg a, Reg b) { return vdivq_f32(a, b); }
+    static Reg min(Reg a, Reg b) { return vminq_f32(a, b); }
+    static Reg max(Reg a, Reg b) { return vmaxq_f32(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return vfmaq_f32(c, a, b); }
+    static Reg floor(Reg v) { return vrndmq_f32(v); }
+    static Reg pow2(Reg n) {
+        int32x4_t e = vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127));
+        return vreinterpretq_f32_s32(vshlq_n_s32(e, 23));
+    }
+    static float hsum(Reg v) { return vaddvq_f32(v); }
+    static float hmax(Reg v) { return vmaxvq_f32(v); }
+    static Reg load_f16(const uint16_t* p) { return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p))); }
+    static Reg load_bf16(const uint16_t* p) { return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(p), 16)); }
+};
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
+
+#include "kernels_impl.h"
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_neon() {
+    static const KernelTable table = make_kernel_table<NeonOps>(KernelIsa::NEON, "neon");
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_neon() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
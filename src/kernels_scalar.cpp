@@ -0,0 +1,60 @@
+/**
+ * ZeticML Assignment - Scalar Kernels
+ * Portable baseline; always compiled and always selectable
+ */
+
+#include "kernels.h"
+#include "kernels_half.h"
+#include <cmath>
+#include <cstring>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+struct ScalarOps {
+    using Reg = float;
+    static constexpr size_t kWidth = 1;
+    static constexpr size_t kGemmRows = 4;
+
+    static Reg zero() { return 0.0f; }
+    static Reg set1(float v) { return v; }
+    static Reg load(const float* p) { return *p; }
+    static Reg gather(const float* base, const uint32_t* idx) { return base[*idx]; }
+    static void store(float* p, Reg v) { *p = v; }
+    static Reg add(Reg a, Reg b) { return a + b; }
+    static Reg sub(Reg a, Reg b) { return a - b; }
+    static Reg mul(Reg a, Reg b) { return a * b; }
+    static Reg div(Reg a, Reg b) { return a / b; }
+    static Reg min(Reg a, Reg b) { return a < b ? a : b; }
+    static Reg max(Reg a, Reg b) { return a > b ? a : b; }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return a * b + c; }
+    static Reg floor(Reg v) { return std::floor(v); }
+    static Reg pow2(Reg n) {
+        const unsigned bits = static_cast<unsigned>(static_cast<int>(n) + 127) << 23;
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+    static float hsum(Reg v) { return v; }
+    static float hmax(Reg v) { return v; }
+    static Reg load_f16(const uint16_t* p) { return f16_to_float(*p); }
+    static Reg load_bf16(const uint16_t* p) { return bf16_to_float(*p); }
+};
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
+
+#include "kernels_impl.h"
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_scalar() {
+    static const KernelTable table = make_kernel_table<ScalarOps>(KernelIsa::Scalar, "scalar");
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
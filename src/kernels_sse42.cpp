@@ -0,0 +1,91 @@
+/**
+ * ZeticML Assignment - SSE4.2 Kernels
+ * 128-bit vectors without FMA; built with -msse4.2
+ */
+
+#include "kernels.h"
+#include "kernels_half.h"
+
+#if defined(__SSE4_2__) || defined(ZETIC_ENABLE_SSE42)
+
+#include <immintrin.h>
+
+namespace ZeticML {
+namespace detail {
+namespace {
+
+struct Sse42Ops {
+    using Reg = __m128;
+    static constexpr size_t kWidth = 4;
+    static constexpr size_t kGemmRows = 2;   // 16 XMM registers: 8 accumulators + 4 B + A
+
+    static Reg zero() { return _mm_setzero_ps(); }
+    static Reg set1(float v) { return _mm_set1_ps(v); }
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    // No gather instruction before AVX2
+    static Reg gather(const float* base, const uint32_t* idx) {
+        return _mm_setr_ps(base[idx[0]], base[idx[1]], base[idx[2]], base[idx[3]]);
+    }
+    static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+    static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Reg floor(Reg v) { return _mm_floor_ps(v); }
+    static Reg pow2(Reg n) {
+        __m128i e = _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127));
+        return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+    }
+    static float hsum(Reg v) {
+        v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_add_ss(v, _mm_movehdup_ps(v));
+        return _mm_cvtss_f32(v);
+    }
+    static float hmax(Reg v) {
+        v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_max_ss(v, _mm_movehdup_ps(v));
+        return _mm_cvtss_f32(v);
+    }
+    // No F16C at this level: widen fp16 in scalar code
+    static Reg load_f16(const uint16_t* p) {
+        return _mm_setr_ps(f16_to_float(p[0]), f16_to_float(p[1]), f16_to_float(p[2]), f16_to_float(p[3]));
+    }
+    static Reg load_bf16(const uint16_t* p) {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(h), 16));
+    }
+};
+
+} // namespace
+} // namespace detail
+} // namespace ZeticML
+
+#include "kernels_impl.h"
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_sse42() {
+    static const KernelTable table = make_kernel_table<Sse42Ops>(KernelIsa::SSE42, "sse4.2");
+    return &table;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#else
+
+namespace ZeticML {
+namespace detail {
+
+const KernelTable* kernels_sse42() {
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ZeticML
+
+#endif
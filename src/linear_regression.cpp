@@ -4,50 +4,46 @@
  */
 
 #include "linear_regression.h"
-#include <stdexcept>
 
 namespace ZeticML {
 
-LinearRegression::LinearRegression(size_t input_size)
-    : bias_(0.0f), input_size_(input_size) {
-    weights_.resize(input_size, 0.0f);
-}
+namespace {
 
-std::vector<float> LinearRegression::forward(const std::vector<float>& input) {
-    if (input.size() != input_size_) {
-        throw std::invalid_argument("Input size mismatch");
-    }
+LayerGraph linear_graph(size_t input_size) {
+    LayerGraph graph(input_size);
+    graph.dense(graph.input(), 1, WeightOrder::OutputMajor, DenseKernel::Dot);
+    return graph;
+}
 
-    float result = bias_;
-    for (size_t i = 0; i < input_size_; ++i) {
-        result += weights_[i] * input[i];
-    }
+} // namespace
 
-    return {result};
+LinearRegression::LinearRegression(size_t input_size)
+    : GraphModel(linear_graph(input_size)) {
 }
 
-void LinearRegression::set_parameters(const std::vector<float>& parameters) {
-    if (parameters.size() != input_size_ + 1) {
-        throw std::invalid_argument("Parameter size mismatch");
-    }
+std::unique_ptr<NeuralNetwork> LinearRegression::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<LinearRegression>(*this);
+}
 
-    for (size_t i = 0; i < input_size_; ++i) {
-        weights_[i] = parameters[i];
-    }
-    bias_ = parameters[input_size_];
+std::string LinearRegression::get_model_type() const {
+    return "Linear Regression";
 }
 
-size_t LinearRegression::input_size() const {
-    return input_size_;
+std::string LinearRegression::type_name() const {
+    return "linear";
 }
 
-size_t LinearRegression::output_size() const {
-    return 1;
+std::vector<size_t> LinearRegression::dimensions() const {
+    return {input_size()};
 }
 
-std::string LinearRegression::get_model_type() const {
-    return "Linear Regression";
+float LinearRegression::forward_sparse(const SparseVector& input) const {
+    return sparse_logit(input);
 }
 
+void LinearRegression::forward_sparse_batch(const CsrMatrix& batch, float* output) const {
+    sparse_logits(batch, output);
+}
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
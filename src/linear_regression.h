@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "neural_network_interface.h"
+#include "graph_model.h"
 #include <vector>
 
 namespace ZeticML {
@@ -13,23 +13,27 @@ namespace ZeticML {
 /**
  * Linear Regression: output = w1*x1 + w2*x2 + ... + bias
  * Simple linear transformation for regression tasks
+ *
+ * Preset graph: one single-unit Dense layer (Dot kernel). The native layout
+ * equals the public parameter order: [weights(input_size), bias]
+ *
+ * Sparse inputs: forward_sparse() takes (index, value) pairs and
+ * forward_sparse_batch() a CSR batch; both cost O(non-zeros), so very wide
+ * feature vectors never need densifying.
  */
-class LinearRegression : public NeuralNetwork {
-private:
-    std::vector<float> weights_;
-    float bias_;
-    size_t input_size_;
-
+class LinearRegression : public GraphModel {
 public:
     explicit LinearRegression(size_t input_size);
 
-    // Implementation of NeuralNetwork interface
-    std::vector<float> forward(const std::vector<float>& input) override;
-    void set_parameters(const std::vector<float>& parameters) override;
-    size_t input_size() const override;
-    size_t output_size() const override;
+    std::unique_ptr<NeuralNetwork> clone() const override;
     std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+    // Single output for a sparse row; output receives batch.rows() floats
+    float forward_sparse(const SparseVector& input) const;
+    void forward_sparse_batch(const CsrMatrix& batch, float* output) const;
 };
 
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
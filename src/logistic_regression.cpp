@@ -4,54 +4,50 @@
  */
 
 #include "logistic_regression.h"
-#include <stdexcept>
-#include <cmath>
+#include "kernels.h"
 
 namespace ZeticML {
 
-LogisticRegression::LogisticRegression(size_t input_size)
-    : bias_(0.0f), input_size_(input_size) {
-    weights_.resize(input_size, 0.0f);
-}
+namespace {
 
-std::vector<float> LogisticRegression::forward(const std::vector<float>& input) {
-    if (input.size() != input_size_) {
-        throw std::invalid_argument("Input size mismatch");
-    }
+LayerGraph logistic_graph(size_t input_size) {
+    LayerGraph graph(input_size);
+    graph.sigmoid(graph.dense(graph.input(), 1, WeightOrder::OutputMajor, DenseKernel::Dot));
+    return graph;
+}
 
-    // Compute linear combination
-    float linear_output = bias_;
-    for (size_t i = 0; i < input_size_; ++i) {
-        linear_output += weights_[i] * input[i];
-    }
+} // namespace
 
-    // Apply sigmoid activation
-    float sigmoid_output = 1.0f / (1.0f + std::exp(-linear_output));
-    return {sigmoid_output};
+LogisticRegression::LogisticRegression(size_t input_size)
+    : GraphModel(logistic_graph(input_size)) {
 }
 
-void LogisticRegression::set_parameters(const std::vector<float>& parameters) {
-    if (parameters.size() != input_size_ + 1) {
-        throw std::invalid_argument("Parameter size mismatch");
-    }
+std::unique_ptr<NeuralNetwork> LogisticRegression::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<LogisticRegression>(*this);
+}
 
-    for (size_t i = 0; i < input_size_; ++i) {
-        weights_[i] = parameters[i];
-    }
-    bias_ = parameters[input_size_];
+std::string LogisticRegression::get_model_type() const {
+    return "Logistic Regression";
 }
 
-size_t LogisticRegression::input_size() const {
-    return input_size_;
+std::string LogisticRegression::type_name() const {
+    return "logistic";
 }
 
-size_t LogisticRegression::output_size() const {
-    return 1;
+std::vector<size_t> LogisticRegression::dimensions() const {
+    return {input_size()};
 }
 
-std::string LogisticRegression::get_model_type() const {
-    return "Logistic Regression";
+float LogisticRegression::forward_sparse(const SparseVector& input) const {
+    float output = sparse_logit(input);
+    kernels().sigmoid(&output, 1);
+    return output;
 }
 
+void LogisticRegression::forward_sparse_batch(const CsrMatrix& batch, float* output) const {
+    sparse_logits(batch, output);
+    kernels().sigmoid(output, batch.rows());
+}
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
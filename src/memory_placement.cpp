@@ -0,0 +1,323 @@
+/**
+ * ZeticML Assignment - Memory Placement Implementation
+ */
+
+#include "memory_placement.h"
+#include "aligned_buffer.h"
+#include "weight_block.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define ZETIC_HAS_MMAP 1
+#endif
+
+namespace ZeticML {
+
+namespace {
+
+std::mutex placement_mutex;
+MemoryPlacement process_placement;
+
+size_t hardware_cpus() {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : hw;
+}
+
+NumaTopology detect_topology() {
+    NumaTopology topology;
+#if defined(__linux__)
+    const std::string root = "/sys/devices/system/node";
+    if (DIR* dir = ::opendir(root.c_str())) {
+        while (const dirent* entry = ::readdir(dir)) {
+            unsigned node = 0;
+            char tail = 0;
+            if (std::sscanf(entry->d_name, "node%u%c", &node, &tail) != 1) {
+                continue;
+            }
+            std::ifstream file(root + "/" + entry->d_name + "/cpulist");
+            std::string list;
+            std::getline(file, list);
+            if (topology.node_cpus.size() <= node) {
+                topology.node_cpus.resize(node + 1);
+            }
+            topology.node_cpus[node] = parse_cpu_list(list);
+        }
+        ::closedir(dir);
+    }
+#endif
+    if (topology.node_cpus.empty()) {
+        topology.node_cpus.resize(1);
+        for (size_t cpu = 0; cpu < hardware_cpus(); ++cpu) {
+            topology.node_cpus[0].push_back(cpu);
+        }
+    }
+    for (size_t node = 0; node < topology.node_cpus.size(); ++node) {
+        auto& cpus = topology.node_cpus[node];
+        std::sort(cpus.begin(), cpus.end());
+        for (size_t cpu : cpus) {
+            if (topology.cpu_node.size() <= cpu) {
+                topology.cpu_node.resize(cpu + 1, 0);
+            }
+            topology.cpu_node[cpu] = node;
+        }
+    }
+    return topology;
+}
+
+PlacedMemory allocate_heap(size_t bytes) {
+    auto storage = std::make_shared<AlignedVector<unsigned char>>(bytes, 0);
+    PlacedMemory memory;
+    memory.data = storage->data();
+    memory.owner = std::shared_ptr<void>(storage, storage->data());
+    memory.bytes = bytes;
+    return memory;
+}
+
+#if defined(ZETIC_HAS_MMAP)
+
+// Anonymous pages read as zero and take no memory until first written, so
+// a large block that is never filled (e.g. a constructor's zero parameters
+// that a loader replaces with a file mapping) costs no page faults or RSS
+PlacedMemory allocate_zero_pages(size_t bytes) {
+    void* data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    PlacedMemory memory;
+    memory.data = data;
+    memory.bytes = bytes;
+    memory.owner = std::shared_ptr<void>(data, [bytes](void* p) { ::munmap(p, bytes); });
+    return memory;
+}
+
+#endif
+
+#if defined(__linux__)
+
+// <linux/mempolicy.h> values; the raw syscall avoids a libnuma dependency
+constexpr int kMpolPreferred = 1;
+constexpr int kMpolInterleave = 3;
+
+size_t huge_page_bytes() {
+    static const size_t bytes = [] {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string line;
+        while (std::getline(meminfo, line)) {
+            unsigned long kb = 0;
+            if (std::sscanf(line.c_str(), "Hugepagesize: %lu kB", &kb) == 1 && kb > 0) {
+                return static_cast<size_t>(kb) * 1024;
+            }
+        }
+        return size_t(2) << 20;
+    }();
+    return bytes;
+}
+
+// Set the range's NUMA policy; must run before its pages are first touched
+bool apply_numa_policy(void* data, size_t length, const MemoryPlacement& placement) {
+#if defined(SYS_mbind)
+    const NumaTopology& topology = numa_topology();
+    constexpr size_t kWordBits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask(topology.num_nodes() / kWordBits + 1, 0);
+    int mode = kMpolPreferred;
+    if (placement.numa == NumaPolicy::Interleave) {
+        // Nodes that run threads; memory-only nodes are left out
+        for (size_t node = 0; node < topology.num_nodes(); ++node) {
+            if (!topology.node_cpus[node].empty()) {
+                mask[node / kWordBits] |= 1ul << (node % kWordBits);
+            }
+        }
+        mode = kMpolInterleave;
+    } else {
+        const size_t node = placement.node < 0 ? current_numa_node() : static_cast<size_t>(placement.node);
+        mask[node / kWordBits] |= 1ul << (node % kWordBits);
+    }
+    return ::syscall(SYS_mbind, data, length, mode, mask.data(), mask.size() * kWordBits + 1, 0u) == 0;
+#else
+    (void)data;
+    (void)length;
+    (void)placement;
+    return false;
+#endif
+}
+
+PlacedMemory allocate_mapped(size_t bytes, const MemoryPlacement& placement) {
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t huge = huge_page_bytes();
+    const bool want_huge = placement.huge_pages != HugePages::Off && bytes >= huge;
+    const size_t unit = want_huge ? huge : page;
+    const size_t length = (bytes + unit - 1) / unit * unit;
+
+    PlacedMemory memory;
+    memory.bytes = bytes;
+    void* data = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (want_huge && placement.huge_pages == HugePages::Explicit) {
+        data = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (data != MAP_FAILED) {
+            memory.huge_pages = HugePages::Explicit;
+        }
+    }
+#endif
+    if (data == MAP_FAILED) {
+        if (want_huge) {
+            // Over-map and trim so the range starts on a huge-page boundary,
+            // otherwise its first and last 2 MB extents stay small pages
+            void* raw = ::mmap(nullptr, length + huge, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            const uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+            const uintptr_t aligned = (begin + huge - 1) / huge * huge;
+            if (aligned > begin) {
+                ::munmap(raw, aligned - begin);
+            }
+            if (huge > aligned - begin) {
+                ::munmap(reinterpret_cast<void*>(aligned + length), huge - (aligned - begin));
+            }
+            data = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+            if (::madvise(data, length, MADV_HUGEPAGE) == 0) {
+                memory.huge_pages = HugePages::Transparent;
+            }
+#endif
+        } else {
+            data = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (data == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+        }
+    }
+    if (placement.numa != NumaPolicy::Default) {
+        memory.numa_applied = apply_numa_policy(data, length, placement);
+    }
+    // Anonymous pages read as zero; nothing is touched until the caller writes
+    memory.data = data;
+    memory.owner = std::shared_ptr<void>(data, [length](void* p) { ::munmap(p, length); });
+    return memory;
+}
+
+#endif
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Allocation
+
+PlacedMemory allocate_placed(size_t bytes, const MemoryPlacement& placement) {
+    if (placement.numa == NumaPolicy::Local && placement.node >= 0 &&
+        static_cast<size_t>(placement.node) >= numa_topology().num_nodes()) {
+        throw std::invalid_argument("NUMA node " + std::to_string(placement.node) + " does not exist");
+    }
+    if (bytes == 0) {
+        return PlacedMemory();
+    }
+#if defined(__linux__)
+    if (!placement.is_default()) {
+        return allocate_mapped(bytes, placement);
+    }
+#endif
+#if defined(ZETIC_HAS_MMAP)
+    if (bytes >= kPlacementMinBytes) {
+        return allocate_zero_pages(bytes);
+    }
+#endif
+    return allocate_heap(bytes);
+}
+
+void set_default_weight_placement(const MemoryPlacement& placement) {
+    std::lock_guard<std::mutex> lock(placement_mutex);
+    process_placement = placement;
+}
+
+MemoryPlacement default_weight_placement() {
+    std::lock_guard<std::mutex> lock(placement_mutex);
+    return process_placement;
+}
+
+WeightBlock WeightBlock::allocate(size_t size, float*& writable) {
+    MemoryPlacement placement;
+    if (size * sizeof(float) >= kPlacementMinBytes) {
+        placement = default_weight_placement();
+    }
+    return allocate(size, writable, placement);
+}
+
+WeightBlock WeightBlock::allocate(size_t size, float*& writable, const MemoryPlacement& placement) {
+    if (placement.is_default() && size * sizeof(float) < kPlacementMinBytes) {
+        auto storage = std::make_shared<AlignedVector<float>>(size, 0.0f);
+        writable = storage->data();
+        return WeightBlock(storage, storage->data(), size);
+    }
+    PlacedMemory memory = allocate_placed(size * sizeof(float), placement);
+    writable = static_cast<float*>(memory.data);
+    return WeightBlock(std::move(memory.owner), writable, size);
+}
+
+WeightBlock WeightBlock::place(const WeightBlock& source, const MemoryPlacement& placement) {
+    float* writable = nullptr;
+    WeightBlock block = allocate(source.size(), writable, placement);
+    if (source.size() > 0) {
+        std::memcpy(writable, source.data(), source.size_bytes());
+    }
+    return block;
+}
+
+// ---------------------------------------------------------------------------
+// Topology
+
+const NumaTopology& numa_topology() {
+    static const NumaTopology topology = detect_topology();
+    return topology;
+}
+
+std::vector<size_t> parse_cpu_list(const std::string& text) {
+    std::vector<size_t> cpus;
+    std::stringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        unsigned long first = 0, last = 0;
+        const int fields = std::sscanf(range.c_str(), "%lu-%lu", &first, &last);
+        if (fields < 1) {
+            continue;
+        }
+        if (fields == 1) {
+            last = first;
+        }
+        for (unsigned long cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<size_t>(cpu));
+        }
+    }
+    return cpus;
+}
+
+size_t current_numa_node() {
+#if defined(__linux__)
+    const int cpu = ::sched_getcpu();
+    if (cpu >= 0) {
+        return numa_topology().node_of_cpu(static_cast<size_t>(cpu));
+    }
+#endif
+    return 0;
+}
+
+} // namespace ZeticML
@@ -0,0 +1,95 @@
+/**
+ * ZeticML Assignment - Memory Placement
+ * Huge-page backed and NUMA-placed allocations for large weight blocks
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+// Page size backing a placed allocation
+enum class HugePages {
+    Off,            // Regular pages
+    Transparent,    // madvise(MADV_HUGEPAGE): the kernel backs the range with
+                    // 2 MB pages when it can, 4 KB pages otherwise
+    Explicit        // MAP_HUGETLB from the reserved pool (vm.nr_hugepages);
+                    // falls back to Transparent when the pool is empty
+};
+
+// NUMA node(s) the pages of a placed allocation come from
+enum class NumaPolicy {
+    Default,        // First touch: the node of the thread that writes them
+    Local,          // From MemoryPlacement::node, others only once it is full
+    Interleave      // Page-wise round robin over every node
+};
+
+struct MemoryPlacement {
+    HugePages huge_pages = HugePages::Off;
+    NumaPolicy numa = NumaPolicy::Default;
+    int node = -1;                          // Local only; -1 = the caller's node
+
+    bool is_default() const { return huge_pages == HugePages::Off && numa == NumaPolicy::Default; }
+};
+
+/**
+ * A placed allocation and what the system actually granted
+ * Placement is best effort: a request the kernel or platform cannot honour
+ * degrades (Explicit -> Transparent -> Off, NUMA policy -> first touch)
+ * instead of failing, and the result records what was applied. Contents are
+ * zero-filled; `owner` frees the memory when its last copy goes away.
+ */
+struct PlacedMemory {
+    std::shared_ptr<void> owner;
+    void* data = nullptr;
+    size_t bytes = 0;
+    HugePages huge_pages = HugePages::Off;  // Granted page mode
+    bool numa_applied = false;              // Local/Interleave policy set on the range
+};
+
+/**
+ * Allocate `bytes` with the given placement, at least 64-byte aligned
+ * Ranges smaller than a huge page get regular pages. Default placement
+ * allocates from the heap below kPlacementMinBytes and maps anonymous
+ * zero pages above it, so untouched pages never become resident. Throws
+ * std::bad_alloc when out of memory.
+ */
+PlacedMemory allocate_placed(size_t bytes, const MemoryPlacement& placement);
+
+/**
+ * Process-wide placement for WeightBlock::allocate(), i.e. every block built
+ * by pack_parameters() / set_parameters() / set_weight_precision(). Blocks
+ * smaller than kPlacementMinBytes always come from the heap. Set it before
+ * loading models; blocks already allocated keep their placement.
+ */
+constexpr size_t kPlacementMinBytes = 256 * 1024;
+
+void set_default_weight_placement(const MemoryPlacement& placement);
+MemoryPlacement default_weight_placement();
+
+/**
+ * NUMA topology from /sys/devices/system/node (Linux)
+ * Elsewhere, or without sysfs, a single node holding every CPU.
+ */
+struct NumaTopology {
+    std::vector<std::vector<size_t>> node_cpus;  // CPUs of each node, ascending
+    std::vector<size_t> cpu_node;                // Node of each CPU
+
+    size_t num_nodes() const { return node_cpus.size(); }
+    size_t node_of_cpu(size_t cpu) const { return cpu < cpu_node.size() ? cpu_node[cpu] : 0; }
+};
+
+// Read once on first use
+const NumaTopology& numa_topology();
+
+// Parse a Linux CPU list such as "0-3,8-11" (sysfs, taskset, cpusets)
+std::vector<size_t> parse_cpu_list(const std::string& text);
+
+// Node of the CPU the calling thread is running on (0 where unknown)
+size_t current_numa_node();
+
+} // namespace ZeticML
@@ -0,0 +1,161 @@
+/**
+ * ZeticML Assignment - Model Instance Cache Implementation
+ */
+
+#include "model_cache.h"
+#include "model_loader.h"
+#include <stdexcept>
+
+namespace ZeticML {
+
+ModelCache::ModelCache(size_t memory_budget_bytes) : budget_(memory_budget_bytes) {}
+
+size_t ModelCache::charge(const NeuralNetwork& model) {
+    return model.parameter_block().size_bytes();
+}
+
+ModelCache::ModelPtr ModelCache::get(const std::string& key, const Loader& loader) {
+    std::promise<ModelPtr> promise;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->model;
+        }
+        ++stats_.misses;
+        auto pending = loading_.find(key);
+        if (pending != loading_.end()) {
+            // Someone else is loading this key: wait for their result
+            std::shared_future<ModelPtr> future = pending->second;
+            lock.unlock();
+            return future.get();
+        }
+        loading_.emplace(key, promise.get_future().share());
+    }
+
+    ModelPtr model;
+    try {
+        std::unique_ptr<NeuralNetwork> loaded = loader();
+        if (loaded == nullptr) {
+            throw std::runtime_error("Model loader returned nothing for " + key);
+        }
+        model = std::move(loaded);
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            loading_.erase(key);
+            ++stats_.load_failures;
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        loading_.erase(key);
+        insert_locked(key, model);
+    }
+    promise.set_value(model);
+    return model;
+}
+
+ModelCache::ModelPtr ModelCache::get_file(const std::string& path) {
+    return get(path, [&] { return load_zetic_model(path); });
+}
+
+ModelCache::ModelPtr ModelCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->model;
+}
+
+void ModelCache::insert(const std::string& key, ModelPtr model) {
+    if (model == nullptr) {
+        throw std::invalid_argument("Cannot cache a null model");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    insert_locked(key, std::move(model));
+}
+
+void ModelCache::insert_locked(const std::string& key, ModelPtr model) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        erase_locked(it);
+    }
+    const size_t bytes = charge(*model);
+    if (bytes > budget_) {
+        return;
+    }
+    lru_.push_front(Entry{key, std::move(model), bytes});
+    index_.emplace(key, lru_.begin());
+    bytes_ += bytes;
+    evict_locked();
+}
+
+void ModelCache::erase_locked(std::unordered_map<std::string, EntryList::iterator>::iterator it) {
+    bytes_ -= it->second->bytes;
+    lru_.erase(it->second);
+    index_.erase(it);
+}
+
+void ModelCache::evict_locked() {
+    while (bytes_ > budget_ && !lru_.empty()) {
+        erase_locked(index_.find(lru_.back().key));
+        ++stats_.evictions;
+    }
+}
+
+bool ModelCache::erase(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return false;
+    }
+    erase_locked(it);
+    return true;
+}
+
+void ModelCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+void ModelCache::set_memory_budget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = bytes;
+    evict_locked();
+}
+
+size_t ModelCache::memory_budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_;
+}
+
+size_t ModelCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+size_t ModelCache::memory_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+}
+
+ModelCacheStats ModelCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ModelCacheStats stats = stats_;
+    stats.entries = lru_.size();
+    stats.memory_bytes = bytes_;
+    stats.memory_budget = budget_;
+    return stats;
+}
+
+} // namespace ZeticML
@@ -0,0 +1,103 @@
+/**
+ * ZeticML Assignment - Model Instance Cache
+ * Keyed LRU cache of loaded models under a memory budget
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ZeticML {
+
+struct ModelCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;            // Each miss runs (or waits for) one load
+    uint64_t evictions = 0;
+    uint64_t load_failures = 0;
+    size_t entries = 0;
+    size_t memory_bytes = 0;
+    size_t memory_budget = 0;
+};
+
+/**
+ * Thread-safe cache of ready-to-run models, keyed by any string (a path,
+ * a tenant id, "tenant/version", ...)
+ * Entries are charged their parameter block size and kept in LRU order;
+ * inserting past the memory budget evicts the least recently used ones. A
+ * model bigger than the whole budget is handed out but not kept. Evicted
+ * models stay alive while callers still hold them, so the budget bounds
+ * what the cache keeps, not what is in use.
+ *
+ * get() loads each key once: threads that miss on a key already being
+ * loaded wait for that load instead of starting their own, and the loader
+ * runs without the cache lock held. A throwing loader caches nothing and
+ * rethrows in every waiting caller.
+ */
+class ModelCache {
+public:
+    using ModelPtr = std::shared_ptr<const NeuralNetwork>;
+    using Loader = std::function<std::unique_ptr<NeuralNetwork>()>;
+
+    explicit ModelCache(size_t memory_budget_bytes);
+
+    ModelCache(const ModelCache&) = delete;
+    ModelCache& operator=(const ModelCache&) = delete;
+
+    // Cached model for key, loading it with loader() on a miss
+    ModelPtr get(const std::string& key, const Loader& loader);
+
+    // .zetic model keyed by its path (see load_zetic_model)
+    ModelPtr get_file(const std::string& path);
+
+    // Cached model or nullptr; a hit refreshes the entry's recency
+    ModelPtr find(const std::string& key);
+
+    // Add or replace an entry (subject to the budget like a load)
+    void insert(const std::string& key, ModelPtr model);
+
+    bool erase(const std::string& key);
+    void clear();
+
+    // Shrinking the budget evicts right away
+    void set_memory_budget(size_t bytes);
+    size_t memory_budget() const;
+
+    size_t size() const;
+    size_t memory_bytes() const;
+    ModelCacheStats stats() const;
+
+    // Bytes an entry is charged: its native parameter block
+    static size_t charge(const NeuralNetwork& model);
+
+private:
+    struct Entry {
+        std::string key;
+        ModelPtr model;
+        size_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    // All with mutex_ held
+    void insert_locked(const std::string& key, ModelPtr model);
+    void erase_locked(std::unordered_map<std::string, EntryList::iterator>::iterator it);
+    void evict_locked();
+
+    mutable std::mutex mutex_;
+    EntryList lru_;                 // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> index_;
+    std::unordered_map<std::string, std::shared_future<ModelPtr>> loading_;
+    size_t budget_;
+    size_t bytes_ = 0;
+    ModelCacheStats stats_;
+};
+
+} // namespace ZeticML
@@ -0,0 +1,164 @@
+/**
+ * ZeticML Assignment - Hot-Swappable Model Handle Implementation
+ */
+
+#include "model_handle.h"
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace ZeticML {
+
+namespace {
+
+// First slot a thread tries; spreading threads keeps their slots on
+// separate cache lines
+size_t home_slot() {
+    thread_local const size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return slot;
+}
+
+} // namespace
+
+ModelHandle::Snapshot::Snapshot(Snapshot&& other) noexcept
+    : version_(other.version_), slot_(other.slot_) {
+    other.slot_ = nullptr;
+}
+
+ModelHandle::Snapshot& ModelHandle::Snapshot::operator=(Snapshot&& other) noexcept {
+    if (this != &other) {
+        release();
+        version_ = other.version_;
+        slot_ = other.slot_;
+        other.slot_ = nullptr;
+    }
+    return *this;
+}
+
+void ModelHandle::Snapshot::release() {
+    if (slot_ != nullptr) {
+        slot_->store(0, std::memory_order_release);
+        slot_ = nullptr;
+    }
+}
+
+ModelHandle::ModelHandle(ModelPtr model) {
+    if (model == nullptr) {
+        throw std::invalid_argument("ModelHandle needs a model");
+    }
+    current_.store(new Version{std::move(model), 1});
+}
+
+ModelHandle::~ModelHandle() {
+    delete current_.load();
+    for (const Retired& retired : retired_) {
+        delete retired.version;
+    }
+}
+
+ModelHandle::Snapshot ModelHandle::acquire() const {
+    const size_t start = home_slot();
+    for (;;) {
+        // Pin before loading current_: a version retired at epoch E is only
+        // reachable by readers pinned below E, and the writer sees the pin
+        const uint64_t epoch = epoch_.load();
+        for (size_t i = 0; i < kReaderSlots; ++i) {
+            std::atomic<uint64_t>& slot = slots_[(start + i) % kReaderSlots].epoch;
+            uint64_t expected = 0;
+            if (slot.load(std::memory_order_relaxed) == 0 && slot.compare_exchange_strong(expected, epoch)) {
+                return Snapshot(current_.load(), &slot);
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+std::vector<float> ModelHandle::forward(const std::vector<float>& input) const {
+    Snapshot snapshot = acquire();
+    return snapshot->forward(input);
+}
+
+uint64_t ModelHandle::publish(ModelPtr model) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return publish_locked(std::move(model));
+}
+
+uint64_t ModelHandle::publish_parameters(const std::vector<float>& parameters) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    // Writers are serialized, so current_ cannot be retired under us
+    std::unique_ptr<NeuralNetwork> model = current_.load()->model->clone();
+    model->set_parameters(parameters);
+    return publish_locked(std::move(model));
+}
+
+uint64_t ModelHandle::publish_locked(ModelPtr model) {
+    if (model == nullptr) {
+        throw std::invalid_argument("Cannot publish a null model");
+    }
+    const Version* old = current_.load();
+    if (model->input_size() != old->model->input_size() || model->output_size() != old->model->output_size()) {
+        throw std::invalid_argument("Published model must keep input size " +
+                                    std::to_string(old->model->input_size()) + " and output size " +
+                                    std::to_string(old->model->output_size()));
+    }
+    const uint64_t number = old->number + 1;
+    const Version* next = new Version{std::move(model), number};
+    current_.store(next);
+    version_.store(number);
+    const uint64_t epoch = epoch_.fetch_add(1) + 1;
+    retired_.push_back(Retired{old, epoch});
+    reclaim_locked();
+    return number;
+}
+
+uint64_t ModelHandle::version() const {
+    // Never dereferences current_: unpinned, it may be retired and freed
+    return version_.load();
+}
+
+uint64_t ModelHandle::oldest_pinned_epoch() const {
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (const ReaderSlot& slot : slots_) {
+        const uint64_t epoch = slot.epoch.load();
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    return oldest;
+}
+
+size_t ModelHandle::reclaim_locked() {
+    if (retired_.empty()) {
+        return 0;
+    }
+    const uint64_t oldest = oldest_pinned_epoch();
+    size_t kept = 0;
+    for (const Retired& retired : retired_) {
+        if (retired.epoch <= oldest) {
+            delete retired.version;
+        } else {
+            retired_[kept++] = retired;
+        }
+    }
+    retired_.resize(kept);
+    return kept;
+}
+
+size_t ModelHandle::reclaim() {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return reclaim_locked();
+}
+
+void ModelHandle::synchronize() {
+    while (reclaim() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+size_t ModelHandle::retired_count() const {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return retired_.size();
+}
+
+} // namespace ZeticML
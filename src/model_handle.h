@@ -0,0 +1,145 @@
+/**
+ * ZeticML Assignment - Hot-Swappable Model Handle
+ * RCU-style versioned model pointer with epoch-based reclamation
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * Versioned handle to the model currently serving traffic
+ * Published models are immutable snapshots. Readers pin the current one with
+ * acquire() and run it freely; a writer builds a complete replacement off to
+ * the side and publish()es it with a single atomic pointer swap, so readers
+ * never see a half-updated model and never wait for the writer.
+ *
+ * Reclamation is epoch based. Each acquire() claims one of kReaderSlots
+ * cache-line sized slots (starting from a per-thread hash, so each thread
+ * usually hits its own) and records the global epoch in it: one CAS and one
+ * load, with no lock and no shared reference count. A publish advances the
+ * epoch and retires the old version, which is released once no slot is
+ * pinned at an epoch before the swap. Acquiring only spins when more than
+ * kReaderSlots snapshots are held at once.
+ *
+ * Readers may also take share() to keep a version past their snapshot;
+ * retirement then drops the handle's reference and the model lives on
+ * until the last share goes away. The handle must outlive its snapshots.
+ */
+class ModelHandle {
+public:
+    using ModelPtr = std::shared_ptr<const NeuralNetwork>;
+
+    static constexpr size_t kReaderSlots = 64;
+
+private:
+    struct Version {
+        ModelPtr model;
+        uint64_t number;
+    };
+
+public:
+    /**
+     * RAII pin of one published version; move-only. The model stays valid
+     * for the snapshot's lifetime even if newer versions are published.
+     */
+    class Snapshot {
+    public:
+        Snapshot(Snapshot&& other) noexcept;
+        Snapshot& operator=(Snapshot&& other) noexcept;
+        ~Snapshot() { release(); }
+
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        const NeuralNetwork& model() const { return *version_->model; }
+        const NeuralNetwork& operator*() const { return model(); }
+        const NeuralNetwork* operator->() const { return version_->model.get(); }
+
+        // 1 for the constructor's model, +1 per publish
+        uint64_t version() const { return version_->number; }
+
+        // Owning reference that outlives the snapshot
+        ModelPtr share() const { return version_->model; }
+
+    private:
+        friend class ModelHandle;
+
+        Snapshot(const Version* version, std::atomic<uint64_t>* slot)
+            : version_(version), slot_(slot) {}
+        void release();
+
+        const Version* version_;
+        std::atomic<uint64_t>* slot_;       // Null once released or moved from
+    };
+
+    explicit ModelHandle(ModelPtr model);
+    ~ModelHandle();
+
+    ModelHandle(const ModelHandle&) = delete;
+    ModelHandle& operator=(const ModelHandle&) = delete;
+
+    // Pin the current version; never blocks on writers
+    Snapshot acquire() const;
+
+    // Convenience read path: acquire() and run one forward pass
+    std::vector<float> forward(const std::vector<float>& input) const;
+
+    /**
+     * Atomically replace the served model and return its version number.
+     * The replacement must have the current model's input and output sizes
+     * (std::invalid_argument otherwise) so in-flight callers' buffers stay
+     * valid across the swap. Writers are serialized among themselves.
+     */
+    uint64_t publish(ModelPtr model);
+
+    // Publish a clone of the current model bound to new parameters
+    uint64_t publish_parameters(const std::vector<float>& parameters);
+
+    // Published version number (readers may still hold older ones)
+    uint64_t version() const;
+
+    // Free retired versions no reader can still see; returns how many remain
+    size_t reclaim();
+
+    // Block until every retired version has been freed (so not while the
+    // calling thread holds a snapshot)
+    void synchronize();
+
+    size_t retired_count() const;
+
+private:
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};     // 0 = free, else the pinned epoch
+    };
+
+    struct Retired {
+        const Version* version;
+        uint64_t epoch;                     // First epoch that cannot see it
+    };
+
+    // Oldest epoch pinned by any reader, or UINT64_MAX when none is
+    uint64_t oldest_pinned_epoch() const;
+    uint64_t publish_locked(ModelPtr model);
+    size_t reclaim_locked();
+
+    std::atomic<const Version*> current_;
+    std::atomic<uint64_t> version_{1};      // current_'s number, readable without a pin
+    std::atomic<uint64_t> epoch_{1};
+    mutable std::array<ReaderSlot, kReaderSlots> slots_;
+
+    mutable std::mutex writer_mutex_;       // Writers and the retired list only
+    std::vector<Retired> retired_;
+};
+
+} // namespace ZeticML
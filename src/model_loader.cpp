@@ -0,0 +1,429 @@
+/**
+ * ZeticML Assignment - .zetic Model Loader Implementation
+ */
+
+#include "model_loader.h"
+#include "model_registry.h"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace ZeticML {
+
+namespace {
+
+struct ModelTypeName {
+    ZeticModelType type;
+    const char* name;
+};
+
+constexpr ModelTypeName kModelTypeNames[] = {
+    {ZeticModelType::Linear, "linear"},
+    {ZeticModelType::Logistic, "logistic"},
+    {ZeticModelType::MultiClass, "multiclass"},
+    {ZeticModelType::TwoLayerMLP, "mlp"},
+};
+
+const char* model_type_to_name(uint32_t type) {
+    for (const auto& entry : kModelTypeNames) {
+        if (static_cast<uint32_t>(entry.type) == type) {
+            return entry.name;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t model_type_from_name(const std::string& name) {
+    for (const auto& entry : kModelTypeNames) {
+        if (name == entry.name) {
+            return static_cast<uint32_t>(entry.type);
+        }
+    }
+    throw std::runtime_error("Model type cannot be stored in .zetic: " + name);
+}
+
+struct DTypePrecision {
+    ZeticDType dtype;
+    WeightPrecision precision;
+};
+
+constexpr DTypePrecision kDTypePrecisions[] = {
+    {ZeticDType::Float32, WeightPrecision::Float32},
+    {ZeticDType::Float16, WeightPrecision::Float16},
+    {ZeticDType::BFloat16, WeightPrecision::BFloat16},
+};
+
+bool precision_from_dtype(uint32_t dtype, WeightPrecision& precision) {
+    for (const auto& entry : kDTypePrecisions) {
+        if (static_cast<uint32_t>(entry.dtype) == dtype) {
+            precision = entry.precision;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t dtype_from_precision(WeightPrecision precision) {
+    for (const auto& entry : kDTypePrecisions) {
+        if (entry.precision == precision) {
+            return static_cast<uint32_t>(entry.dtype);
+        }
+    }
+    throw std::runtime_error("Weight precision cannot be stored in .zetic");
+}
+
+size_t align_up(size_t value) {
+    return (value + kZeticAlignment - 1) / kZeticAlignment * kZeticAlignment;
+}
+
+bool has_magic(const unsigned char* data, size_t size) {
+    return size >= sizeof(kZeticMagic) && std::memcmp(data, kZeticMagic, sizeof(kZeticMagic)) == 0;
+}
+
+// Read a little-endian u64 at offset, bounds-checked against size
+uint64_t read_u64(const unsigned char* data, size_t size, size_t offset) {
+    if (offset + sizeof(uint64_t) > size) {
+        throw std::runtime_error("Truncated .zetic file");
+    }
+    uint64_t value;
+    std::memcpy(&value, data + offset, sizeof(value));
+    return value;
+}
+
+ZeticModelInfo parse_legacy(const unsigned char* data, size_t size) {
+    ZeticModelInfo info;
+    info.legacy = true;
+
+    const uint64_t name_length = read_u64(data, size, 0);
+    if (name_length > size - sizeof(uint64_t)) {
+        throw std::runtime_error("Malformed legacy .zetic header");
+    }
+    info.name.assign(reinterpret_cast<const char*>(data + sizeof(uint64_t)),
+                     static_cast<size_t>(name_length));
+
+    const size_t payload_offset = sizeof(uint64_t) + static_cast<size_t>(name_length);
+    if (payload_offset + sizeof(uint64_t) <= size) {
+        info.weight_bytes = static_cast<size_t>(read_u64(data, size, payload_offset));
+    }
+    return info;
+}
+
+// Parsed, bounds-checked view of a current-format file
+struct ParsedZetic {
+    ZeticModelInfo info;
+    const unsigned char* weights = nullptr;
+};
+
+ParsedZetic parse_zetic(const unsigned char* data, size_t size) {
+    ParsedZetic parsed;
+    if (!has_magic(data, size)) {
+        parsed.info = parse_legacy(data, size);
+        return parsed;
+    }
+    if (size < sizeof(ZeticHeader)) {
+        throw std::runtime_error("Truncated .zetic header");
+    }
+
+    ZeticHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version_major != kZeticVersionMajor) {
+        throw std::runtime_error("Unsupported .zetic version " +
+                                 std::to_string(header.version_major));
+    }
+
+    const char* type_name = model_type_to_name(header.model_type);
+    if (type_name == nullptr) {
+        throw std::runtime_error("Unknown .zetic model type " + std::to_string(header.model_type));
+    }
+    if (header.num_dims == 0 || header.num_dims > kZeticMaxDims) {
+        throw std::runtime_error("Invalid .zetic shape metadata");
+    }
+
+    ZeticModelInfo& info = parsed.info;
+    info.version_major = header.version_major;
+    info.version_minor = header.version_minor;
+    info.type_name = type_name;
+    for (uint32_t d = 0; d < header.num_dims; ++d) {
+        info.dimensions.push_back(static_cast<size_t>(header.dims[d]));
+    }
+
+    const uint64_t table_bytes = static_cast<uint64_t>(header.section_count) * sizeof(ZeticSection);
+    if (header.section_table_offset > size || table_bytes > size - header.section_table_offset) {
+        throw std::runtime_error("Truncated .zetic section table");
+    }
+
+    for (uint32_t s = 0; s < header.section_count; ++s) {
+        ZeticSection section;
+        std::memcpy(&section, data + header.section_table_offset + s * sizeof(ZeticSection),
+                    sizeof(section));
+        if (section.offset > size || section.size_bytes > size - section.offset) {
+            throw std::runtime_error("Truncated .zetic section");
+        }
+
+        if (section.kind == static_cast<uint32_t>(ZeticSectionKind::Weights)) {
+            if (!precision_from_dtype(section.dtype, info.weight_precision)) {
+                throw std::runtime_error("Unsupported .zetic weight dtype");
+            }
+            if (section.layout != kZeticNativeLayout) {
+                throw std::runtime_error("Unsupported .zetic weight layout");
+            }
+            if (section.offset % kZeticAlignment != 0 || section.size_bytes % sizeof(float) != 0) {
+                throw std::runtime_error("Misaligned .zetic weight section");
+            }
+            parsed.weights = data + section.offset;
+            info.weight_bytes = static_cast<size_t>(section.size_bytes);
+        } else if (section.kind == static_cast<uint32_t>(ZeticSectionKind::Name)) {
+            info.name.assign(reinterpret_cast<const char*>(data + section.offset),
+                             static_cast<size_t>(section.size_bytes));
+        }
+        // Unknown section kinds are skipped for forward compatibility
+    }
+    return parsed;
+}
+
+std::unique_ptr<NeuralNetwork> create_empty_model(const ZeticModelInfo& info) {
+    try {
+        return get_model_registry().create_model(info.type_name, ModelShape(info.dimensions));
+    } catch (const std::invalid_argument&) {
+        throw std::runtime_error("Invalid .zetic shape metadata");
+    }
+}
+
+} // namespace
+
+// ---------------- MappedFile ----------------
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot map empty file: " + path);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot map file: " + path);
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("Cannot map file: " + path);
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+}
+
+void MappedFile::advise_sequential() const {}
+
+void advise_mapped_pages(const void* data, size_t bytes, PageAdvice advice) {
+    (void)data;
+    (void)bytes;
+    (void)advice;
+}
+
+void MappedFile::release(size_t offset, size_t length) const {
+    (void)offset;
+    (void)length;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot map empty file: " + path);
+    }
+
+    void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        throw std::runtime_error("Cannot map file: " + path);
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<size_t>(st.st_size);
+}
+
+MappedFile::~MappedFile() {
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+}
+
+void MappedFile::advise_sequential() const {
+    ::madvise(const_cast<unsigned char*>(data_), size_, MADV_SEQUENTIAL);
+}
+
+void MappedFile::release(size_t offset, size_t length) const {
+    if (length > 0 && offset + length <= size_) {
+        ::madvise(const_cast<unsigned char*>(data_) + offset, length, MADV_DONTNEED);
+    }
+}
+
+void advise_mapped_pages(const void* data, size_t bytes, PageAdvice advice) {
+    if (data == nullptr || bytes == 0) {
+        return;
+    }
+    static const uintptr_t page = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(data) / page * page;
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(data) + bytes + page - 1) / page * page;
+    int flag = MADV_NORMAL;
+    switch (advice) {
+        case PageAdvice::Normal: flag = MADV_NORMAL; break;
+        case PageAdvice::Random: flag = MADV_RANDOM; break;
+        case PageAdvice::WillNeed: flag = MADV_WILLNEED; break;
+        case PageAdvice::DontNeed: flag = MADV_DONTNEED; break;
+    }
+    ::madvise(reinterpret_cast<void*>(begin), end - begin, flag);
+}
+
+#endif
+
+// ---------------- Loader ----------------
+
+ZeticModelInfo read_zetic_info(const std::string& path) {
+    MappedFile file(path);
+    return parse_zetic(file.data(), file.size()).info;
+}
+
+std::unique_ptr<NeuralNetwork> load_zetic_model(const std::string& path) {
+    return load_zetic_model(path, ZeticLoadOptions());
+}
+
+std::unique_ptr<NeuralNetwork> load_zetic_model(const std::string& path, const ZeticLoadOptions& options) {
+    auto file = std::make_shared<MappedFile>(path);
+    ParsedZetic parsed = parse_zetic(file->data(), file->size());
+    if (parsed.info.legacy) {
+        throw std::runtime_error("Legacy .zetic file has no weights: " + path);
+    }
+    if (parsed.weights == nullptr) {
+        throw std::runtime_error("Missing .zetic weight section: " + path);
+    }
+
+    std::unique_ptr<NeuralNetwork> model = create_empty_model(parsed.info);
+    try {
+        model->set_weight_precision(parsed.info.weight_precision);
+    } catch (const std::invalid_argument&) {
+        throw std::runtime_error(std::string("Model type cannot use ") +
+                                 precision_name(parsed.info.weight_precision) + " weights: " + path);
+    }
+    const float* weights = reinterpret_cast<const float*>(parsed.weights);
+    const size_t count = parsed.info.weight_bytes / sizeof(float);
+    try {
+        WeightBlock block = WeightBlock::mapped(file, weights, count);
+        if (!options.placement.is_default()) {
+            file->advise_sequential();
+            block = WeightBlock::place(block, options.placement);
+        }
+        model->bind_parameters(std::move(block));
+    } catch (const std::invalid_argument&) {
+        throw std::runtime_error("Weight section does not match model shape: " + path);
+    }
+    return model;
+}
+
+void save_zetic_model(const NeuralNetwork& model, const std::string& path,
+                      const std::string& name) {
+    const std::vector<size_t> dims = model.dimensions();
+    if (dims.empty() || dims.size() > kZeticMaxDims) {
+        throw std::runtime_error("Model shape cannot be stored in .zetic");
+    }
+    const WeightBlock& block = model.parameter_block();
+
+    ZeticHeader header = {};
+    std::memcpy(header.magic, kZeticMagic, sizeof(kZeticMagic));
+    header.version_major = kZeticVersionMajor;
+    header.version_minor = kZeticVersionMinor;
+    header.model_type = model_type_from_name(model.type_name());
+    header.num_dims = static_cast<uint32_t>(dims.size());
+    for (size_t d = 0; d < dims.size(); ++d) {
+        header.dims[d] = dims[d];
+    }
+    header.section_count = name.empty() ? 1 : 2;
+    header.section_table_offset = sizeof(ZeticHeader);
+
+    const size_t table_end = sizeof(ZeticHeader) + header.section_count * sizeof(ZeticSection);
+
+    ZeticSection sections[2] = {};
+    sections[0].kind = static_cast<uint32_t>(ZeticSectionKind::Weights);
+    sections[0].dtype = dtype_from_precision(model.weight_precision());
+    sections[0].layout = kZeticNativeLayout;
+    sections[0].offset = align_up(table_end);
+    sections[0].size_bytes = block.size_bytes();
+
+    sections[1].kind = static_cast<uint32_t>(ZeticSectionKind::Name);
+    sections[1].offset = align_up(sections[0].offset + sections[0].size_bytes);
+    sections[1].size_bytes = name.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+
+    size_t written = 0;
+    auto write_at = [&](size_t offset, const void* bytes, size_t count) {
+        static const char kZeros[kZeticAlignment] = {};
+        while (written < offset) {
+            const size_t pad = std::min(offset - written, sizeof(kZeros));
+            out.write(kZeros, static_cast<std::streamsize>(pad));
+            written += pad;
+        }
+        out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+        written += count;
+    };
+
+    write_at(0, &header, sizeof(header));
+    write_at(sizeof(header), sections, header.section_count * sizeof(ZeticSection));
+    write_at(sections[0].offset, block.data(), block.size_bytes());
+    if (!name.empty()) {
+        write_at(sections[1].offset, name.data(), name.size());
+    }
+
+    if (!out) {
+        throw std::runtime_error("Failed writing file: " + path);
+    }
+}
+
+} // namespace ZeticML
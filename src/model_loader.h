@@ -0,0 +1,112 @@
+/**
+ * ZeticML Assignment - .zetic Model Loader
+ * Memory-mapped, zero-copy model loading and the matching writer
+ */
+
+#pragma once
+
+#include "memory_placement.h"
+#include "neural_network_interface.h"
+#include "zetic_format.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace ZeticML {
+
+/**
+ * Read-only memory mapping of a whole file
+ * The mapping lives as long as the object; models loaded from it hold a
+ * shared_ptr to keep it alive.
+ */
+class MappedFile {
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    // Hint that the file will be read front to back (no-op where unsupported)
+    void advise_sequential() const;
+
+    // Drop the resident pages of [offset, offset + length); they are read
+    // back from the file if touched again. offset and length must be
+    // multiples of the page size. No-op where unsupported.
+    void release(size_t offset, size_t length) const;
+};
+
+// Paging hints for a range of a file mapping
+enum class PageAdvice {
+    Normal,         // Default readahead
+    Random,         // No readahead: a fault reads only its own page
+    WillNeed,       // Start reading the range in now
+    DontNeed        // Drop the range; touching it again reads it back
+};
+
+/**
+ * Apply a paging hint to every page overlapping [data, data + bytes) of a
+ * read-only file mapping (a MappedFile or a file_backed() WeightBlock).
+ * DontNeed on anonymous memory would discard its contents, hence the
+ * restriction. No-op where unsupported.
+ */
+void advise_mapped_pages(const void* data, size_t bytes, PageAdvice advice);
+
+/**
+ * Header summary of a .zetic file
+ */
+struct ZeticModelInfo {
+    bool legacy = false;            // Old length-prefixed container, no weights
+    uint16_t version_major = 0;
+    uint16_t version_minor = 0;
+    std::string type_name;          // Registry name ("linear", "mlp", ...)
+    std::vector<size_t> dimensions; // Constructor shape
+    std::string name;               // Optional model name
+    size_t weight_bytes = 0;        // Weights section (or legacy payload) size
+    WeightPrecision weight_precision = WeightPrecision::Float32;
+};
+
+/**
+ * Inspect a .zetic file (current or legacy format) without loading weights
+ * Throws std::runtime_error on I/O errors or malformed headers.
+ */
+ZeticModelInfo read_zetic_info(const std::string& path);
+
+/**
+ * Map a .zetic file and return a model running directly on the mapped
+ * weights (no copy, no repack). The mapping stays alive for as long as the
+ * model does. Throws std::runtime_error on I/O errors, malformed files or
+ * legacy files, which carry no weights.
+ */
+std::unique_ptr<NeuralNetwork> load_zetic_model(const std::string& path);
+
+struct ZeticLoadOptions {
+    // Where the weights live. The default runs on the file mapping itself;
+    // any other placement copies them into anonymous memory with huge pages
+    // and/or a NUMA policy (page-cache pages can be neither) and unmaps the
+    // file once the copy is bound.
+    MemoryPlacement placement;
+};
+
+std::unique_ptr<NeuralNetwork> load_zetic_model(const std::string& path, const ZeticLoadOptions& options);
+
+/**
+ * Write a model's native parameter block to a .zetic file
+ * Throws std::runtime_error on I/O errors or unknown model types.
+ */
+void save_zetic_model(const NeuralNetwork& model, const std::string& path,
+                      const std::string& name = "");
+
+} // namespace ZeticML
@@ -1,17 +1,91 @@
 /**
  * ZeticML Assignment - Model Registry Implementation
- * Registry functionality is now implemented in the header file
- * This file exists to ensure the registry object file is linked
  */
 
 #include "model_registry.h"
+#include <mutex>
 
 namespace ZeticML {
 
-// This ensures the model_registry compilation unit gets linked
-// The actual registry logic is now in the header for inline initialization
-void __ensure_registry_linking() {
-    // This function does nothing but ensures this object file is linked
+ModelRegistry::ModelRegistry() {
+    register_type("linear", 1, [](const ModelShape& s) {
+        return std::make_unique<LinearRegression>(s[0]);
+    });
+    register_type("logistic", 1, [](const ModelShape& s) {
+        return std::make_unique<LogisticRegression>(s[0]);
+    });
+    register_type("multiclass", 2, [](const ModelShape& s) {
+        return std::make_unique<MultiClassClassifier>(s[0], s[1]);
+    });
+    register_type("mlp", 3, [](const ModelShape& s) {
+        return std::make_unique<TwoLayerMLP>(s[0], s[1], s[2]);
+    });
 }
 
-} // namespace ZeticML
\ No newline at end of file
+ModelTypeId ModelRegistry::register_type(const std::string& type_name, size_t rank, ModelFactory factory) {
+    if (type_name.empty() || !factory) {
+        throw std::invalid_argument("Model type needs a name and a factory");
+    }
+    if (rank > ModelShape::kMaxDims) {
+        throw std::invalid_argument("Model type " + type_name + " has too many dimensions");
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(type_name);
+    if (it != ids_.end()) {
+        entries_[it->second].rank = rank;
+        entries_[it->second].factory = std::move(factory);
+        return it->second;
+    }
+    const ModelTypeId id = static_cast<ModelTypeId>(entries_.size());
+    entries_.push_back(Entry{type_name, rank, std::move(factory)});
+    ids_.emplace(type_name, id);
+    return id;
+}
+
+ModelTypeId ModelRegistry::type_id(const std::string& type_name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(type_name);
+    return it != ids_.end() ? it->second : kUnknownModelType;
+}
+
+std::string ModelRegistry::type_name(ModelTypeId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (id >= entries_.size()) {
+        throw std::invalid_argument("Unknown model type id " + std::to_string(id));
+    }
+    return entries_[id].name;
+}
+
+std::unique_ptr<NeuralNetwork> ModelRegistry::create_model(ModelTypeId id, const ModelShape& shape) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (id >= entries_.size()) {
+        throw std::invalid_argument("Unknown model type id " + std::to_string(id));
+    }
+    const Entry& entry = entries_[id];
+    if (entry.rank != 0 && shape.size() != entry.rank) {
+        throw std::invalid_argument("Model type " + entry.name + " takes " + std::to_string(entry.rank) +
+                                    " dimension(s), got " + std::to_string(shape.size()));
+    }
+    return entry.factory(shape);
+}
+
+std::unique_ptr<NeuralNetwork> ModelRegistry::create_model(const std::string& type_name,
+                                                           const ModelShape& shape) const {
+    const ModelTypeId id = type_id(type_name);
+    if (id == kUnknownModelType) {
+        throw std::invalid_argument("Unknown model type: " + type_name);
+    }
+    return create_model(id, shape);
+}
+
+std::vector<std::string> ModelRegistry::get_registered_types() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> names;
+    names.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        names.push_back(entry.name);
+    }
+    return names;
+}
+
+} // namespace ZeticML
@@ -10,74 +10,141 @@
 #include "logistic_regression.h"
 #include "multi_class_classifier.h"
 #include "two_layer_mlp.h"
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <memory>
-#include <vector>
+#include <shared_mutex>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ZeticML {
 
 /**
- * Registry pattern for polymorphic neural network creation
- * Uses method overloads for different constructor signatures
+ * Constructor shape of a model: up to kMaxDims dimensions, stored inline
+ * e.g. {input} for linear, {input, classes} for multiclass,
+ * {input, hidden, output} for mlp (the same values as dimensions())
  */
-class ModelRegistry {
+class ModelShape {
+public:
+    static constexpr size_t kMaxDims = 4;
+
+    ModelShape() = default;
+    ModelShape(std::initializer_list<size_t> dims) { assign(dims.begin(), dims.size()); }
+    explicit ModelShape(const std::vector<size_t>& dims) { assign(dims.data(), dims.size()); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t operator[](size_t index) const { return dims_[index]; }
+    const size_t* begin() const { return dims_.data(); }
+    const size_t* end() const { return dims_.data() + size_; }
+
+    std::vector<size_t> to_vector() const { return std::vector<size_t>(begin(), end()); }
+
+    // "8x16x4"
+    std::string to_string() const {
+        std::string text;
+        for (size_t i = 0; i < size_; ++i) {
+            if (i != 0) {
+                text += 'x';
+            }
+            text += std::to_string(dims_[i]);
+        }
+        return text;
+    }
+
+    bool operator==(const ModelShape& other) const {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const ModelShape& other) const { return !(*this == other); }
+
 private:
-    std::unordered_map<std::string, std::string> registered_types_;
+    void assign(const size_t* dims, size_t count) {
+        if (count > kMaxDims) {
+            throw std::invalid_argument("Model shape has more than " + std::to_string(kMaxDims) + " dimensions");
+        }
+        std::copy(dims, dims + count, dims_.begin());
+        size_ = count;
+    }
+
+    std::array<size_t, kMaxDims> dims_{};
+    size_t size_ = 0;
+};
+
+// Interned model type name; ids are dense, in registration order
+using ModelTypeId = uint32_t;
+constexpr ModelTypeId kUnknownModelType = UINT32_MAX;
+
+// Builds an empty model of the given shape (rank already checked)
+using ModelFactory = std::function<std::unique_ptr<NeuralNetwork>(const ModelShape&)>;
 
+/**
+ * Registry pattern for polymorphic neural network creation
+ * Model types are registered as factories under a name, which is interned
+ * once into a dense ModelTypeId: by-name creation is one hash lookup, and
+ * callers that keep the id skip even that. The four built-in types are
+ * registered on construction; register_type() adds more (or replaces a
+ * factory) at any time. Lookups take a shared lock, so creation from many
+ * threads does not serialize; factories run under it and must not
+ * register types themselves.
+ *
+ * The create_model(name, size_t...) overloads are shorthands for
+ * create_model(name, ModelShape{...}).
+ */
+class ModelRegistry {
 public:
+    ModelRegistry();
+
+    ModelRegistry(const ModelRegistry&) = delete;
+    ModelRegistry& operator=(const ModelRegistry&) = delete;
+
     /**
-     * Create model with 1 parameter (LinearRegression, LogisticRegression)
+     * Register (or replace) a model type. rank is the number of shape
+     * dimensions the factory takes (0 accepts any). Returns the type's id,
+     * which stays the same when a factory is replaced.
      */
-    std::unique_ptr<NeuralNetwork> create_model(const std::string& type_name, size_t input_size) {
-        if (type_name == "linear") {
-            return std::make_unique<LinearRegression>(input_size);
-        } else if (type_name == "logistic") {
-            return std::make_unique<LogisticRegression>(input_size);
-        } else {
-            throw std::invalid_argument("Unknown single-parameter model type: " + type_name);
-        }
-    }
+    ModelTypeId register_type(const std::string& type_name, size_t rank, ModelFactory factory);
+
+    // Id of a registered type, or kUnknownModelType
+    ModelTypeId type_id(const std::string& type_name) const;
+
+    // Name of a registered id; throws std::invalid_argument otherwise
+    std::string type_name(ModelTypeId id) const;
 
     /**
-     * Create model with 2 parameters (MultiClassClassifier)
+     * Create an empty model; throws std::invalid_argument for unknown types
+     * and shapes of the wrong rank (plus whatever the factory throws)
      */
+    std::unique_ptr<NeuralNetwork> create_model(ModelTypeId id, const ModelShape& shape) const;
+    std::unique_ptr<NeuralNetwork> create_model(const std::string& type_name, const ModelShape& shape) const;
+
+    std::unique_ptr<NeuralNetwork> create_model(const std::string& type_name, size_t input_size) const {
+        return create_model(type_name, ModelShape{input_size});
+    }
     std::unique_ptr<NeuralNetwork> create_model(const std::string& type_name,
-                                               size_t input_size, size_t param2) {
-        if (type_name == "multiclass") {
-            return std::make_unique<MultiClassClassifier>(input_size, param2);
-        } else {
-            throw std::invalid_argument("Unknown two-parameter model type: " + type_name);
-        }
+                                               size_t input_size, size_t param2) const {
+        return create_model(type_name, ModelShape{input_size, param2});
     }
-
-    /**
-     * Create model with 3 parameters (TwoLayerMLP)
-     */
     std::unique_ptr<NeuralNetwork> create_model(const std::string& type_name,
-                                               size_t input_size, size_t hidden_size, size_t output_size) {
-        if (type_name == "mlp") {
-            return std::make_unique<TwoLayerMLP>(input_size, hidden_size, output_size);
-        } else {
-            throw std::invalid_argument("Unknown three-parameter model type: " + type_name);
-        }
+                                               size_t input_size, size_t hidden_size, size_t output_size) const {
+        return create_model(type_name, ModelShape{input_size, hidden_size, output_size});
     }
 
     /**
      * Check if a model type is registered
      */
     bool is_registered(const std::string& type_name) const {
-        return type_name == "linear" || type_name == "logistic" ||
-               type_name == "multiclass" || type_name == "mlp";
+        return type_id(type_name) != kUnknownModelType;
     }
 
     /**
-     * Get all registered model type names
+     * Get all registered model type names, in registration order
      */
-    std::vector<std::string> get_registered_types() const {
-        return {"linear", "logistic", "multiclass", "mlp"};
-    }
+    std::vector<std::string> get_registered_types() const;
 
     /**
      * Get the global registry instance (singleton pattern)
@@ -86,6 +153,17 @@ public:
         static ModelRegistry registry;
         return registry;
     }
+
+private:
+    struct Entry {
+        std::string name;
+        size_t rank;
+        ModelFactory factory;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, ModelTypeId> ids_;
+    std::vector<Entry> entries_;
 };
 
 /**
@@ -95,4 +173,4 @@ inline ModelRegistry& get_model_registry() {
     return ModelRegistry::instance();
 }
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
@@ -4,83 +4,359 @@
  */
 
 #include "multi_class_classifier.h"
-#include <stdexcept>
-#include <cmath>
+#include "kernels.h"
+#include "model_loader.h"
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
 namespace ZeticML {
 
+namespace {
+
+// Rows of a top-k group (per-row heaps and statistics live on the stack) and
+// logits per chunk (one stack buffer, L1 resident while it is scanned)
+constexpr size_t kTopKRows = 64;
+constexpr size_t kTopKChunk = 256;
+
+// Class weight rows paged in at once under lazy paging
+constexpr size_t kClassPageBytes = 64 * 1024;
+
+// Heap order: `a` ranks above `b`; the heap front is the weakest entry kept
+bool ranks_above(const ClassScore& a, const ClassScore& b) {
+    return a.score > b.score || (a.score == b.score && a.index < b.index);
+}
+
+LayerGraph multiclass_graph(size_t input_size, size_t num_classes) {
+    LayerGraph graph(input_size);
+    graph.softmax(graph.dense(graph.input(), num_classes, WeightOrder::OutputMajor, DenseKernel::Rows));
+    return graph;
+}
+
+} // namespace
+
+// Per class block "paged in" flags over one bound weight block
+struct MultiClassClassifier::ClassPager {
+    const unsigned char* rows = nullptr;
+    size_t row_bytes = 0;
+    size_t classes = 0;
+    size_t classes_per_block = 0;
+    size_t blocks = 0;
+    bool file_backed = false;
+    std::unique_ptr<std::atomic<bool>[]> paged;
+
+    const unsigned char* block_data(size_t block) const {
+        return rows + block * classes_per_block * row_bytes;
+    }
+    size_t block_bytes(size_t block) const {
+        return (std::min(classes, (block + 1) * classes_per_block) - block * classes_per_block) * row_bytes;
+    }
+};
+
 MultiClassClassifier::MultiClassClassifier(size_t input_size, size_t num_classes)
-    : input_size_(input_size), num_classes_(num_classes) {
-    weights_.resize(num_classes_, std::vector<float>(input_size_, 0.0f));
-    biases_.resize(num_classes_, 0.0f);
+    : GraphModel(multiclass_graph(input_size, num_classes)) {
+}
+
+std::unique_ptr<NeuralNetwork> MultiClassClassifier::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<MultiClassClassifier>(*this);
 }
 
-std::vector<float> MultiClassClassifier::forward(const std::vector<float>& input) {
-    if (input.size() != input_size_) {
+std::string MultiClassClassifier::get_model_type() const {
+    return "Multi-Class Classifier (" + std::to_string(output_size()) + " classes)";
+}
+
+std::string MultiClassClassifier::type_name() const {
+    return "multiclass";
+}
+
+std::vector<size_t> MultiClassClassifier::dimensions() const {
+    return {input_size(), output_size()};
+}
+
+void MultiClassClassifier::top_k_into(Span<const float> input, Span<ClassScore> out,
+                                      TopKScore scores) const {
+    if (input.size() != input_size()) {
         throw std::invalid_argument("Input size mismatch");
     }
+    if (out.size() == 0 || out.size() > output_size()) {
+        throw std::invalid_argument("Top-k size must be between 1 and the number of classes");
+    }
+    select_top_k(input.data(), 1, out.size(), out.data(), scores);
+}
 
-    // Compute logits for each class
-    std::vector<float> logits(num_classes_);
-    for (size_t c = 0; c < num_classes_; ++c) {
-        logits[c] = biases_[c];
-        for (size_t i = 0; i < input_size_; ++i) {
-            logits[c] += weights_[c][i] * input[i];
-        }
+void MultiClassClassifier::top_k_batch(const float* input, size_t batch_size, size_t k,
+                                       ClassScore* out, TopKScore scores) const {
+    if (k == 0 || k > output_size()) {
+        throw std::invalid_argument("Top-k size must be between 1 and the number of classes");
+    }
+    if (batch_size > 0 && (input == nullptr || out == nullptr)) {
+        throw std::invalid_argument("Null batch buffer");
+    }
+    if (batch_size > 0) {
+        select_top_k(input, batch_size, k, out, scores);
     }
+}
+
+std::vector<ClassScore> MultiClassClassifier::top_k(const std::vector<float>& input, size_t k,
+                                                    TopKScore scores) const {
+    std::vector<ClassScore> out(k);
+    top_k_into(Span<const float>(input), Span<ClassScore>(out), scores);
+    return out;
+}
+
+size_t MultiClassClassifier::argmax(const std::vector<float>& input) const {
+    ClassScore best;
+    top_k_into(Span<const float>(input), Span<ClassScore>(&best, 1), TopKScore::Logit);
+    return best.index;
+}
 
-    // Apply softmax activation
-    std::vector<float> probabilities(num_classes_);
-    float max_logit = *std::max_element(logits.begin(), logits.end());
+void MultiClassClassifier::select_top_k(const float* input, size_t batch_size, size_t k,
+                                        ClassScore* out, TopKScore scores) const {
+    // Same traversal as the fused softmax layer (class blocks outer so each
+    // block of weights is read once per row group), but every chunk of
+    // logits is folded into the row's heap and discarded
+    const KernelTable& kern = kernels();
+    const size_t I = input_size();
+    const size_t C = output_size();
+    const size_t block = class_block(0);
+    const bool probabilities = scores == TopKScore::Probability;
+
+    float logits[kTopKChunk];
+    float row_max[kTopKRows];
+    float row_sum[kTopKRows];
+    size_t kept[kTopKRows];
+
+    for (size_t r0 = 0; r0 < batch_size; r0 += kTopKRows) {
+        const size_t group = std::min(kTopKRows, batch_size - r0);
+        std::fill(row_max, row_max + group, std::numeric_limits<float>::lowest());
+        std::fill(row_sum, row_sum + group, 0.0f);
+        std::fill(kept, kept + group, size_t(0));
+
+        for (size_t b0 = 0; b0 < C; b0 += block) {
+            const size_t b1 = std::min(C, b0 + block);
+            for (size_t r = 0; r < group; ++r) {
+                const float* x = input + (r0 + r) * I;
+                ClassScore* heap = out + (r0 + r) * k;
+                for (size_t c0 = b0; c0 < b1; c0 += kTopKChunk) {
+                    const size_t count = std::min(kTopKChunk, b1 - c0);
+                    row_logits(0, x, c0, count, logits);
+                    if (probabilities) {
+                        kern.softmax_stats(logits, count, &row_max[r], &row_sum[r]);
+                    }
+                    for (size_t j = 0; j < count; ++j) {
+                        const ClassScore candidate{c0 + j, logits[j]};
+                        if (kept[r] < k) {
+                            heap[kept[r]++] = candidate;
+                            std::push_heap(heap, heap + kept[r], ranks_above);
+                        } else if (ranks_above(candidate, heap[0])) {
+                            std::pop_heap(heap, heap + k, ranks_above);
+                            heap[k - 1] = candidate;
+                            std::push_heap(heap, heap + k, ranks_above);
+                        }
+                    }
+                }
+            }
+        }
 
-    // Subtract max for numerical stability
-    float sum_exp = 0.0f;
-    for (size_t c = 0; c < num_classes_; ++c) {
-        probabilities[c] = std::exp(logits[c] - max_logit);
-        sum_exp += probabilities[c];
+        for (size_t r = 0; r < group; ++r) {
+            ClassScore* heap = out + (r0 + r) * k;
+            std::sort_heap(heap, heap + k, ranks_above);
+            if (probabilities) {
+                for (size_t i = 0; i < k; ++i) {
+                    heap[i].score = std::exp(heap[i].score - row_max[r]) / row_sum[r];
+                }
+            }
+        }
     }
+}
+
+// ---------------------------------------------------------------------------
+// Candidate classes
 
-    // Normalize to get probabilities
-    for (size_t c = 0; c < num_classes_; ++c) {
-        probabilities[c] /= sum_exp;
+void MultiClassClassifier::validate_candidates(Span<const size_t> candidates) const {
+    if (candidates.size() == 0) {
+        throw std::invalid_argument("Candidate class list is empty");
+    }
+    for (size_t c : candidates) {
+        if (c >= output_size()) {
+            throw std::invalid_argument("Candidate class " + std::to_string(c) + " out of range");
+        }
     }
+}
 
-    return probabilities;
+void MultiClassClassifier::candidate_logits(const float* x, const size_t* candidates, size_t count,
+                                            float* out) const {
+    // Runs of consecutive ids go through the matvec kernel in one call
+    for (size_t i = 0; i < count;) {
+        size_t run = 1;
+        while (i + run < count && candidates[i + run] == candidates[i] + run) {
+            ++run;
+        }
+        row_logits(0, x, candidates[i], run, out + i);
+        i += run;
+    }
 }
 
-void MultiClassClassifier::set_parameters(const std::vector<float>& parameters) {
-    size_t expected_size = num_classes_ * input_size_ + num_classes_; // weights + biases
-    if (parameters.size() != expected_size) {
-        throw std::invalid_argument("Parameter size mismatch");
+void MultiClassClassifier::candidate_scores_into(Span<const float> input, Span<const size_t> candidates,
+                                                 Span<float> out, TopKScore scores) const {
+    if (input.size() != input_size()) {
+        throw std::invalid_argument("Input size mismatch");
+    }
+    validate_candidates(candidates);
+    if (out.size() != candidates.size()) {
+        throw std::invalid_argument("Output size must match the candidate count");
     }
+    page_in(candidates.data(), candidates.size());
+    candidate_logits(input.data(), candidates.data(), candidates.size(), out.data());
+    if (scores == TopKScore::Probability) {
+        kernels().softmax(out.data(), out.size());
+    }
+}
 
-    size_t param_idx = 0;
+std::vector<float> MultiClassClassifier::forward_candidates(const std::vector<float>& input,
+                                                            const std::vector<size_t>& candidates,
+                                                            TopKScore scores) const {
+    std::vector<float> out(candidates.size());
+    candidate_scores_into(Span<const float>(input), Span<const size_t>(candidates), Span<float>(out), scores);
+    return out;
+}
+
+std::vector<ClassScore> MultiClassClassifier::top_k_candidates(const std::vector<float>& input,
+                                                               const std::vector<size_t>& candidates,
+                                                               size_t k, TopKScore scores) const {
+    if (input.size() != input_size()) {
+        throw std::invalid_argument("Input size mismatch");
+    }
+    validate_candidates(Span<const size_t>(candidates));
+    if (k == 0 || k > candidates.size()) {
+        throw std::invalid_argument("Top-k size must be between 1 and the number of candidates");
+    }
+    page_in(candidates.data(), candidates.size());
 
-    // Set weights
-    for (size_t c = 0; c < num_classes_; ++c) {
-        for (size_t i = 0; i < input_size_; ++i) {
-            weights_[c][i] = parameters[param_idx++];
+    const KernelTable& kern = kernels();
+    const bool probabilities = scores == TopKScore::Probability;
+    std::vector<ClassScore> heap;
+    heap.reserve(k);
+    float logits[kTopKChunk];
+    float max = std::numeric_limits<float>::lowest();
+    float sum = 0.0f;
+    for (size_t c0 = 0; c0 < candidates.size(); c0 += kTopKChunk) {
+        const size_t count = std::min(kTopKChunk, candidates.size() - c0);
+        candidate_logits(input.data(), candidates.data() + c0, count, logits);
+        if (probabilities) {
+            kern.softmax_stats(logits, count, &max, &sum);
+        }
+        for (size_t j = 0; j < count; ++j) {
+            const ClassScore candidate{candidates[c0 + j], logits[j]};
+            if (heap.size() < k) {
+                heap.push_back(candidate);
+                std::push_heap(heap.begin(), heap.end(), ranks_above);
+            } else if (ranks_above(candidate, heap[0])) {
+                std::pop_heap(heap.begin(), heap.end(), ranks_above);
+                heap.back() = candidate;
+                std::push_heap(heap.begin(), heap.end(), ranks_above);
+            }
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), ranks_above);
+    if (probabilities) {
+        for (ClassScore& entry : heap) {
+            entry.score = std::exp(entry.score - max) / sum;
         }
     }
+    return heap;
+}
+
+// ---------------------------------------------------------------------------
+// Lazy paging
+
+void MultiClassClassifier::bind_parameters(WeightBlock block) {
+    GraphModel::bind_parameters(std::move(block));
 
-    // Set biases
-    for (size_t c = 0; c < num_classes_; ++c) {
-        biases_[c] = parameters[param_idx++];
+    auto pager = std::make_shared<ClassPager>();
+    const WeightRows rows = weight_rows(0);
+    pager->rows = rows.data;
+    pager->row_bytes = rows.row_bytes;
+    pager->classes = rows.rows;
+    pager->classes_per_block = std::max<size_t>(1, kClassPageBytes / rows.row_bytes);
+    pager->blocks = (rows.rows + pager->classes_per_block - 1) / pager->classes_per_block;
+    pager->file_backed = parameter_block().file_backed();
+    pager->paged.reset(new std::atomic<bool>[pager->blocks]);
+    for (size_t b = 0; b < pager->blocks; ++b) {
+        pager->paged[b].store(false, std::memory_order_relaxed);
+    }
+    pager_ = std::move(pager);
+    if (lazy_paging_ && pager_->file_backed) {
+        advise_mapped_pages(pager_->rows, pager_->classes * pager_->row_bytes, PageAdvice::Random);
     }
 }
 
-size_t MultiClassClassifier::input_size() const {
-    return input_size_;
+void MultiClassClassifier::set_lazy_paging(bool enabled) {
+    lazy_paging_ = enabled;
+    if (pager_ != nullptr && pager_->file_backed) {
+        advise_mapped_pages(pager_->rows, pager_->classes * pager_->row_bytes,
+                            enabled ? PageAdvice::Random : PageAdvice::Normal);
+    }
 }
 
-size_t MultiClassClassifier::output_size() const {
-    return num_classes_;
+void MultiClassClassifier::page_in(const size_t* classes, size_t count) const {
+    if (!lazy_paging_ || pager_ == nullptr || !pager_->file_backed) {
+        return;
+    }
+    const ClassPager& pager = *pager_;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t block = classes[i] / pager.classes_per_block;
+        // One caller wins each block; the check keeps the common case a load
+        if (!pager.paged[block].load(std::memory_order_relaxed) &&
+            !pager.paged[block].exchange(true, std::memory_order_relaxed)) {
+            advise_mapped_pages(pager.block_data(block), pager.block_bytes(block), PageAdvice::WillNeed);
+        }
+    }
 }
 
-std::string MultiClassClassifier::get_model_type() const {
-    return "Multi-Class Classifier (" + std::to_string(num_classes_) + " classes)";
+void MultiClassClassifier::prefetch_classes(Span<const size_t> classes) const {
+    validate_candidates(classes);
+    if (pager_ == nullptr || !pager_->file_backed) {
+        return;
+    }
+    const ClassPager& pager = *pager_;
+    for (size_t c : classes) {
+        const size_t block = c / pager.classes_per_block;
+        if (!pager.paged[block].exchange(true, std::memory_order_relaxed)) {
+            advise_mapped_pages(pager.block_data(block), pager.block_bytes(block), PageAdvice::WillNeed);
+        }
+    }
 }
 
+size_t MultiClassClassifier::release_class_pages() const {
+    if (pager_ == nullptr || !pager_->file_backed) {
+        return 0;
+    }
+    const ClassPager& pager = *pager_;
+    const size_t bytes = pager.classes * pager.row_bytes;
+    advise_mapped_pages(pager.rows, bytes, PageAdvice::DontNeed);
+    for (size_t b = 0; b < pager.blocks; ++b) {
+        pager.paged[b].store(false, std::memory_order_relaxed);
+    }
+    return bytes;
+}
+
+ClassPagingStats MultiClassClassifier::class_paging_stats() const {
+    ClassPagingStats stats;
+    stats.lazy = lazy_paging_;
+    if (pager_ == nullptr) {
+        return stats;
+    }
+    stats.file_backed = pager_->file_backed;
+    stats.classes_per_block = pager_->classes_per_block;
+    stats.blocks = pager_->blocks;
+    for (size_t b = 0; b < pager_->blocks; ++b) {
+        stats.paged_blocks += pager_->paged[b].load(std::memory_order_relaxed) ? 1 : 0;
+    }
+    return stats;
+}
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
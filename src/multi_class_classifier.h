@@ -5,33 +5,127 @@
 
 #pragma once
 
-#include "neural_network_interface.h"
+#include "graph_model.h"
+#include <memory>
 #include <vector>
 
 namespace ZeticML {
 
+// One entry of a top-k result
+struct ClassScore {
+    size_t index = 0;
+    float score = 0.0f;
+};
+
+// What top-k results report: the softmax probability of each selected class,
+// or its raw logit (ranking is identical; no exponential is evaluated)
+enum class TopKScore {
+    Probability,
+    Logit
+};
+
+// Lazy paging state of a classifier's class weights
+struct ClassPagingStats {
+    bool file_backed = false;       // Weights live in a .zetic mapping
+    bool lazy = false;              // set_lazy_paging() is on
+    size_t classes_per_block = 0;   // Paging granularity
+    size_t blocks = 0;
+    size_t paged_blocks = 0;        // Blocks paged in since the last release
+};
+
 /**
  * Multi-Class Classifier: Softmax-based classification for multiple classes
  * Uses linear transformations followed by softmax activation
  * Perfect for demonstrating interface flexibility with multiple outputs
+ *
+ * Preset graph: Dense (Rows kernel) with the softmax fused into it. Public
+ * order: [num_classes x input_size] weights row by row, then biases.
+ * Native layout: [num_classes x row_stride] weights with rows zero-padded to
+ * a multiple of 16 floats (every class row starts on a cache line), followed
+ * by [num_classes] biases. The SIMD logit kernels never pointer-chase.
+ * With fp16 / bf16 weight storage the weight rows hold 16-bit values (the
+ * section padded to 64 bytes) and the biases stay fp32.
+ *
+ * Top-k mode: top_k() / argmax() stream the logits through small stack
+ * chunks and a k-entry heap per sample instead of materialising and
+ * normalising all num_classes probabilities. Probabilities of the winners
+ * come from online softmax statistics and k exponentials; Logit scores and
+ * argmax() skip the exponentials entirely. No workspace is used.
+ *
+ * Candidate mode: *_candidates() score only the given classes (class ids
+ * into the full head), reading just their weight rows; probabilities are
+ * normalised over the candidate set. Cost and memory traffic follow the
+ * candidate count, not num_classes.
+ *
+ * Lazy paging: for weights mapped from a .zetic file, set_lazy_paging(true)
+ * turns off readahead on the class matrix and pages it in one class block
+ * (~64 KB of rows) at a time, the first time a candidate in the block is
+ * scored or prefetched. Resident memory then follows the classes a caller
+ * actually uses; release_class_pages() drops them all again. Full forward()
+ * and top_k() still work but fault in every block. Paging state belongs to
+ * the weights, so clones sharing them share it. Heap-backed weights are
+ * always resident and the paging calls are no-ops.
  */
-class MultiClassClassifier : public NeuralNetwork {
-private:
-    std::vector<std::vector<float>> weights_;  // [num_classes][input_size]
-    std::vector<float> biases_;                // [num_classes]
-    size_t input_size_;
-    size_t num_classes_;
-
+class MultiClassClassifier : public GraphModel {
 public:
     MultiClassClassifier(size_t input_size, size_t num_classes);
 
-    // Implementation of NeuralNetwork interface
-    std::vector<float> forward(const std::vector<float>& input) override;
-    void set_parameters(const std::vector<float>& parameters) override;
-    size_t input_size() const override;
-    size_t output_size() const override;
+    std::unique_ptr<NeuralNetwork> clone() const override;
     std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+    /**
+     * The k most likely classes, best first (ties go to the lower index)
+     * top_k_into writes k = out.size() entries, 1 <= k <= num_classes;
+     * top_k_batch writes batch_size x k entries, row by row
+     */
+    void top_k_into(Span<const float> input, Span<ClassScore> out,
+                    TopKScore scores = TopKScore::Probability) const;
+    void top_k_batch(const float* input, size_t batch_size, size_t k, ClassScore* out,
+                     TopKScore scores = TopKScore::Probability) const;
+    std::vector<ClassScore> top_k(const std::vector<float>& input, size_t k,
+                                  TopKScore scores = TopKScore::Probability) const;
+
+    // Most likely class (top-1 on the logits)
+    size_t argmax(const std::vector<float>& input) const;
+
+    /**
+     * Scores of the candidate classes, out[i] for candidates[i]
+     * Throws std::invalid_argument for an empty list, a class id out of
+     * range or out.size() != candidates.size().
+     */
+    void candidate_scores_into(Span<const float> input, Span<const size_t> candidates, Span<float> out,
+                               TopKScore scores = TopKScore::Probability) const;
+    std::vector<float> forward_candidates(const std::vector<float>& input, const std::vector<size_t>& candidates,
+                                          TopKScore scores = TopKScore::Probability) const;
+
+    // The k best of the (distinct) candidates, best first; 1 <= k <= candidates
+    std::vector<ClassScore> top_k_candidates(const std::vector<float>& input, const std::vector<size_t>& candidates,
+                                             size_t k, TopKScore scores = TopKScore::Probability) const;
+
+    void set_lazy_paging(bool enabled);
+    // Page in the blocks holding these classes ahead of use
+    void prefetch_classes(Span<const size_t> classes) const;
+    // Drop every resident class block; returns the bytes released
+    size_t release_class_pages() const;
+    ClassPagingStats class_paging_stats() const;
+
+    void bind_parameters(WeightBlock block) override;
+
+private:
+    struct ClassPager;
+
+    void select_top_k(const float* input, size_t batch_size, size_t k, ClassScore* out,
+                      TopKScore scores) const;
+    void validate_candidates(Span<const size_t> candidates) const;
+    void candidate_logits(const float* x, const size_t* candidates, size_t count, float* out) const;
+    void page_in(const size_t* classes, size_t count) const;
+
+    std::shared_ptr<ClassPager> pager_;     // Null until weights are bound
+    bool lazy_paging_ = false;
 };
 
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
+
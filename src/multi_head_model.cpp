@@ -0,0 +1,159 @@
+/**
+ * ZeticML Assignment - Fused Multi-Head Model Implementation
+ */
+
+#include "multi_head_model.h"
+#include "kernels.h"
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+size_t total_width(const std::vector<ModelHead>& heads) {
+    size_t total = 0;
+    for (const ModelHead& head : heads) {
+        if (head.width == 0) {
+            throw std::invalid_argument("Model head width must be positive");
+        }
+        total += head.width;
+    }
+    if (total == 0) {
+        throw std::invalid_argument("MultiHeadModel needs at least one head");
+    }
+    return total;
+}
+
+LayerGraph multi_head_graph(size_t input_size, const std::vector<ModelHead>& heads) {
+    LayerGraph graph(input_size);
+    graph.dense(graph.input(), total_width(heads), WeightOrder::OutputMajor, DenseKernel::Rows);
+    return graph;
+}
+
+// Head of one model: linear / logistic put [w, b] and multiclass [W, b]
+// (both output major) in their public vector
+ModelHead head_of(const NeuralNetwork& model) {
+    const std::string type = model.type_name();
+    if (type == "linear") {
+        return ModelHead{1, HeadActivation::Identity};
+    }
+    if (type == "logistic") {
+        return ModelHead{1, HeadActivation::Sigmoid};
+    }
+    if (type == "multiclass") {
+        return ModelHead{model.output_size(), HeadActivation::Softmax};
+    }
+    throw std::invalid_argument("Model type " + type + " cannot be fused into a multi-head model");
+}
+
+} // namespace
+
+MultiHeadModel::MultiHeadModel(size_t input_size, std::vector<ModelHead> heads)
+    : GraphModel(multi_head_graph(input_size, heads)), heads_(std::move(heads)) {
+    size_t offset = 0;
+    for (ModelHead& head : heads_) {
+        head.offset = offset;
+        offset += head.width;
+    }
+}
+
+std::unique_ptr<MultiHeadModel> MultiHeadModel::fuse(const std::vector<const NeuralNetwork*>& models) {
+    if (models.empty()) {
+        throw std::invalid_argument("MultiHeadModel needs at least one head");
+    }
+    const size_t inputs = models.front()->input_size();
+    std::vector<ModelHead> heads;
+    for (const NeuralNetwork* model : models) {
+        if (model->input_size() != inputs) {
+            throw std::invalid_argument("Fused models must share an input size");
+        }
+        heads.push_back(head_of(*model));
+    }
+    auto fused = std::make_unique<MultiHeadModel>(inputs, heads);
+
+    // Weight rows of every head first, then all the biases
+    std::vector<float> parameters(fused->graph().parameter_count());
+    float* weights = parameters.data();
+    float* biases = parameters.data() + fused->output_size() * inputs;
+    for (size_t h = 0; h < models.size(); ++h) {
+        const std::vector<float> source = models[h]->get_parameters();
+        const size_t rows = heads[h].width;
+        std::copy(source.begin(), source.begin() + rows * inputs, weights);
+        std::copy(source.begin() + rows * inputs, source.end(), biases);
+        weights += rows * inputs;
+        biases += rows;
+    }
+    fused->set_parameters(std::move(parameters));
+    return fused;
+}
+
+Span<const float> MultiHeadModel::head_output(Span<const float> output, size_t head) const {
+    if (head >= heads_.size()) {
+        throw std::invalid_argument("Head index out of range");
+    }
+    if (output.size() != output_size()) {
+        throw std::invalid_argument("Output size mismatch");
+    }
+    return output.subspan(heads_[head].offset, heads_[head].width);
+}
+
+std::vector<std::vector<float>> MultiHeadModel::forward_heads(const std::vector<float>& input) const {
+    const std::vector<float> output = forward(input);
+    std::vector<std::vector<float>> results;
+    results.reserve(heads_.size());
+    for (const ModelHead& head : heads_) {
+        results.emplace_back(output.begin() + head.offset, output.begin() + head.offset + head.width);
+    }
+    return results;
+}
+
+void MultiHeadModel::run(const float* input, float* output, InferenceContext& context) const {
+    GraphModel::run(input, output, context);
+    apply_activations(output, 1);
+}
+
+void MultiHeadModel::run_batch(const float* input, size_t batch_size, float* output,
+                               InferenceContext& context) const {
+    GraphModel::run_batch(input, batch_size, output, context);
+    apply_activations(output, batch_size);
+}
+
+void MultiHeadModel::apply_activations(float* output, size_t batch_size) const {
+    // Rows are still cache resident from the matvec that produced them
+    const KernelTable& k = kernels();
+    const size_t width = output_size();
+    for (size_t r = 0; r < batch_size; ++r) {
+        float* row = output + r * width;
+        for (const ModelHead& head : heads_) {
+            switch (head.activation) {
+                case HeadActivation::Identity:
+                    break;
+                case HeadActivation::Sigmoid:
+                    k.sigmoid(row + head.offset, head.width);
+                    break;
+                case HeadActivation::Softmax:
+                    k.softmax(row + head.offset, head.width);
+                    break;
+            }
+        }
+    }
+}
+
+std::unique_ptr<NeuralNetwork> MultiHeadModel::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<MultiHeadModel>(*this);
+}
+
+std::string MultiHeadModel::get_model_type() const {
+    return "Multi-Head Model (" + std::to_string(heads_.size()) + " heads)";
+}
+
+std::string MultiHeadModel::type_name() const {
+    return "multihead";
+}
+
+std::vector<size_t> MultiHeadModel::dimensions() const {
+    return {input_size(), output_size()};
+}
+
+} // namespace ZeticML
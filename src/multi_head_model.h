@@ -0,0 +1,76 @@
+/**
+ * ZeticML Assignment - Fused Multi-Head Model
+ * Several single-layer heads over one input, evaluated in one stacked pass
+ */
+
+#pragma once
+
+#include "graph_model.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+enum class HeadActivation {
+    Identity,   // Linear regression
+    Sigmoid,    // Logistic regression
+    Softmax     // Multi-class classifier
+};
+
+struct ModelHead {
+    size_t width = 0;
+    HeadActivation activation = HeadActivation::Identity;
+    size_t offset = 0;          // First output column (filled in by the model)
+};
+
+/**
+ * Single-layer heads sharing one input, stacked into one Dense layer
+ * All heads' weight rows form one [total_width x input_size] matrix (Rows
+ * kernel, rows padded to the SIMD width), so a forward pass streams the
+ * input once and runs one class-blocked matvec over every head instead of
+ * one virtual call and input pass per model. Each head's activation is
+ * then applied in place to its own slice of the output, which holds the
+ * heads' outputs side by side in head order.
+ *
+ * Public parameter order: the stacked [total_width x input_size] weights
+ * row by row (head by head), then the total_width biases. fuse() builds a
+ * model from existing LinearRegression, LogisticRegression and
+ * MultiClassClassifier instances (including their fixed-shape variants).
+ */
+class MultiHeadModel : public GraphModel {
+public:
+    MultiHeadModel(size_t input_size, std::vector<ModelHead> heads);
+
+    /**
+     * Stack the given models' weights; they must share input_size and be of
+     * type linear, logistic or multiclass (std::invalid_argument otherwise)
+     */
+    static std::unique_ptr<MultiHeadModel> fuse(const std::vector<const NeuralNetwork*>& models);
+
+    const std::vector<ModelHead>& heads() const { return heads_; }
+    size_t num_heads() const { return heads_.size(); }
+
+    // Head h's slice of a full output row
+    Span<const float> head_output(Span<const float> output, size_t head) const;
+
+    // One vector per head
+    std::vector<std::vector<float>> forward_heads(const std::vector<float>& input) const;
+
+    std::unique_ptr<NeuralNetwork> clone() const override;
+    std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+protected:
+    void run(const float* input, float* output, InferenceContext& context) const override;
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   InferenceContext& context) const override;
+
+private:
+    void apply_activations(float* output, size_t batch_size) const;
+
+    std::vector<ModelHead> heads_;
+};
+
+} // namespace ZeticML
@@ -5,6 +5,12 @@
 
 #pragma once
 
+#include "span.h"
+#include "weight_block.h"
+#include "inference_context.h"
+#include "half_precision.h"
+#include "instrumentation.h"
+#include <stdexcept>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -18,7 +24,15 @@ namespace ZeticML {
  *
  * Design choices:
  * - Pure numeric interface (std::vector<float>) for simplicity
+ * - Batched path (forward_batch) over caller-owned row-major buffers
+ * - Allocation-free path (forward_into) over non-owning spans; forward() is a
+ *   convenience wrapper that allocates the output vector
  * - Separates model loading (set_parameters) from inference (forward)
+ * - Inference is const: one model serves any number of threads, each with its
+ *   own InferenceContext for scratch memory (a thread-local one by default);
+ *   binding new parameters must not race with inference on the same object
+ * - Parameters live in an immutable native-layout WeightBlock that can be
+ *   shared or memory-mapped (bind_parameters)
  * - Provides metadata (input/output sizes, model type)
  * - Enables polymorphic usage of different implementations
  */
@@ -26,23 +40,188 @@ class NeuralNetwork {
 public:
     virtual ~NeuralNetwork() = default;
 
-    // Core inference function - numeric input -> numeric output
-    virtual std::vector<float> forward(const std::vector<float>& input) = 0;
+    // Core inference function - writes output_size() floats into output
+    // Steady state performs no heap allocation
+    void forward_into(Span<const float> input, Span<float> output, InferenceContext& context) const {
+        if (input.size() != input_size()) {
+            throw std::invalid_argument("Input size mismatch");
+        }
+        if (output.size() != output_size()) {
+            throw std::invalid_argument("Output size mismatch");
+        }
+        ZETIC_INSTRUMENT_SCOPE(record, instrumentation_scope(), 1,
+                               (input.size() + output.size()) * sizeof(float));
+        run(input.data(), output.data(), context);
+    }
+
+    void forward_into(Span<const float> input, Span<float> output) const {
+        forward_into(input, output, InferenceContext::thread_default());
+    }
+
+    // Convenience wrapper - numeric input -> numeric output
+    std::vector<float> forward(const std::vector<float>& input) const {
+        std::vector<float> output(output_size());
+        forward_into(Span<const float>(input), Span<float>(output));
+        return output;
+    }
+
+    /**
+     * Batched inference over contiguous row-major buffers
+     * input:  batch_size x input_size() floats
+     * output: batch_size x output_size() floats, owned by the caller
+     */
+    void forward_batch(const float* input, size_t batch_size, float* output,
+                       InferenceContext& context) const {
+        if (batch_size > 0 && (input == nullptr || output == nullptr)) {
+            throw std::invalid_argument("Null batch buffer");
+        }
+        if (batch_size > 0) {
+            ZETIC_INSTRUMENT_SCOPE(record, instrumentation_scope(), batch_size,
+                                   batch_size * (input_size() + output_size()) * sizeof(float));
+            run_batch(input, batch_size, output, context);
+        }
+    }
+
+    void forward_batch(const float* input, size_t batch_size, float* output) const {
+        forward_batch(input, batch_size, output, InferenceContext::thread_default());
+    }
+
+    // New model of the same type and shape sharing this model's weights
+    virtual std::unique_ptr<NeuralNetwork> clone() const = 0;
+
+    // Set model parameters (weights, biases) in the documented public order
+    virtual void set_parameters(const std::vector<float>& parameters) {
+        bind_parameters(pack_parameters(Span<const float>(parameters)));
+    }
+
+    // Same, adopting the buffer: models whose native layout equals the public
+    // order keep it without copying
+    virtual void set_parameters(std::vector<float>&& parameters) {
+        bind_parameters(adopt_parameters(WeightBlock::adopt(std::move(parameters))));
+    }
+
+    // Same, attaching an immutable shared array of `size` floats; replicas
+    // given the same array share one copy where the layout allows
+    void set_parameters(std::shared_ptr<const float[]> parameters, size_t size) {
+        bind_parameters(adopt_parameters(WeightBlock(std::move(parameters), size)));
+    }
+
+    // Run on another model's weights (same type and shape), sharing its block
+    void share_parameters(const NeuralNetwork& other) {
+        bind_parameters(other.parameter_block());
+    }
+
+    /**
+     * Native parameter layout
+     * Each model runs directly on one WeightBlock whose layout may differ from
+     * the public parameter order (padded rows, GEMM panels). pack_parameters()
+     * copies public parameters into that layout without touching the model;
+     * adopt_parameters() does the same for a public-order block and returns it
+     * unchanged when no repacking is needed. bind_parameters() adopts an
+     * existing native block without copying it.
+     */
+    virtual WeightBlock pack_parameters(Span<const float> parameters) const = 0;
+    virtual WeightBlock adopt_parameters(WeightBlock parameters) const {
+        return pack_parameters(Span<const float>(parameters.data(), parameters.size()));
+    }
+    virtual void bind_parameters(WeightBlock block) = 0;
+    virtual const WeightBlock& parameter_block() const = 0;
 
-    // Set model parameters (weights, biases)
-    virtual void set_parameters(const std::vector<float>& parameters) = 0;
+    // Current parameters in the public order (inverse of set_parameters)
+    virtual std::vector<float> get_parameters() const = 0;
+
+    /**
+     * Storage precision of the weights (biases always stay fp32)
+     * set_weight_precision() re-stores the current parameters and applies to
+     * later set_parameters() calls; blocks given to bind_parameters() must
+     * already use it. Models without 16-bit kernels accept only Float32 and
+     * throw std::invalid_argument otherwise. Must not race with inference.
+     */
+    virtual WeightPrecision weight_precision() const { return WeightPrecision::Float32; }
+    virtual void set_weight_precision(WeightPrecision precision) {
+        if (precision != WeightPrecision::Float32) {
+            throw std::invalid_argument("Model type " + type_name() + " stores fp32 weights only");
+        }
+    }
+
+    /**
+     * Activation memory
+     * workspace_size() is the number of floats inference over batch_size rows
+     * takes from the context's workspace (0 for models without
+     * intermediates). prepare() sizes a context for batches of up to
+     * max_batch_size rows up front, so not even the first call allocates.
+     */
+    virtual size_t workspace_size(size_t batch_size) const {
+        (void)batch_size;
+        return 0;
+    }
+
+    void prepare(InferenceContext& context, size_t max_batch_size = 1) const {
+        context.workspace().reserve(workspace_size(max_batch_size));
+    }
+
+    void prepare(size_t max_batch_size = 1) const {
+        prepare(InferenceContext::thread_default(), max_batch_size);
+    }
+
+    // Peak bytes of intermediate activations for one call over batch_size rows
+    size_t peak_activation_bytes(size_t batch_size = 1) const {
+        return workspace_size(batch_size) * sizeof(float);
+    }
 
     // Model metadata
     virtual size_t input_size() const = 0;
     virtual size_t output_size() const = 0;
     virtual std::string get_model_type() const = 0;
 
+    // Registry type name ("linear", "logistic", "multiclass", "mlp") and
+    // constructor dimensions, enough to recreate an empty model of this shape
+    virtual std::string type_name() const = 0;
+    virtual std::vector<size_t> dimensions() const = 0;
+
+    // Instrumentation scope name: type name and dimensions, e.g. "mlp/8x16x4"
+    // (see StatsSink; layers of graph models add "/<step>:<summary>")
+    std::string instrumentation_name() const {
+        std::string name = type_name();
+        const std::vector<size_t> dims = dimensions();
+        for (size_t i = 0; i < dims.size(); ++i) {
+            name += i == 0 ? '/' : 'x';
+            name += std::to_string(dims[i]);
+        }
+        return name;
+    }
+
     // Optional: Model information
     virtual void print_info() const {
         std::cout << "Model: " << get_model_type()
                   << " (Input: " << input_size()
                   << ", Output: " << output_size() << ")" << std::endl;
     }
+
+protected:
+    // Implementations; sizes and pointers are already validated
+    virtual void run(const float* input, float* output, InferenceContext& context) const = 0;
+    virtual void run_batch(const float* input, size_t batch_size, float* output,
+                           InferenceContext& context) const = 0;
+
+    // For wrappers forwarding to another model with already validated buffers
+    static void run_model(const NeuralNetwork& model, const float* input, float* output,
+                          InferenceContext& context) {
+        model.run(input, output, context);
+    }
+    static void run_model_batch(const NeuralNetwork& model, const float* input, size_t batch_size,
+                                float* output, InferenceContext& context) {
+        model.run_batch(input, batch_size, output, context);
+    }
+
+#if ZETIC_ENABLE_INSTRUMENTATION
+    uint32_t instrumentation_scope() const {
+        return stats_scope_.get([this] { return instrumentation_name(); });
+    }
+
+private:
+    LazyScope stats_scope_;
+#endif
 };
 
 // Factory functions are now declared in individual implementation headers
@@ -0,0 +1,49 @@
+/**
+ * ZeticML Assignment - Parallel Batch Inference Implementation
+ */
+
+#include "parallel_inference.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+constexpr size_t kTileBytes = 128 * 1024;
+constexpr size_t kTilesPerThread = 4;
+constexpr size_t kMinTileRows = 16;
+
+} // namespace
+
+size_t choose_rows_per_tile(const NeuralNetwork& model, size_t batch_size, size_t participants) {
+    if (batch_size == 0) {
+        return 1;
+    }
+    const size_t row_bytes = (model.input_size() + model.output_size()) * sizeof(float);
+    const size_t cache_rows = std::max<size_t>(1, kTileBytes / std::max<size_t>(row_bytes, 1));
+
+    const size_t tiles = std::max<size_t>(1, participants) * kTilesPerThread;
+    const size_t balance_rows = (batch_size + tiles - 1) / tiles;
+
+    const size_t rows = std::max(kMinTileRows, std::min(cache_rows, balance_rows));
+    return std::min(rows, batch_size);
+}
+
+void parallel_forward_batch(const NeuralNetwork& model, const float* input, size_t batch_size,
+                            float* output, ThreadPool& pool, size_t rows_per_tile) {
+    if (batch_size > 0 && (input == nullptr || output == nullptr)) {
+        throw std::invalid_argument("Null batch buffer");
+    }
+    if (rows_per_tile == 0) {
+        rows_per_tile = choose_rows_per_tile(model, batch_size, pool.size());
+    }
+
+    const size_t in = model.input_size();
+    const size_t out = model.output_size();
+    pool.parallel_for(0, batch_size, rows_per_tile, [&](size_t begin, size_t end) {
+        model.forward_batch(input + begin * in, end - begin, output + begin * out);
+    });
+}
+
+} // namespace ZeticML
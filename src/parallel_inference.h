@@ -0,0 +1,32 @@
+/**
+ * ZeticML Assignment - Parallel Batch Inference
+ * Splits large batches into row tiles run on a ThreadPool
+ */
+
+#pragma once
+
+#include "neural_network_interface.h"
+#include "thread_pool.h"
+#include <cstddef>
+
+namespace ZeticML {
+
+/**
+ * Rows per tile for a batch of batch_size rows on `participants` threads
+ * A tile's input and output rows stay within about half of a typical L2
+ * (128 KB), there are at least four tiles per thread for load balancing,
+ * and tiles never drop below 16 rows so per-tile weight traffic stays
+ * amortized.
+ */
+size_t choose_rows_per_tile(const NeuralNetwork& model, size_t batch_size, size_t participants);
+
+/**
+ * forward_batch() over the pool: same inputs, outputs and validation as the
+ * serial call, with row tiles processed in parallel. Each thread uses its
+ * own thread-local InferenceContext. rows_per_tile = 0 picks the heuristic.
+ */
+void parallel_forward_batch(const NeuralNetwork& model, const float* input, size_t batch_size,
+                            float* output, ThreadPool& pool = ThreadPool::shared(),
+                            size_t rows_per_tile = 0);
+
+} // namespace ZeticML
@@ -0,0 +1,486 @@
+/**
+ * ZeticML Assignment - INT8 Post-Training Quantization Implementation
+ */
+
+#include "quantization.h"
+#include "int8_kernels.h"
+#include "kernels.h"
+#include "aligned_buffer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+constexpr float kInt8Max = 127.0f;
+
+// Rows quantized and pushed through the layers together by run_batch()
+constexpr size_t kRowTile = 32;
+
+// Weight bytes per class block: a block stays cache-resident while every
+// row of the tile is multiplied with it
+constexpr size_t kClassBlockBytes = 256 * 1024;
+
+size_t align_bytes(size_t bytes) {
+    return (bytes + kSimdAlignment - 1) / kSimdAlignment * kSimdAlignment;
+}
+
+float scale_for(float max_abs) {
+    return max_abs > 0.0f ? max_abs / kInt8Max : 1.0f;
+}
+
+int8_t quantize_value(float x, float inv_scale) {
+    const float q = std::nearbyint(x * inv_scale);
+    return static_cast<int8_t>(std::min(kInt8Max, std::max(-kInt8Max, q)));
+}
+
+// rows x n floats (leading dimension ld) -> rows x stride int8, zero-padded
+void quantize_rows(const float* src, size_t rows, size_t n, size_t ld, float scale,
+                   int8_t* dst, size_t stride) {
+    const float inv_scale = 1.0f / scale;
+    for (size_t r = 0; r < rows; ++r) {
+        const float* x = src + r * ld;
+        int8_t* q = dst + r * stride;
+        for (size_t i = 0; i < n; ++i) {
+            q[i] = quantize_value(x[i], inv_scale);
+        }
+        std::memset(q + n, 0, stride - n);
+    }
+}
+
+const char* base_description(const std::string& base_type) {
+    if (base_type == "linear") return "Linear Regression";
+    if (base_type == "logistic") return "Logistic Regression";
+    if (base_type == "multiclass") return "Multi-Class Classifier";
+    return "Two-Layer MLP";
+}
+
+} // namespace
+
+QuantizedModel::QuantizedModel(const std::string& base_type, const std::vector<size_t>& dimensions)
+    : base_type_(base_type), dims_(dimensions) {
+    auto add_layer = [this](size_t in, size_t out, size_t pub_weights,
+                            size_t pub_out_step, size_t pub_in_step) {
+        Layer layer;
+        layer.in = in;
+        layer.out = out;
+        layer.stride = round_up_to_int8_block(in);
+        layer.pub_weights = pub_weights;
+        layer.pub_out_step = pub_out_step;
+        layer.pub_in_step = pub_in_step;
+        layer.pub_biases = pub_weights + in * out;
+        layers_.push_back(layer);
+    };
+
+    if ((base_type == "linear" || base_type == "logistic") && dims_.size() == 1) {
+        // [weights(I), bias]
+        add_layer(dims_[0], 1, 0, 0, 1);
+        activation_ = base_type == "logistic" ? Activation::Sigmoid : Activation::Identity;
+    } else if (base_type == "multiclass" && dims_.size() == 2) {
+        // [W (C x I), b (C)]
+        add_layer(dims_[0], dims_[1], 0, dims_[0], 1);
+        activation_ = Activation::Softmax;
+    } else if (base_type == "mlp" && dims_.size() == 3) {
+        // [W1 (I x H), b1 (H), W2 (H x O), b2 (O)]; weights are input-major
+        const size_t I = dims_[0], H = dims_[1], O = dims_[2];
+        add_layer(I, H, 0, 1, H);
+        add_layer(H, O, I * H + H, 1, O);
+        activation_ = Activation::Identity;
+    } else {
+        throw std::invalid_argument("Cannot quantize model type: " + base_type);
+    }
+
+    // Layout: activation scales, then per layer weights / scales / biases
+    size_t offset = align_bytes(layers_.size() * sizeof(float));
+    for (Layer& layer : layers_) {
+        layer.weights = offset;
+        offset += align_bytes(layer.out * layer.stride);
+        layer.scales = offset;
+        offset += align_bytes(layer.out * sizeof(float));
+        layer.biases = offset;
+        offset += align_bytes(layer.out * sizeof(float));
+    }
+    block_bytes_ = offset;
+
+    pending_scales_.assign(layers_.size(), 1.0f);
+    float* dst = nullptr;
+    params_ = WeightBlock::allocate(block_bytes_ / sizeof(float), dst);
+    std::copy(pending_scales_.begin(), pending_scales_.end(), dst);
+}
+
+void QuantizedModel::set_activation_scales(const std::vector<float>& scales) {
+    if (scales.size() != layers_.size()) {
+        throw std::invalid_argument("Activation scale count mismatch");
+    }
+    for (float s : scales) {
+        if (!(s > 0.0f) || !std::isfinite(s)) {
+            throw std::invalid_argument("Activation scales must be positive");
+        }
+    }
+    pending_scales_ = scales;
+}
+
+std::vector<float> QuantizedModel::activation_scales() const {
+    return std::vector<float>(params_.data(), params_.data() + layers_.size());
+}
+
+const int8_t* QuantizedModel::layer_weights(const Layer& layer) const {
+    return reinterpret_cast<const int8_t*>(params_.data()) + layer.weights;
+}
+
+const float* QuantizedModel::layer_scales(const Layer& layer) const {
+    return params_.data() + layer.scales / sizeof(float);
+}
+
+const float* QuantizedModel::layer_biases(const Layer& layer) const {
+    return params_.data() + layer.biases / sizeof(float);
+}
+
+size_t QuantizedModel::public_parameter_count() const {
+    const Layer& last = layers_.back();
+    return last.pub_biases + last.out;
+}
+
+WeightBlock QuantizedModel::pack_parameters(Span<const float> parameters) const {
+    if (parameters.size() != public_parameter_count()) {
+        throw std::invalid_argument("Parameter size mismatch");
+    }
+
+    float* dst = nullptr;
+    WeightBlock block = WeightBlock::allocate(block_bytes_ / sizeof(float), dst);
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(dst);
+    std::copy(pending_scales_.begin(), pending_scales_.end(), dst);
+
+    for (const Layer& layer : layers_) {
+        int8_t* weights = reinterpret_cast<int8_t*>(bytes + layer.weights);
+        float* scales = reinterpret_cast<float*>(bytes + layer.scales);
+        float* biases = reinterpret_cast<float*>(bytes + layer.biases);
+
+        for (size_t o = 0; o < layer.out; ++o) {
+            const float* w = parameters.data() + layer.pub_weights + o * layer.pub_out_step;
+
+            // Symmetric per-output-channel scale
+            float max_abs = 0.0f;
+            for (size_t i = 0; i < layer.in; ++i) {
+                max_abs = std::max(max_abs, std::abs(w[i * layer.pub_in_step]));
+            }
+            scales[o] = scale_for(max_abs);
+
+            const float inv_scale = 1.0f / scales[o];
+            int8_t* row = weights + o * layer.stride;
+            for (size_t i = 0; i < layer.in; ++i) {
+                row[i] = quantize_value(w[i * layer.pub_in_step], inv_scale);
+            }
+            biases[o] = parameters[layer.pub_biases + o];
+        }
+    }
+    return block;
+}
+
+void QuantizedModel::bind_parameters(WeightBlock block) {
+    if (block.size_bytes() != block_bytes_) {
+        throw std::invalid_argument("Parameter size mismatch");
+    }
+    params_ = std::move(block);
+    pending_scales_ = activation_scales();
+}
+
+const WeightBlock& QuantizedModel::parameter_block() const {
+    return params_;
+}
+
+std::vector<float> QuantizedModel::get_parameters() const {
+    std::vector<float> parameters(public_parameter_count());
+    for (const Layer& layer : layers_) {
+        const int8_t* weights = layer_weights(layer);
+        const float* scales = layer_scales(layer);
+        const float* biases = layer_biases(layer);
+        for (size_t o = 0; o < layer.out; ++o) {
+            float* w = parameters.data() + layer.pub_weights + o * layer.pub_out_step;
+            for (size_t i = 0; i < layer.in; ++i) {
+                w[i * layer.pub_in_step] = weights[o * layer.stride + i] * scales[o];
+            }
+            parameters[layer.pub_biases + o] = biases[o];
+        }
+    }
+    return parameters;
+}
+
+void QuantizedModel::apply_layer(const Layer& layer, const int8_t* q_input, size_t rows,
+                                 float* output, int32_t* acc) const {
+    const Int8KernelTable& k = int8_kernels();
+    const int8_t* weights = layer_weights(layer);
+    const float* scales = layer_scales(layer);
+    const float* biases = layer_biases(layer);
+    const float input_scale = params_.data()[&layer - layers_.data()];
+
+    // Class blocks outer, rows inner: each block of int8 rows is read from
+    // memory once per tile
+    size_t block = std::max<size_t>(1, kClassBlockBytes / layer.stride);
+    block = std::min(block, layer.out);
+
+    for (size_t c0 = 0; c0 < layer.out; c0 += block) {
+        const size_t classes = std::min(block, layer.out - c0);
+        for (size_t r = 0; r < rows; ++r) {
+            k.matvec(weights + c0 * layer.stride, layer.stride, classes,
+                     q_input + r * layer.stride, layer.stride, acc);
+            float* y = output + r * layer.out + c0;
+            for (size_t c = 0; c < classes; ++c) {
+                y[c] = static_cast<float>(acc[c]) * (input_scale * scales[c0 + c]) + biases[c0 + c];
+            }
+        }
+    }
+}
+
+QuantizedModel::Scratch QuantizedModel::scratch_layout(size_t tile) const {
+    size_t max_stride = 0, max_out = 0;
+    for (const Layer& layer : layers_) {
+        max_stride = std::max(max_stride, layer.stride);
+        max_out = std::max(max_out, layer.out);
+    }
+    Scratch scratch;
+    scratch.q_words = (tile * max_stride + sizeof(float) - 1) / sizeof(float);
+    scratch.acc_words = max_out;
+    scratch.hidden_words = layers_.size() == 2 ? tile * layers_.front().out : 0;
+    return scratch;
+}
+
+size_t QuantizedModel::workspace_size(size_t batch_size) const {
+    return scratch_layout(std::min(kRowTile, batch_size)).total();
+}
+
+void QuantizedModel::run(const float* input, float* output, InferenceContext& context) const {
+    run_batch(input, 1, output, context);
+}
+
+void QuantizedModel::run_batch(const float* input, size_t batch_size, float* output,
+                               InferenceContext& context) const {
+    const Layer& first = layers_.front();
+    const Layer& last = layers_.back();
+    const bool two_layers = layers_.size() == 2;
+    const size_t tile = std::min(kRowTile, batch_size);
+
+    const Scratch layout = scratch_layout(tile);
+    float* scratch = context.workspace().acquire(layout.total());
+    int8_t* q = reinterpret_cast<int8_t*>(scratch);
+    int32_t* acc = reinterpret_cast<int32_t*>(scratch + layout.q_words);
+    float* hidden = scratch + layout.q_words + layout.acc_words;
+
+    const float* scales = params_.data();
+    const KernelTable& fk = kernels();
+
+    for (size_t r0 = 0; r0 < batch_size; r0 += tile) {
+        const size_t rows = std::min(tile, batch_size - r0);
+        float* out = output + r0 * last.out;
+
+        quantize_rows(input + r0 * first.in, rows, first.in, first.in, scales[0], q, first.stride);
+        if (two_layers) {
+            apply_layer(first, q, rows, hidden, acc);
+            for (size_t i = 0; i < rows * first.out; ++i) {
+                hidden[i] = std::max(0.0f, hidden[i]);
+            }
+            quantize_rows(hidden, rows, last.in, last.in, scales[1], q, last.stride);
+        }
+        apply_layer(last, q, rows, out, acc);
+
+        if (activation_ == Activation::Sigmoid) {
+            fk.sigmoid(out, rows * last.out);
+        } else if (activation_ == Activation::Softmax) {
+            for (size_t r = 0; r < rows; ++r) {
+                fk.softmax(out + r * last.out, last.out);
+            }
+        }
+    }
+}
+
+std::unique_ptr<NeuralNetwork> QuantizedModel::clone() const {
+    // Copies share the (immutable) parameter block
+    return std::make_unique<QuantizedModel>(*this);
+}
+
+size_t QuantizedModel::input_size() const {
+    return layers_.front().in;
+}
+
+size_t QuantizedModel::output_size() const {
+    return layers_.back().out;
+}
+
+std::string QuantizedModel::get_model_type() const {
+    return std::string("INT8 ") + base_description(base_type_);
+}
+
+std::string QuantizedModel::type_name() const {
+    return "int8-" + base_type_;
+}
+
+std::vector<size_t> QuantizedModel::dimensions() const {
+    return dims_;
+}
+
+// ---------------- Calibration ----------------
+
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model,
+                                               const float* calibration_inputs, size_t num_samples) {
+    if (num_samples == 0 || calibration_inputs == nullptr) {
+        throw std::invalid_argument("Calibration set is empty");
+    }
+
+    auto quantized = std::make_unique<QuantizedModel>(model.type_name(), model.dimensions());
+    const std::vector<float> parameters = model.get_parameters();
+    const size_t I = model.input_size();
+
+    float input_max = 0.0f;
+    for (size_t i = 0; i < num_samples * I; ++i) {
+        input_max = std::max(input_max, std::abs(calibration_inputs[i]));
+    }
+    std::vector<float> scales = {scale_for(input_max)};
+
+    if (quantized->num_layers() == 2) {
+        // Hidden activations of the fp32 model: ReLU(x * W1 + b1)
+        const size_t H = model.dimensions()[1];
+        const float* W1 = parameters.data();
+        const float* b1 = W1 + I * H;
+        float hidden_max = 0.0f;
+        std::vector<float> hidden(H);
+        for (size_t s = 0; s < num_samples; ++s) {
+            const float* x = calibration_inputs + s * I;
+            std::copy(b1, b1 + H, hidden.begin());
+            for (size_t i = 0; i < I; ++i) {
+                for (size_t h = 0; h < H; ++h) {
+                    hidden[h] += x[i] * W1[i * H + h];
+                }
+            }
+            for (float v : hidden) {
+                hidden_max = std::max(hidden_max, v);
+            }
+        }
+        scales.push_back(scale_for(hidden_max));
+    }
+
+    quantized->set_activation_scales(scales);
+    quantized->set_parameters(parameters);
+    return quantized;
+}
+
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model,
+                                               const std::vector<TestCase>& calibration) {
+    const size_t I = model.input_size();
+    std::vector<float> inputs;
+    inputs.reserve(calibration.size() * I);
+    for (const TestCase& test_case : calibration) {
+        if (test_case.input.size() != I) {
+            throw std::invalid_argument("Calibration input size mismatch");
+        }
+        inputs.insert(inputs.end(), test_case.input.begin(), test_case.input.end());
+    }
+    return quantize_model(model, inputs.data(), calibration.size());
+}
+
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model, const DatasetFile& calibration) {
+    if (calibration.input_size() != model.input_size()) {
+        throw std::invalid_argument("Calibration input size mismatch");
+    }
+    return quantize_model(model, calibration.inputs(), calibration.rows());
+}
+
+// ---------------- Accuracy report ----------------
+
+namespace {
+
+// input_of(r) / expected_of(r) give row r; expected rows of the wrong width
+// (usually empty) only count toward the fp32 / int8 comparison
+template <class InputOf, class ExpectedOf>
+QuantizationReport evaluate_rows(const NeuralNetwork& reference, const NeuralNetwork& quantized,
+                                 size_t rows, InputOf&& input_of, ExpectedOf&& expected_of) {
+    if (reference.input_size() != quantized.input_size() ||
+        reference.output_size() != quantized.output_size()) {
+        throw std::invalid_argument("Model shapes differ");
+    }
+
+    QuantizationReport report;
+    report.fp32_weight_bytes = reference.parameter_block().size_bytes();
+    report.int8_weight_bytes = quantized.parameter_block().size_bytes();
+
+    const size_t O = reference.output_size();
+    std::vector<float> expected_fp32(O), actual_int8(O);
+    double abs_sum = 0.0, fp32_sum = 0.0, int8_sum = 0.0;
+    size_t agree = 0, labelled_values = 0;
+
+    for (size_t r = 0; r < rows; ++r) {
+        const Span<const float> input = input_of(r);
+        reference.forward_into(input, Span<float>(expected_fp32));
+        quantized.forward_into(input, Span<float>(actual_int8));
+
+        for (size_t o = 0; o < O; ++o) {
+            const double diff = std::abs(static_cast<double>(actual_int8[o]) - expected_fp32[o]);
+            report.max_abs_error = std::max(report.max_abs_error, diff);
+            abs_sum += diff;
+        }
+        const auto top_fp32 = std::max_element(expected_fp32.begin(), expected_fp32.end()) - expected_fp32.begin();
+        const auto top_int8 = std::max_element(actual_int8.begin(), actual_int8.end()) - actual_int8.begin();
+        agree += (top_fp32 == top_int8) ? 1 : 0;
+
+        const Span<const float> expected = expected_of(r);
+        if (expected.size() == O) {
+            for (size_t o = 0; o < O; ++o) {
+                fp32_sum += std::abs(static_cast<double>(expected_fp32[o]) - expected[o]);
+                int8_sum += std::abs(static_cast<double>(actual_int8[o]) - expected[o]);
+            }
+            labelled_values += O;
+        }
+        ++report.samples;
+    }
+
+    if (report.samples > 0) {
+        report.mean_abs_error = abs_sum / static_cast<double>(report.samples * O);
+        report.argmax_agreement = static_cast<double>(agree) / static_cast<double>(report.samples);
+    }
+    if (labelled_values > 0) {
+        report.fp32_mean_abs_error = fp32_sum / static_cast<double>(labelled_values);
+        report.int8_mean_abs_error = int8_sum / static_cast<double>(labelled_values);
+    }
+    return report;
+}
+
+} // namespace
+
+QuantizationReport evaluate_quantization(const NeuralNetwork& reference,
+                                         const NeuralNetwork& quantized,
+                                         const std::vector<TestCase>& dataset) {
+    return evaluate_rows(
+        reference, quantized, dataset.size(),
+        [&](size_t r) { return Span<const float>(dataset[r].input); },
+        [&](size_t r) { return Span<const float>(dataset[r].expected_output); });
+}
+
+QuantizationReport evaluate_quantization(const NeuralNetwork& reference,
+                                         const NeuralNetwork& quantized,
+                                         const DatasetFile& dataset) {
+    if (dataset.input_size() != reference.input_size()) {
+        throw std::invalid_argument("Dataset input width does not match the model");
+    }
+    return evaluate_rows(
+        reference, quantized, dataset.rows(),
+        [&](size_t r) { return dataset.input(r); },
+        [&](size_t r) { return dataset.expected_output(r); });
+}
+
+std::string QuantizationReport::to_string() const {
+    std::ostringstream out;
+    out << "INT8 vs FP32 over " << samples << " samples: max |diff| " << max_abs_error
+        << ", mean |diff| " << mean_abs_error
+        << ", top-1 agreement " << argmax_agreement * 100.0 << "%";
+    if (fp32_mean_abs_error > 0.0 || int8_mean_abs_error > 0.0) {
+        out << "; MAE vs expected fp32 " << fp32_mean_abs_error
+            << " / int8 " << int8_mean_abs_error;
+    }
+    out << "; weights " << fp32_weight_bytes << " -> " << int8_weight_bytes << " bytes";
+    return out.str();
+}
+
+} // namespace ZeticML
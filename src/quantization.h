@@ -0,0 +1,155 @@
+/**
+ * ZeticML Assignment - INT8 Post-Training Quantization
+ * Symmetric per-channel weight quantization, calibration and accuracy report
+ */
+
+#pragma once
+
+#include "dataset_file.h"
+#include "neural_network_interface.h"
+#include "test_data_loader.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * INT8 version of any of the four model types
+ * Every dense layer stores int8 weights with one symmetric scale per output
+ * channel and fp32 biases. Layer inputs are quantized with a per-tensor
+ * scale fixed at calibration time, products accumulate in int32 through
+ * the int8 kernel table, and results are rescaled to fp32 before the bias
+ * and activation (ReLU between MLP layers, sigmoid / softmax at the output).
+ *
+ * Structure follows the base type: linear / logistic / multiclass are one
+ * layer, mlp is two. Public parameters (set_parameters / get_parameters)
+ * are the base model's fp32 parameters in its public order; they are
+ * quantized with the current activation scales.
+ *
+ * Native layout (bytes, every section 64-byte aligned): activation scales
+ * for each layer, then per layer [int8 weights out x stride][weight scales]
+ * [biases], with stride = input size rounded up to kInt8Block. size() of
+ * the block counts 4-byte words.
+ */
+class QuantizedModel : public NeuralNetwork {
+public:
+    // Zero weights and unit activation scales for a base_type model of the
+    // given constructor dimensions
+    QuantizedModel(const std::string& base_type, const std::vector<size_t>& dimensions);
+
+    // Scales used to quantize each layer's input, one per layer; applied by
+    // the next pack_parameters() / set_parameters()
+    void set_activation_scales(const std::vector<float>& scales);
+    std::vector<float> activation_scales() const;
+
+    const std::string& base_type() const { return base_type_; }
+    size_t num_layers() const { return layers_.size(); }
+
+    // Implementation of NeuralNetwork interface
+    std::unique_ptr<NeuralNetwork> clone() const override;
+    WeightBlock pack_parameters(Span<const float> parameters) const override;
+    void bind_parameters(WeightBlock block) override;
+    const WeightBlock& parameter_block() const override;
+    std::vector<float> get_parameters() const override;
+    size_t input_size() const override;
+    size_t output_size() const override;
+    std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+    size_t workspace_size(size_t batch_size) const override;
+
+protected:
+    void run(const float* input, float* output, InferenceContext& context) const override;
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   InferenceContext& context) const override;
+
+private:
+    enum class Activation { Identity, Sigmoid, Softmax };
+
+    struct Layer {
+        size_t in = 0;
+        size_t out = 0;
+        size_t stride = 0;          // in rounded up to kInt8Block
+        size_t weights = 0;         // Byte offsets into the native block
+        size_t scales = 0;
+        size_t biases = 0;
+
+        // Weight (o, i) is public[pub_weights + o * pub_out_step + i * pub_in_step]
+        size_t pub_weights = 0;
+        size_t pub_out_step = 0;
+        size_t pub_in_step = 0;
+        size_t pub_biases = 0;
+    };
+
+    const int8_t* layer_weights(const Layer& layer) const;
+    const float* layer_scales(const Layer& layer) const;
+    const float* layer_biases(const Layer& layer) const;
+
+    size_t public_parameter_count() const;
+
+    // Scratch words for a tile: int8 rows (widest stride), int32
+    // accumulators, fp32 hidden tile
+    struct Scratch {
+        size_t q_words = 0;
+        size_t acc_words = 0;
+        size_t hidden_words = 0;
+        size_t total() const { return q_words + acc_words + hidden_words; }
+    };
+    Scratch scratch_layout(size_t tile) const;
+
+    void apply_layer(const Layer& layer, const int8_t* q_input, size_t rows,
+                     float* output, int32_t* acc) const;
+
+    std::string base_type_;
+    std::vector<size_t> dims_;
+    std::vector<Layer> layers_;
+    std::vector<float> pending_scales_;     // For the next pack_parameters()
+    Activation activation_ = Activation::Identity;
+    size_t block_bytes_ = 0;
+    WeightBlock params_;
+};
+
+/**
+ * Calibrate activation ranges on sample inputs (num_samples x input_size
+ * row-major) and quantize the model's weights. Each layer's input scale is
+ * max |activation| / 127 over the samples. Throws std::invalid_argument for
+ * an empty calibration set or an unsupported model type.
+ */
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model,
+                                               const float* calibration_inputs, size_t num_samples);
+
+// Same, using the inputs of a dataset loaded with TestDataLoader
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model,
+                                               const std::vector<TestCase>& calibration);
+
+// Same, reading the input column of a mapped .zds dataset in place
+std::unique_ptr<QuantizedModel> quantize_model(const NeuralNetwork& model, const DatasetFile& calibration);
+
+/**
+ * Accuracy of a quantized model against its fp32 reference
+ */
+struct QuantizationReport {
+    size_t samples = 0;
+    double max_abs_error = 0.0;         // |int8 - fp32| over all outputs
+    double mean_abs_error = 0.0;
+    double argmax_agreement = 1.0;      // Fraction of samples with the same top output
+    double fp32_mean_abs_error = 0.0;   // Against the dataset's expected outputs
+    double int8_mean_abs_error = 0.0;
+    size_t fp32_weight_bytes = 0;       // Native parameter block sizes
+    size_t int8_weight_bytes = 0;
+
+    std::string to_string() const;
+};
+
+// Expected outputs are optional; cases without them only count toward the
+// fp32 / int8 comparison
+QuantizationReport evaluate_quantization(const NeuralNetwork& reference,
+                                         const NeuralNetwork& quantized,
+                                         const std::vector<TestCase>& dataset);
+
+QuantizationReport evaluate_quantization(const NeuralNetwork& reference,
+                                         const NeuralNetwork& quantized,
+                                         const DatasetFile& dataset);
+
+} // namespace ZeticML
@@ -0,0 +1,108 @@
+/**
+ * ZeticML Assignment - NUMA-Replicated Model Implementation
+ */
+
+#include "replicated_model.h"
+#include <stdexcept>
+
+namespace ZeticML {
+
+ReplicatedModel::ReplicatedModel(const NeuralNetwork& model, HugePages huge_pages)
+    : huge_pages_(huge_pages) {
+    build_replicas(model, model.parameter_block());
+}
+
+void ReplicatedModel::build_replicas(const NeuralNetwork& model, const WeightBlock& block) {
+    const size_t nodes = numa_topology().num_nodes();
+    std::vector<std::shared_ptr<const NeuralNetwork>> replicas;
+    for (size_t node = 0; node < nodes; ++node) {
+        MemoryPlacement placement;
+        placement.huge_pages = huge_pages_;
+        placement.numa = nodes > 1 ? NumaPolicy::Local : NumaPolicy::Default;
+        placement.node = static_cast<int>(node);
+        std::unique_ptr<NeuralNetwork> replica = model.clone();
+        // A single node with regular pages has nothing to place: share the block
+        replica->bind_parameters(placement.is_default() ? block : WeightBlock::place(block, placement));
+        replicas.push_back(std::move(replica));
+    }
+    replicas_ = std::move(replicas);
+}
+
+const NeuralNetwork& ReplicatedModel::replica(size_t node) const {
+    if (node >= replicas_.size()) {
+        throw std::invalid_argument("Replica index out of range");
+    }
+    return *replicas_[node];
+}
+
+std::unique_ptr<NeuralNetwork> ReplicatedModel::clone() const {
+    return std::make_unique<ReplicatedModel>(*this);
+}
+
+WeightBlock ReplicatedModel::pack_parameters(Span<const float> parameters) const {
+    return replicas_[0]->pack_parameters(parameters);
+}
+
+WeightBlock ReplicatedModel::adopt_parameters(WeightBlock parameters) const {
+    return replicas_[0]->adopt_parameters(std::move(parameters));
+}
+
+void ReplicatedModel::bind_parameters(WeightBlock block) {
+    // Validate once against a scratch clone before copying to every node
+    std::unique_ptr<NeuralNetwork> model = replicas_[0]->clone();
+    model->bind_parameters(block);
+    build_replicas(*model, block);
+}
+
+const WeightBlock& ReplicatedModel::parameter_block() const {
+    return replicas_[0]->parameter_block();
+}
+
+std::vector<float> ReplicatedModel::get_parameters() const {
+    return replicas_[0]->get_parameters();
+}
+
+WeightPrecision ReplicatedModel::weight_precision() const {
+    return replicas_[0]->weight_precision();
+}
+
+void ReplicatedModel::set_weight_precision(WeightPrecision precision) {
+    std::unique_ptr<NeuralNetwork> model = replicas_[0]->clone();
+    model->set_weight_precision(precision);
+    build_replicas(*model, model->parameter_block());
+}
+
+size_t ReplicatedModel::workspace_size(size_t batch_size) const {
+    return replicas_[0]->workspace_size(batch_size);
+}
+
+size_t ReplicatedModel::input_size() const {
+    return replicas_[0]->input_size();
+}
+
+size_t ReplicatedModel::output_size() const {
+    return replicas_[0]->output_size();
+}
+
+std::string ReplicatedModel::get_model_type() const {
+    return replicas_[0]->get_model_type() + " (" + std::to_string(replicas_.size()) + " NUMA replicas)";
+}
+
+std::string ReplicatedModel::type_name() const {
+    return replicas_[0]->type_name();
+}
+
+std::vector<size_t> ReplicatedModel::dimensions() const {
+    return replicas_[0]->dimensions();
+}
+
+void ReplicatedModel::run(const float* input, float* output, InferenceContext& context) const {
+    run_model(local(), input, output, context);
+}
+
+void ReplicatedModel::run_batch(const float* input, size_t batch_size, float* output,
+                                InferenceContext& context) const {
+    run_model_batch(local(), input, batch_size, output, context);
+}
+
+} // namespace ZeticML
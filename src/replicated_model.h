@@ -0,0 +1,77 @@
+/**
+ * ZeticML Assignment - NUMA-Replicated Model
+ * One copy of a model's weights per NUMA node, chosen by the calling thread
+ */
+
+#pragma once
+
+#include "memory_placement.h"
+#include "neural_network_interface.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * Drop-in wrapper that keeps one replica of a model per NUMA node
+ * Each replica is a clone bound to its own copy of the parameter block,
+ * allocated with NumaPolicy::Local on that node (and the requested huge
+ * page mode). Every forward call runs the replica of the node the calling
+ * thread is on, so threads never stream weights across the interconnect.
+ * Pin serving threads (ThreadPool::Options::pin_threads or pin_to_nodes)
+ * so they stay next to their replica between calls.
+ *
+ * Costs one copy of the weights per node. On a single-node machine it holds
+ * one replica, which only copies the weights to change their page mode.
+ * set_parameters() and set_weight_precision() rebuild every replica;
+ * type_name() and dimensions() are the wrapped model's, so
+ * save_zetic_model() writes a plain model file.
+ */
+class ReplicatedModel : public NeuralNetwork {
+public:
+    explicit ReplicatedModel(const NeuralNetwork& model, HugePages huge_pages = HugePages::Off);
+
+    size_t num_replicas() const { return replicas_.size(); }
+    const NeuralNetwork& replica(size_t node) const;
+
+    // Replica of the calling thread's current node
+    const NeuralNetwork& local() const { return *replicas_[current_numa_node() % replicas_.size()]; }
+
+    HugePages huge_pages() const { return huge_pages_; }
+
+    std::unique_ptr<NeuralNetwork> clone() const override;
+
+    WeightBlock pack_parameters(Span<const float> parameters) const override;
+    WeightBlock adopt_parameters(WeightBlock parameters) const override;
+    void bind_parameters(WeightBlock block) override;
+    const WeightBlock& parameter_block() const override;
+    std::vector<float> get_parameters() const override;
+
+    WeightPrecision weight_precision() const override;
+    void set_weight_precision(WeightPrecision precision) override;
+
+    size_t workspace_size(size_t batch_size) const override;
+
+    size_t input_size() const override;
+    size_t output_size() const override;
+    std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+protected:
+    void run(const float* input, float* output, InferenceContext& context) const override;
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   InferenceContext& context) const override;
+
+private:
+    // Clones of `model`, one per node, each bound to a node-local copy of `block`
+    void build_replicas(const NeuralNetwork& model, const WeightBlock& block);
+
+    // Replicas are never modified once built; rebinding swaps in new ones,
+    // so clones can share them
+    std::vector<std::shared_ptr<const NeuralNetwork>> replicas_;
+    HugePages huge_pages_;
+};
+
+} // namespace ZeticML
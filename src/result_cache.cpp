@@ -0,0 +1,234 @@
+/**
+ * ZeticML Assignment - Inference Result Cache Implementation
+ */
+
+#include "result_cache.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace ZeticML {
+
+namespace {
+
+constexpr uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ull;
+
+uint64_t mix(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ResultCache
+
+ResultCache::ResultCache(const ResultCacheOptions& options) : options_(options) {
+    if (options_.capacity == 0 || options_.shards == 0) {
+        throw std::invalid_argument("Result cache needs a positive capacity and shard count");
+    }
+    options_.shards = std::min(options_.shards, options_.capacity);
+    shard_capacity_ = (options_.capacity + options_.shards - 1) / options_.shards;
+    for (size_t s = 0; s < options_.shards; ++s) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+uint64_t ResultCache::hash_input(Span<const float> input) {
+    // Eight bytes per step, multiply-xorshift finalized
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(input.data());
+    const size_t size = input.size() * sizeof(float);
+    uint64_t hash = size * kHashMultiplier;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        hash = (hash ^ mix(word)) * kHashMultiplier;
+    }
+    if (i < size) {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + i, size - i);
+        hash = (hash ^ mix(word)) * kHashMultiplier;
+    }
+    return mix(hash);
+}
+
+bool ResultCache::lookup(uint64_t version, Span<const float> input, Span<float> output) {
+    const uint64_t hash = hash_input(input);
+    Shard& shard = shard_for(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(hash);
+    if (it == shard.index.end()) {
+        ++shard.stats.misses;
+        return false;
+    }
+    Entry& entry = *it->second;
+    if (entry.input.size() != input.size() ||
+        !std::equal(entry.input.begin(), entry.input.end(), input.data())) {
+        ++shard.stats.misses;
+        return false;
+    }
+    const bool expired = options_.ttl.count() > 0 && Clock::now() >= entry.expires;
+    if (expired || entry.version != version) {
+        ++(expired ? shard.stats.expired : shard.stats.stale);
+        ++shard.stats.misses;
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+        return false;
+    }
+    if (output.size() != entry.output.size()) {
+        throw std::invalid_argument("Output size mismatch");
+    }
+    std::copy(entry.output.begin(), entry.output.end(), output.data());
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    ++shard.stats.hits;
+    return true;
+}
+
+void ResultCache::store(uint64_t version, Span<const float> input, Span<const float> output) {
+    const uint64_t hash = hash_input(input);
+    Shard& shard = shard_for(hash);
+    const Clock::time_point expires = Clock::now() + options_.ttl;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(hash);
+    if (it != shard.index.end()) {
+        // Same key (or a colliding input): overwrite in place
+        Entry& entry = *it->second;
+        entry.version = version;
+        entry.expires = expires;
+        entry.input.assign(input.begin(), input.end());
+        entry.output.assign(output.begin(), output.end());
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+    if (shard.lru.size() >= shard_capacity_) {
+        // Reuse the coldest entry's buffers
+        shard.index.erase(shard.lru.back().hash);
+        shard.lru.splice(shard.lru.begin(), shard.lru, std::prev(shard.lru.end()));
+        ++shard.stats.evictions;
+    } else {
+        shard.lru.emplace_front();
+    }
+    Entry& entry = shard.lru.front();
+    entry.hash = hash;
+    entry.version = version;
+    entry.expires = expires;
+    entry.input.assign(input.begin(), input.end());
+    entry.output.assign(output.begin(), output.end());
+    shard.index.emplace(hash, shard.lru.begin());
+}
+
+void ResultCache::clear() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->lru.clear();
+        shard->index.clear();
+    }
+}
+
+ResultCacheStats ResultCache::stats() const {
+    ResultCacheStats total;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total.hits += shard->stats.hits;
+        total.misses += shard->stats.misses;
+        total.expired += shard->stats.expired;
+        total.stale += shard->stats.stale;
+        total.evictions += shard->stats.evictions;
+        total.entries += shard->lru.size();
+    }
+    return total;
+}
+
+// ---------------------------------------------------------------------------
+// CachedModel
+
+CachedModel::CachedModel(std::shared_ptr<const NeuralNetwork> model, const ResultCacheOptions& options)
+    : model_(std::move(model)) {
+    if (model_ == nullptr) {
+        throw std::invalid_argument("CachedModel requires a model");
+    }
+    cache_ = std::make_unique<ResultCache>(options);
+    input_size_ = model_->input_size();
+    output_size_ = model_->output_size();
+}
+
+CachedModel::CachedModel(const ModelHandle& handle, const ResultCacheOptions& options)
+    : handle_(&handle), cache_(std::make_unique<ResultCache>(options)) {
+    // Published replacements keep these sizes (see ModelHandle::publish)
+    ModelHandle::Snapshot snapshot = handle.acquire();
+    input_size_ = snapshot->input_size();
+    output_size_ = snapshot->output_size();
+}
+
+template <typename Fn>
+void CachedModel::with_model(Fn&& fn) const {
+    if (handle_ != nullptr) {
+        ModelHandle::Snapshot snapshot = handle_->acquire();
+        fn(snapshot.model(), snapshot.version());
+    } else {
+        fn(*model_, uint64_t(0));
+    }
+}
+
+void CachedModel::forward_into(Span<const float> input, Span<float> output) const {
+    if (input.size() != input_size_) {
+        throw std::invalid_argument("Input size mismatch");
+    }
+    if (output.size() != output_size_) {
+        throw std::invalid_argument("Output size mismatch");
+    }
+    with_model([&](const NeuralNetwork& model, uint64_t version) {
+        if (!cache_->lookup(version, input, output)) {
+            model.forward_into(input, output);
+            cache_->store(version, input, Span<const float>(output.data(), output.size()));
+        }
+    });
+}
+
+std::vector<float> CachedModel::forward(const std::vector<float>& input) const {
+    std::vector<float> output(output_size_);
+    forward_into(Span<const float>(input), Span<float>(output));
+    return output;
+}
+
+void CachedModel::forward_batch(const float* input, size_t batch_size, float* output) const {
+    if (batch_size == 0) {
+        return;
+    }
+    if (input == nullptr || output == nullptr) {
+        throw std::invalid_argument("Null batch buffer");
+    }
+    const size_t in = input_size_, out = output_size_;
+    with_model([&](const NeuralNetwork& model, uint64_t version) {
+        std::vector<size_t> misses;
+        for (size_t r = 0; r < batch_size; ++r) {
+            if (!cache_->lookup(version, Span<const float>(input + r * in, in), Span<float>(output + r * out, out))) {
+                misses.push_back(r);
+            }
+        }
+        if (misses.empty()) {
+            return;
+        }
+        // Gather the misses, run them as one batch, scatter and remember them
+        std::vector<float> miss_input(misses.size() * in);
+        std::vector<float> miss_output(misses.size() * out);
+        for (size_t m = 0; m < misses.size(); ++m) {
+            std::copy(input + misses[m] * in, input + (misses[m] + 1) * in, miss_input.begin() + m * in);
+        }
+        model.forward_batch(miss_input.data(), misses.size(), miss_output.data());
+        for (size_t m = 0; m < misses.size(); ++m) {
+            const float* row = miss_output.data() + m * out;
+            std::copy(row, row + out, output + misses[m] * out);
+            cache_->store(version, Span<const float>(input + misses[m] * in, in), Span<const float>(row, out));
+        }
+    });
+}
+
+} // namespace ZeticML
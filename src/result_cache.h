@@ -0,0 +1,128 @@
+/**
+ * ZeticML Assignment - Inference Result Cache
+ * Sharded, TTL-bounded cache of outputs keyed by input bytes and model version
+ */
+
+#pragma once
+
+#include "model_handle.h"
+#include "neural_network_interface.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ZeticML {
+
+struct ResultCacheOptions {
+    size_t capacity = 4096;                 // Entries over all shards
+    size_t shards = 16;                     // Independent locks
+    std::chrono::milliseconds ttl{1000};    // 0 = entries never expire
+};
+
+struct ResultCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;        // Includes the expired and stale lookups
+    uint64_t expired = 0;       // Entry found but past its TTL
+    uint64_t stale = 0;         // Entry found but for another model version
+    uint64_t evictions = 0;
+    size_t entries = 0;
+};
+
+/**
+ * Bounded map from (model version, input vector) to output vector
+ * Keys are a 64-bit hash of the input bytes; entries keep the input itself
+ * and a hit requires an exact match, so hash collisions cost a miss, never a
+ * wrong result. The hash picks one of `shards` independently locked LRU
+ * lists, each holding capacity / shards entries. An entry for a different
+ * model version is replaced on sight, which is how hot swaps invalidate.
+ * Thread-safe.
+ */
+class ResultCache {
+public:
+    explicit ResultCache(const ResultCacheOptions& options = ResultCacheOptions());
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // Copy the cached output into `output` (sized for it) on a hit
+    bool lookup(uint64_t version, Span<const float> input, Span<float> output);
+    void store(uint64_t version, Span<const float> input, Span<const float> output);
+
+    void clear();
+    ResultCacheStats stats() const;
+    const ResultCacheOptions& options() const { return options_; }
+
+    // Hash of the input bytes (exact bit patterns: -0.0f and 0.0f differ)
+    static uint64_t hash_input(Span<const float> input);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        uint64_t hash;
+        uint64_t version;
+        Clock::time_point expires;
+        std::vector<float> input;
+        std::vector<float> output;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<Entry> lru;       // Most recently used first
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+        ResultCacheStats stats;
+    };
+
+    Shard& shard_for(uint64_t hash) { return *shards_[(hash >> 32) % shards_.size()]; }
+
+    ResultCacheOptions options_;
+    size_t shard_capacity_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+/**
+ * Serving wrapper that answers repeated inputs from a ResultCache
+ * Wraps either a fixed model (version 0) or a ModelHandle, whose current
+ * version keys every lookup: after a publish, entries of the old version
+ * miss and are overwritten, with no explicit flush. Hits skip the forward
+ * pass and copy the stored output. forward_batch() looks every row up and
+ * runs the misses as one batch.
+ *
+ * Outputs must be a pure function of the input, which holds for every
+ * model in this library. The handle, when used, must outlive the wrapper.
+ */
+class CachedModel {
+public:
+    CachedModel(std::shared_ptr<const NeuralNetwork> model,
+                const ResultCacheOptions& options = ResultCacheOptions());
+    CachedModel(const ModelHandle& handle, const ResultCacheOptions& options = ResultCacheOptions());
+
+    void forward_into(Span<const float> input, Span<float> output) const;
+    std::vector<float> forward(const std::vector<float>& input) const;
+    void forward_batch(const float* input, size_t batch_size, float* output) const;
+
+    size_t input_size() const { return input_size_; }
+    size_t output_size() const { return output_size_; }
+
+    // Drop every cached result (e.g. after changing a fixed model's weights)
+    void invalidate() const { cache_->clear(); }
+    ResultCacheStats stats() const { return cache_->stats(); }
+
+private:
+    // Runs fn(model, version) on a stable model snapshot
+    template <typename Fn>
+    void with_model(Fn&& fn) const;
+
+    std::shared_ptr<const NeuralNetwork> model_;
+    const ModelHandle* handle_ = nullptr;
+    std::unique_ptr<ResultCache> cache_;
+    size_t input_size_;
+    size_t output_size_;
+};
+
+} // namespace ZeticML
@@ -0,0 +1,56 @@
+/**
+ * ZeticML Assignment - Non-owning Array View
+ * Minimal C++17 stand-in for std::span used by the allocation-free API
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * Non-owning view over a contiguous range of T (pointer + size)
+ * Span<const float> binds to const and non-const data, Span<float> only to
+ * mutable data. The viewed memory must outlive the span.
+ */
+template <typename T>
+class Span {
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+
+    constexpr Span() noexcept = default;
+    constexpr Span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    // Span<T> -> Span<const T>
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr Span(const Span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    Span(std::vector<value_type>& vec) noexcept : data_(vec.data()), size_(vec.size()) {}
+
+    template <typename U = T,
+              typename = std::enable_if_t<std::is_const<U>::value>>
+    Span(const std::vector<value_type>& vec) noexcept : data_(vec.data()), size_(vec.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T& operator[](size_t index) const noexcept { return data_[index]; }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+
+    constexpr Span subspan(size_t offset, size_t count) const noexcept {
+        return Span(data_ + offset, count);
+    }
+};
+
+} // namespace ZeticML
@@ -0,0 +1,76 @@
+/**
+ * ZeticML Assignment - Sparse Feature Vectors
+ * Non-owning (index, value) views for inputs with few non-zeros
+ */
+
+#pragma once
+
+#include "span.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace ZeticML {
+
+/**
+ * One sparse input row: values[i] is feature indices[i]; every other
+ * feature is zero. Indices may come in any order; repeated indices add up.
+ */
+struct SparseVector {
+    Span<const uint32_t> indices;
+    Span<const float> values;
+
+    size_t nnz() const { return indices.size(); }
+};
+
+/**
+ * Batch of sparse rows in compressed sparse row (CSR) form
+ * Row r holds entries [row_offsets[r], row_offsets[r + 1]) of indices and
+ * values, so row_offsets has rows() + 1 non-decreasing entries.
+ */
+struct CsrMatrix {
+    Span<const size_t> row_offsets;
+    Span<const uint32_t> indices;
+    Span<const float> values;
+
+    size_t rows() const { return row_offsets.empty() ? 0 : row_offsets.size() - 1; }
+
+    SparseVector row(size_t r) const {
+        const size_t begin = row_offsets[r];
+        const size_t count = row_offsets[r + 1] - begin;
+        return {indices.subspan(begin, count), values.subspan(begin, count)};
+    }
+};
+
+// Throws std::invalid_argument unless every entry is addressable and every
+// index is below input_size
+inline void validate_sparse(const SparseVector& x, size_t input_size) {
+    if (x.indices.size() != x.values.size()) {
+        throw std::invalid_argument("Sparse indices and values differ in length");
+    }
+    for (uint32_t index : x.indices) {
+        if (index >= input_size) {
+            throw std::invalid_argument("Sparse index " + std::to_string(index) + " out of range");
+        }
+    }
+}
+
+inline void validate_sparse(const CsrMatrix& batch, size_t input_size) {
+    if (batch.indices.size() != batch.values.size()) {
+        throw std::invalid_argument("Sparse indices and values differ in length");
+    }
+    for (size_t r = 0; r < batch.rows(); ++r) {
+        if (batch.row_offsets[r] > batch.row_offsets[r + 1] ||
+            batch.row_offsets[r + 1] > batch.indices.size()) {
+            throw std::invalid_argument("Invalid CSR row offsets");
+        }
+    }
+    for (uint32_t index : batch.indices) {
+        if (index >= input_size) {
+            throw std::invalid_argument("Sparse index " + std::to_string(index) + " out of range");
+        }
+    }
+}
+
+} // namespace ZeticML
@@ -5,11 +5,14 @@
 
 #pragma once
 
-#include <vector>
-#include <string>
-#include <fstream>
-#include <sstream>
+#include "dataset_reader.h"
+#include "model_loader.h"
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace ZeticML {
 
@@ -27,85 +30,57 @@ public:
     /**
      * Load test cases from file
      * File format: input1,input2,... -> expected_output1,expected_output2,...
-     * Lines starting with # are comments
+     * Lines starting with # are comments; lines without "->" get no
+     * expected outputs. The file is memory-mapped and parsed in place with
+     * parse_dataset_line(); malformed lines are reported and skipped. For
+     * datasets too large to hold as TestCases, stream them with
+     * DatasetReader (src/dataset_reader.h) instead.
      */
     static std::vector<TestCase> load_from_file(const std::string& filename) {
         std::vector<TestCase> test_cases;
-        std::ifstream file(filename);
-
-        if (!file.is_open()) {
+        std::unique_ptr<MappedFile> file;
+        try {
+            file = std::make_unique<MappedFile>(filename);
+        } catch (const std::runtime_error&) {
             std::cerr << "Warning: Could not open test file: " << filename << std::endl;
             return test_cases;
         }
 
-        std::string line;
+        const char* data = reinterpret_cast<const char*>(file->data());
+        const char* const end = data + file->size();
+        std::vector<float> inputs, outputs;
         int line_number = 0;
 
-        while (std::getline(file, line)) {
+        while (data < end) {
+            const char* newline =
+                static_cast<const char*>(std::memchr(data, '\n', static_cast<size_t>(end - data)));
+            const char* line_end = newline != nullptr ? newline : end;
+            const char* line = data;
+            data = newline != nullptr ? newline + 1 : end;
             line_number++;
 
             // Skip empty lines and comments
-            if (line.empty() || line[0] == '#') {
+            while (line < line_end && (*line == ' ' || *line == '\t' || *line == '\r')) {
+                ++line;
+            }
+            if (line == line_end || *line == '#') {
                 continue;
             }
 
-            try {
-                TestCase test_case = parse_line(line, line_number);
-                test_cases.push_back(test_case);
-            } catch (const std::exception& e) {
+            inputs.clear();
+            outputs.clear();
+            bool has_outputs = false;
+            if (const char* error = parse_dataset_line(line, line_end, inputs, outputs, has_outputs)) {
                 std::cerr << "Error parsing line " << line_number << " in " << filename
-                         << ": " << e.what() << std::endl;
+                         << ": " << error << std::endl;
+                continue;
             }
+            test_cases.emplace_back(inputs, outputs, "Line " + std::to_string(line_number));
         }
 
         std::cout << "Loaded " << test_cases.size() << " test cases from " << filename << std::endl;
         return test_cases;
     }
-
-private:
-    static TestCase parse_line(const std::string& line, int line_number) {
-        // Find the arrow separator
-        size_t arrow_pos = line.find("->");
-        if (arrow_pos == std::string::npos) {
-            throw std::runtime_error("Missing '->' separator");
-        }
-
-        // Parse input part
-        std::string input_str = line.substr(0, arrow_pos);
-        std::vector<float> inputs = parse_float_list(trim(input_str));
-
-        // Parse output part
-        std::string output_str = line.substr(arrow_pos + 2);
-        std::vector<float> outputs = parse_float_list(trim(output_str));
-
-        // Create description
-        std::string description = "Line " + std::to_string(line_number);
-
-        return TestCase(inputs, outputs, description);
-    }
-
-    static std::vector<float> parse_float_list(const std::string& str) {
-        std::vector<float> values;
-        std::stringstream ss(str);
-        std::string token;
-
-        while (std::getline(ss, token, ',')) {
-            token = trim(token);
-            if (!token.empty()) {
-                values.push_back(std::stof(token));
-            }
-        }
-
-        return values;
-    }
-
-    static std::string trim(const std::string& str) {
-        size_t start = str.find_first_not_of(" \t\r\n");
-        if (start == std::string::npos) return "";
-
-        size_t end = str.find_last_not_of(" \t\r\n");
-        return str.substr(start, end - start + 1);
-    }
 };
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
@@ -0,0 +1,239 @@
+/**
+ * ZeticML Assignment - Work-Stealing Thread Pool Implementation
+ */
+
+#include "thread_pool.h"
+#include "memory_placement.h"
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ZeticML {
+
+namespace {
+
+// Pool whose task the current thread is running, if any
+thread_local const ThreadPool* tls_active_pool = nullptr;
+
+size_t default_thread_count() {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : hw;
+}
+
+void pin_current_thread(size_t core) {
+#if defined(__linux__)
+    const size_t cores = default_thread_count();
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<int>(core % cores), &set);
+    // Best effort: a restricted cpuset simply leaves the thread unpinned
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+void pin_current_thread_to_node(size_t node) {
+#if defined(__linux__)
+    const NumaTopology& topology = numa_topology();
+    const std::vector<size_t>& cpus = topology.node_cpus[node % topology.num_nodes()];
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(static_cast<int>(cpu), &set);
+        }
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)node;
+#endif
+}
+
+} // namespace
+
+struct ThreadPool::Job {
+    const RangeFunction* fn;
+    size_t remaining;               // Tasks not yet finished, guarded by mutex
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool() : ThreadPool(Options()) {}
+
+ThreadPool::ThreadPool(const Options& options) {
+    const size_t count = options.num_threads == 0 ? default_thread_count() : options.num_threads;
+
+    for (size_t i = 0; i < count; ++i) {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+
+    // Participant 0 is whichever thread calls parallel_for()
+    for (size_t i = 1; i < count; ++i) {
+        const bool pin = options.pin_threads;
+        const bool pin_node = options.pin_to_nodes && !pin;
+        workers_.emplace_back([this, i, pin, pin_node] {
+            if (pin) {
+                pin_current_thread(i);
+            } else if (pin_node) {
+                pin_current_thread_to_node(i);
+            }
+            worker_loop(i);
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+bool ThreadPool::pop_local(size_t index, Task& task) {
+    TaskQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ThreadPool::steal(size_t thief, Task& task) {
+    const size_t count = queues_.size();
+    for (size_t offset = 1; offset < count; ++offset) {
+        TaskQueue& queue = *queues_[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::execute(const Task& task) {
+    Job& job = *task.job;
+    const ThreadPool* previous = tls_active_pool;
+    tls_active_pool = this;
+    std::exception_ptr error;
+    try {
+        (*job.fn)(task.begin, task.end);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    tls_active_pool = previous;
+
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (error && !job.error) {
+        job.error = error;
+    }
+    if (--job.remaining == 0) {
+        job.done.notify_all();
+    }
+}
+
+void ThreadPool::worker_loop(size_t index) {
+    Task task;
+    for (;;) {
+        if (pop_local(index, task) || steal(index, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] {
+            return stop_ || pending_.load(std::memory_order_relaxed) > 0;
+        });
+        if (stop_) {
+            return;
+        }
+    }
+}
+
+void ThreadPool::parallel_for(size_t begin, size_t end, size_t grain, const RangeFunction& fn) {
+    if (begin >= end) {
+        return;
+    }
+    grain = std::max<size_t>(grain, 1);
+    const size_t num_tasks = (end - begin + grain - 1) / grain;
+
+    // Nothing to share, or already inside one of our tasks: run inline
+    if (num_tasks == 1 || queues_.size() == 1 || tls_active_pool == this) {
+        for (size_t b = begin; b < end; b += std::min(grain, end - b)) {
+            fn(b, std::min(end, b + grain));
+        }
+        return;
+    }
+
+    Job job;
+    job.fn = &fn;
+    job.remaining = num_tasks;
+
+    // Contiguous runs of tasks per participant keep neighbouring rows on one
+    // core; stealing evens out whatever imbalance remains
+    pending_.fetch_add(num_tasks, std::memory_order_relaxed);
+    const size_t participants = queues_.size();
+    for (size_t p = 0; p < participants; ++p) {
+        const size_t first = num_tasks * p / participants;
+        const size_t last = num_tasks * (p + 1) / participants;
+        if (first == last) {
+            continue;
+        }
+        TaskQueue& queue = *queues_[p];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        // Pushed in reverse so the owner's LIFO pops walk rows in order
+        for (size_t t = last; t-- > first;) {
+            const size_t b = begin + t * grain;
+            queue.tasks.push_back(Task{&job, b, std::min(end, b + grain)});
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_all();
+
+    // Help until every task of this job has finished
+    Task task;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(job.mutex);
+            if (job.remaining == 0) {
+                break;
+            }
+        }
+        if (pop_local(0, task) || steal(0, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done.wait(lock, [&job] { return job.remaining == 0; });
+        break;
+    }
+
+    // job.remaining reached 0 under job.mutex, so no task touches job anymore
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+} // namespace ZeticML
@@ -0,0 +1,92 @@
+/**
+ * ZeticML Assignment - Work-Stealing Thread Pool
+ * Parallel loops over row ranges for batch inference
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ZeticML {
+
+/**
+ * Fixed-size pool running parallel_for() loops
+ * Each participant (the calling thread plus num_threads - 1 workers) owns a
+ * deque of range tasks. Owners pop from the back, idle participants steal
+ * from the front of the others, so uneven tiles balance out without a
+ * central queue. The calling thread always helps, so a pool of 1 runs loops
+ * inline.
+ *
+ * parallel_for() is safe to call from several threads at once; a call made
+ * from inside a pool task runs inline instead of deadlocking the pool.
+ */
+class ThreadPool {
+public:
+    struct Options {
+        size_t num_threads = 0;     // Total participants; 0 = hardware concurrency
+        bool pin_threads = false;   // Pin worker i to core i (Linux/Android only)
+        bool pin_to_nodes = false;  // Pin worker i to any CPU of NUMA node i % nodes
+                                    // (Linux/Android only; pin_threads wins)
+    };
+
+    // fn(begin, end) processes the half-open range [begin, end)
+    using RangeFunction = std::function<void(size_t, size_t)>;
+
+    ThreadPool();
+    explicit ThreadPool(const Options& options);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Participants, including the calling thread
+    size_t size() const { return queues_.size(); }
+
+    /**
+     * Run fn over [begin, end) split into tasks of `grain` indices (the last
+     * one may be shorter) and wait for all of them. The first exception
+     * thrown by a task is rethrown here once the already queued tasks have
+     * drained (inline loops stop right away).
+     */
+    void parallel_for(size_t begin, size_t end, size_t grain, const RangeFunction& fn);
+
+    // Process-wide pool sized to the hardware (created on first use)
+    static ThreadPool& shared();
+
+private:
+    struct Job;
+
+    struct Task {
+        Job* job;
+        size_t begin;
+        size_t end;
+    };
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool pop_local(size_t index, Task& task);
+    bool steal(size_t thief, Task& task);
+    void execute(const Task& task);
+    void worker_loop(size_t index);
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;   // [0] belongs to callers
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> pending_{0};                  // Queued, not yet taken
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+};
+
+} // namespace ZeticML
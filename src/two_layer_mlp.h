@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "neural_network_interface.h"
+#include "graph_model.h"
 #include <vector>
 
 namespace ZeticML {
@@ -14,27 +14,29 @@ namespace ZeticML {
  * Two-Layer MLP: Multi-Layer Perceptron with one hidden layer
  * Hidden layer uses ReLU activation, output layer is linear
  * Demonstrates more complex neural network architecture
+ *
+ * Preset graph: Dense (Panels) + ReLU -> Dense (Panels). Native layout (one
+ * WeightBlock): [W1 GEMM panels][b1][W2 GEMM panels][b2], each section padded
+ * to a multiple of 16 floats. Both layers run as packed GEMMs with bias (and
+ * ReLU for the hidden layer) fused into the store; the hidden tile lives in
+ * the workspace. The public parameter order is W1, b1, W2, b2 with W1 as
+ * [input_size x hidden_size] row-major.
+ * With fp16 / bf16 weight storage both panel sections hold 16-bit values in
+ * the same panel order and the GEMMs widen them in registers; biases stay
+ * fp32.
  */
-class TwoLayerMLP : public NeuralNetwork {
-private:
-    std::vector<float> W1_;        // Input to hidden weights [input_size * hidden_size]
-    std::vector<float> b1_;        // Hidden layer biases [hidden_size]
-    std::vector<float> W2_;        // Hidden to output weights [hidden_size * output_size]
-    std::vector<float> b2_;        // Output layer biases [output_size]
-    size_t input_size_;
-    size_t hidden_size_;
-    size_t output_size_;
-
+class TwoLayerMLP : public GraphModel {
 public:
     TwoLayerMLP(size_t input_size, size_t hidden_size, size_t output_size);
 
-    // Implementation of NeuralNetwork interface
-    std::vector<float> forward(const std::vector<float>& input) override;
-    void set_parameters(const std::vector<float>& parameters) override;
-    size_t input_size() const override;
-    size_t output_size() const override;
+    std::unique_ptr<NeuralNetwork> clone() const override;
     std::string get_model_type() const override;
+    std::string type_name() const override;
+    std::vector<size_t> dimensions() const override;
+
+protected:
+    size_t hidden_size() const { return graph().node(1).width; }
 };
 
 
-} // namespace ZeticML
\ No newline at end of file
+} // namespace ZeticML
@@ -0,0 +1,77 @@
+/**
+ * ZeticML Assignment - Weight Block
+ * Immutable, reference-counted view of a model's parameters in native layout
+ */
+
+#pragma once
+
+#include "aligned_buffer.h"
+#include "memory_placement.h"
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+
+namespace ZeticML {
+
+/**
+ * Contiguous float parameters plus a keep-alive handle for whatever owns them
+ * (an aligned heap buffer, a memory-mapped .zetic file, a caller's shared
+ * array). Copies are cheap and share the same memory, so one block can back
+ * any number of model instances.
+ */
+class WeightBlock {
+private:
+    std::shared_ptr<const void> owner_;
+    const float* data_ = nullptr;
+    size_t size_ = 0;
+    bool file_backed_ = false;
+
+public:
+    WeightBlock() = default;
+
+    WeightBlock(std::shared_ptr<const void> owner, const float* data, size_t size)
+        : owner_(std::move(owner)), data_(data), size_(size) {}
+
+    // Share a caller's immutable array of `size` floats
+    WeightBlock(std::shared_ptr<const float[]> data, size_t size)
+        : owner_(data, data.get()), data_(data.get()), size_(size) {}
+
+    /**
+     * Allocate a zero-filled, 64-byte aligned block of `size` floats
+     * `writable` receives the only mutable pointer to it; fill it before the
+     * block is shared. Blocks of kPlacementMinBytes or more follow
+     * default_weight_placement(); the overload takes an explicit placement.
+     * Large blocks are zero pages that only become resident once written.
+     */
+    static WeightBlock allocate(size_t size, float*& writable);
+    static WeightBlock allocate(size_t size, float*& writable, const MemoryPlacement& placement);
+
+    // Copy of `source` in memory with the given placement (e.g. a node-local
+    // replica, or huge pages for weights read from a file)
+    static WeightBlock place(const WeightBlock& source, const MemoryPlacement& placement);
+
+    // View into a read-only file mapping: its pages may be dropped and are
+    // read back from the file on demand (see advise_mapped_pages)
+    static WeightBlock mapped(std::shared_ptr<const void> mapping, const float* data, size_t size) {
+        WeightBlock block(std::move(mapping), data, size);
+        block.file_backed_ = true;
+        return block;
+    }
+
+    // Take ownership of a vector's buffer without copying it
+    static WeightBlock adopt(std::vector<float>&& values) {
+        auto storage = std::make_shared<const std::vector<float>>(std::move(values));
+        return WeightBlock(storage, storage->data(), storage->size());
+    }
+
+    const float* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t size_bytes() const { return size_ * sizeof(float); }
+    bool file_backed() const { return file_backed_; }
+
+    const std::shared_ptr<const void>& owner() const { return owner_; }
+};
+
+} // namespace ZeticML
@@ -0,0 +1,49 @@
+/**
+ * ZeticML Assignment - Inference Scratch Workspace
+ * Reusable scratch memory so the steady-state inference path never allocates
+ */
+
+#pragma once
+
+#include "aligned_buffer.h"
+#include <cstddef>
+
+namespace ZeticML {
+
+/**
+ * Grow-only, cache-line aligned arena for intermediate activations
+ * The first call with a given size allocates; later calls of the same or
+ * smaller size reuse the existing memory. Models carve their planned
+ * regions out of the single block returned by acquire().
+ */
+class Workspace {
+private:
+    AlignedVector<float> buffer_;
+    size_t allocations_ = 0;
+
+public:
+    // Returns at least `count` floats of scratch memory (contents unspecified)
+    float* acquire(size_t count) {
+        reserve(count);
+        return buffer_.data();
+    }
+
+    // Grow to at least `count` floats ahead of time (see NeuralNetwork::prepare)
+    void reserve(size_t count) {
+        if (buffer_.size() < count) {
+            buffer_.resize(count);
+            ++allocations_;
+        }
+    }
+
+    size_t capacity() const { return buffer_.size(); }
+
+    // Number of times the arena has grown since construction
+    size_t allocations() const { return allocations_; }
+
+    void release() {
+        AlignedVector<float>().swap(buffer_);
+    }
+};
+
+} // namespace ZeticML
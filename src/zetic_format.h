@@ -0,0 +1,87 @@
+/**
+ * ZeticML Assignment - .zetic Container Format
+ * On-disk layout shared by the model loader and writer
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ZeticML {
+
+/**
+ * .zetic file layout (all integers little-endian):
+ *
+ *   [ZeticHeader            64 bytes]
+ *   [ZeticSection x count   32 bytes each, at section_table_offset]
+ *   [section payloads, each starting on a 64-byte boundary]
+ *
+ * Weight sections hold the model's native layout (the exact block returned
+ * by NeuralNetwork::parameter_block()), so a mapped file can be bound to a
+ * model without copying or repacking. The section dtype records the weight
+ * storage precision the layout was built for (Float16 / BFloat16 blocks hold
+ * 16-bit weights and fp32 biases); the loader sets that precision before
+ * binding, so no conversion pass runs at load time.
+ *
+ * Files starting with a u64 name length instead of the magic are the legacy
+ * format: [u64 name_len][name][u64 payload_len][payload]. They carry no
+ * weights and can only be inspected.
+ */
+
+constexpr char kZeticMagic[4] = {'Z', 'T', 'I', 'C'};
+constexpr uint16_t kZeticVersionMajor = 1;
+constexpr uint16_t kZeticVersionMinor = 1;     // 1.1: fp16 / bf16 weight dtypes
+constexpr size_t kZeticAlignment = 64;
+constexpr size_t kZeticMaxDims = 4;
+
+// Native layout revision; bumped whenever a model changes its block layout
+constexpr uint32_t kZeticNativeLayout = 1;
+
+enum class ZeticModelType : uint32_t {
+    Linear = 1,
+    Logistic = 2,
+    MultiClass = 3,
+    TwoLayerMLP = 4
+};
+
+enum class ZeticSectionKind : uint32_t {
+    Weights = 1,
+    Name = 2
+};
+
+enum class ZeticDType : uint32_t {
+    Float32 = 1,
+    Float16 = 2,
+    BFloat16 = 3
+};
+
+#pragma pack(push, 1)
+
+struct ZeticHeader {
+    char magic[4];                  // kZeticMagic
+    uint16_t version_major;
+    uint16_t version_minor;
+    uint32_t model_type;            // ZeticModelType
+    uint32_t num_dims;              // Entries used in dims
+    uint64_t dims[kZeticMaxDims];   // Constructor shape, e.g. {input, hidden, output}
+    uint32_t section_count;
+    uint32_t reserved0;
+    uint64_t section_table_offset;
+};
+
+struct ZeticSection {
+    uint32_t kind;                  // ZeticSectionKind
+    uint32_t dtype;                 // ZeticDType (Weights only)
+    uint32_t layout;                // kZeticNativeLayout (Weights only)
+    uint32_t reserved0;
+    uint64_t offset;                // From start of file, kZeticAlignment aligned
+    uint64_t size_bytes;
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(ZeticHeader) == 64, "ZeticHeader must be 64 bytes");
+static_assert(sizeof(ZeticSection) == 32, "ZeticSection must be 32 bytes");
+
+} // namespace ZeticML
@@ -0,0 +1,281 @@
+/**
+ * ZeticML Assignment - Micro-Batching Scheduler Unit Tests
+ * Coalescing, latency window, statistics and histogram behaviour
+ */
+
+#include "doctest.h"
+#include "../src/batch_scheduler.h"
+#include "../src/model_registry.h"
+#include "../src/thread_pool.h"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <limits>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<const ZeticML::NeuralNetwork> make_mlp() {
+    auto model = ZeticML::get_model_registry().create_model("mlp", 6, 20, 3);
+    std::vector<float> params(6 * 20 + 20 + 20 * 3 + 3);
+    for (size_t i = 0; i < params.size(); ++i) {
+        params[i] = std::sin(static_cast<float>(i) * 0.21f);
+    }
+    model->set_parameters(std::move(params));
+    return std::shared_ptr<const ZeticML::NeuralNetwork>(std::move(model));
+}
+
+std::vector<float> make_input(size_t size, int seed) {
+    std::vector<float> input(size);
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = std::cos(static_cast<float>(seed * 7 + static_cast<int>(i)) * 0.3f);
+    }
+    return input;
+}
+
+#if ZETIC_HAS_COROUTINES
+// Minimal eagerly started, fire-and-forget coroutine for the tests
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// A coroutine function rather than a lambda: a lambda's captures would die
+// with the closure at the first suspension
+DetachedTask forward_twice(ZeticML::BatchScheduler& scheduler, std::promise<std::vector<float>>& result,
+                           std::promise<bool>& rejected) {
+    result.set_value(co_await scheduler.async_forward(make_input(6, 3)));
+    try {
+        co_await scheduler.async_forward(std::vector<float>(2, 0.0f));
+        rejected.set_value(false);
+    } catch (const std::invalid_argument&) {
+        rejected.set_value(true);
+    }
+}
+#endif
+
+} // namespace
+
+TEST_CASE("Histogram") {
+    using namespace ZeticML;
+
+    Histogram h;
+    CHECK(h.count() == 0);
+    CHECK(h.percentile(0.5) == 0);
+
+    for (uint64_t v = 1; v <= 100; ++v) {
+        h.record(v);
+    }
+    CHECK(h.count() == 100);
+    CHECK(h.min() == 1);
+    CHECK(h.max() == 100);
+    CHECK(h.mean() == doctest::Approx(50.5));
+    CHECK(h.bucket_count(Histogram::bucket_index(5)) == 1);   // exact below 16
+    CHECK(h.bucket_count(Histogram::bucket_index(50)) == 4);  // 48..51
+    CHECK(h.percentile(0.5) == 51);                           // 48..51 bucket
+    CHECK(h.percentile(1.0) == 100);                          // clamped to max
+    CHECK(h.percentile(0.0) == 1);
+
+    // Log-linear buckets resolve every value to within 12.5%
+    for (uint64_t v : {uint64_t(0), uint64_t(15), uint64_t(16), uint64_t(1000), uint64_t(123456789),
+                       std::numeric_limits<uint64_t>::max()}) {
+        const size_t b = Histogram::bucket_index(v);
+        CHECK(b < Histogram::kBuckets);
+        CHECK(Histogram::bucket_lower_bound(b) <= v);
+        CHECK(Histogram::bucket_upper_bound(b) >= v);
+        CHECK(Histogram::bucket_upper_bound(b) - Histogram::bucket_lower_bound(b) <=
+              Histogram::bucket_lower_bound(b) / 8);
+    }
+
+    // Merging matches recording everything into one histogram
+    Histogram a, b;
+    for (uint64_t v = 1; v <= 100; ++v) {
+        (v % 2 ? a : b).record(v * 1000);
+    }
+    a.merge(b);
+    CHECK(a.count() == 100);
+    CHECK(a.min() == 1000);
+    CHECK(a.max() == 100000);
+    CHECK(a.mean() == doctest::Approx(50500.0));
+}
+
+TEST_CASE("Batch Scheduler") {
+    using namespace ZeticML;
+
+    auto model = make_mlp();
+
+    SUBCASE("Concurrent requests are coalesced and answered correctly") {
+        BatchScheduler::Options options;
+        options.max_batch_size = 16;
+        options.max_latency = std::chrono::milliseconds(2);
+        BatchScheduler scheduler(model, options);
+
+        const int num_threads = 8, per_thread = 50;
+        std::vector<std::thread> threads;
+        std::vector<int> mismatches(num_threads, 0);
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t] {
+                std::vector<std::future<std::vector<float>>> futures;
+                for (int i = 0; i < per_thread; ++i) {
+                    futures.push_back(scheduler.submit(make_input(6, t * per_thread + i)));
+                }
+                for (int i = 0; i < per_thread; ++i) {
+                    auto expected = model->forward(make_input(6, t * per_thread + i));
+                    if (futures[i].get() != expected) {
+                        ++mismatches[t];
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (int m : mismatches) {
+            CHECK(m == 0);
+        }
+
+        auto stats = scheduler.stats();
+        CHECK(stats.requests == num_threads * per_thread);
+        CHECK(stats.batch_size.count() == stats.batches);
+        CHECK(stats.batch_size.max() <= 16);
+        CHECK(stats.batch_size.mean() * stats.batches == doctest::Approx(num_threads * per_thread));
+        CHECK(stats.queue_depth.count() == stats.requests);
+        CHECK(stats.queue_wait_us.count() == stats.requests);
+
+        scheduler.reset_stats();
+        CHECK(scheduler.stats().requests == 0);
+    }
+
+    SUBCASE("A full batch does not wait for the window") {
+        BatchScheduler::Options options;
+        options.max_batch_size = 4;
+        options.max_latency = std::chrono::seconds(30);
+        BatchScheduler scheduler(model, options);
+
+        std::vector<std::future<std::vector<float>>> futures;
+        for (int i = 0; i < 4; ++i) {
+            futures.push_back(scheduler.submit(make_input(6, i)));
+        }
+        for (auto& future : futures) {
+            REQUIRE(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            CHECK(future.get().size() == 3);
+        }
+        CHECK(scheduler.stats().batch_size.max() == 4);
+    }
+
+    SUBCASE("A lone request is dispatched when the window closes") {
+        BatchScheduler::Options options;
+        options.max_batch_size = 64;
+        options.max_latency = std::chrono::milliseconds(20);
+        BatchScheduler scheduler(model, options);
+
+        auto future = scheduler.submit(make_input(6, 1));
+        CHECK(future.get() == model->forward(make_input(6, 1)));
+        auto stats = scheduler.stats();
+        CHECK(stats.batches == 1);
+        CHECK(stats.queue_wait_us.min() >= 20000);
+    }
+
+    SUBCASE("Shutdown drains queued requests") {
+        std::future<std::vector<float>> future;
+        {
+            BatchScheduler::Options options;
+            options.max_latency = std::chrono::seconds(30);
+            BatchScheduler scheduler(model, options);
+            future = scheduler.submit(make_input(6, 2));
+        }
+        REQUIRE(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        CHECK(future.get() == model->forward(make_input(6, 2)));
+    }
+
+    SUBCASE("Validation") {
+        BatchScheduler scheduler(model);
+        CHECK_THROWS_AS(scheduler.submit(std::vector<float>(5, 0.0f)), std::invalid_argument);
+        BatchScheduler::Options bad;
+        bad.max_batch_size = 0;
+        CHECK_THROWS_AS(BatchScheduler(model, bad), std::invalid_argument);
+        CHECK_THROWS_AS(BatchScheduler(nullptr), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Batch Scheduler Async API") {
+    using namespace ZeticML;
+
+    auto model = make_mlp();
+    const int requests = 40;
+
+    SUBCASE("Completions run on the dispatcher with the same outputs") {
+        BatchScheduler::Options options;
+        options.max_batch_size = 8;
+        options.max_latency = std::chrono::milliseconds(2);
+        BatchScheduler scheduler(model, options);
+
+        std::atomic<int> completed{0};
+        std::atomic<int> mismatches{0};
+        std::atomic<int> on_caller_thread{0};
+        std::promise<void> all_done;
+        const std::thread::id caller = std::this_thread::get_id();
+        for (int i = 0; i < requests; ++i) {
+            const std::vector<float> expected = model->forward(make_input(6, i));
+            scheduler.submit(make_input(6, i), [&, expected](std::vector<float> output, std::exception_ptr error) {
+                if (error || output != expected) {
+                    ++mismatches;
+                }
+                if (std::this_thread::get_id() == caller) {
+                    ++on_caller_thread;
+                }
+                if (++completed == requests) {
+                    all_done.set_value();
+                }
+            });
+        }
+        REQUIRE(all_done.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+        CHECK(mismatches == 0);
+        CHECK(on_caller_thread == 0);
+        CHECK(scheduler.stats().requests == static_cast<uint64_t>(requests));
+    }
+
+    SUBCASE("Batches can run on a thread pool") {
+        ThreadPool pool(ThreadPool::Options{2, false});
+        BatchScheduler::Options options;
+        options.max_batch_size = 32;
+        options.max_latency = std::chrono::milliseconds(2);
+        options.pool = &pool;
+        BatchScheduler scheduler(model, options);
+
+        std::vector<std::future<std::vector<float>>> futures;
+        for (int i = 0; i < requests; ++i) {
+            futures.push_back(scheduler.submit(make_input(6, i)));
+        }
+        for (int i = 0; i < requests; ++i) {
+            CHECK(futures[i].get() == model->forward(make_input(6, i)));
+        }
+    }
+
+#if ZETIC_HAS_COROUTINES
+    SUBCASE("co_await async_forward") {
+        BatchScheduler::Options options;
+        options.max_latency = std::chrono::milliseconds(1);
+        BatchScheduler scheduler(model, options);
+
+        std::promise<std::vector<float>> result;
+        std::promise<bool> rejected;
+        forward_twice(scheduler, result, rejected);
+        CHECK(result.get_future().get() == model->forward(make_input(6, 3)));
+        CHECK(rejected.get_future().get());
+    }
+#endif
+
+    SUBCASE("Validation") {
+        BatchScheduler scheduler(model);
+        auto ignore = [](std::vector<float>, std::exception_ptr) {};
+        CHECK_THROWS_AS(scheduler.submit(std::vector<float>(5, 0.0f), ignore), std::invalid_argument);
+        CHECK_THROWS_AS(scheduler.submit(make_input(6, 0), BatchScheduler::Completion()), std::invalid_argument);
+    }
+}
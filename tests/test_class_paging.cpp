@@ -0,0 +1,151 @@
+/**
+ * ZeticML Assignment - Candidate Classes and Lazy Class Paging Unit Tests
+ * MultiClassClassifier candidate scoring against the full head, and per
+ * class block paging of mapped .zetic weights
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/model_loader.h"
+#include "../src/multi_class_classifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("Candidate Class Scores") {
+    using namespace ZeticML;
+
+    const size_t I = 29, C = 1500;
+    MultiClassClassifier model(I, C);
+    model.set_parameters(make_values(model.get_parameters().size(), 0.6f, 0.3f));
+    const auto x = make_values(I, 2.0f);
+    const auto full = model.forward(x);
+
+    // Runs of consecutive ids, scattered ids and the last class
+    const std::vector<size_t> candidates = {7, 8, 9, 10, 400, 3, 1499, 1000, 1001};
+    const auto probabilities = model.forward_candidates(x, candidates);
+    REQUIRE(probabilities.size() == candidates.size());
+    float mass = 0.0f;
+    for (size_t c : candidates) {
+        mass += full[c];
+    }
+    float total = 0.0f;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        CHECK(probabilities[i] == doctest::Approx(full[candidates[i]] / mass).epsilon(1e-4));
+        total += probabilities[i];
+    }
+    CHECK(total == doctest::Approx(1.0f));
+
+    // Logits differ from log-probabilities by the same constant everywhere
+    const auto logits = model.forward_candidates(x, candidates, TopKScore::Logit);
+    const float shift = logits[0] - std::log(full[candidates[0]]);
+    for (size_t i = 1; i < candidates.size(); ++i) {
+        CHECK(logits[i] - std::log(full[candidates[i]]) == doctest::Approx(shift).epsilon(1e-3));
+    }
+
+    // Top-k over more candidates than one chunk
+    std::vector<size_t> many;
+    for (size_t c = 1; c < C; c += 3) {
+        many.push_back(c);
+    }
+    const auto top = model.top_k_candidates(x, many, 4);
+    const auto all_scores = model.forward_candidates(x, many);
+    REQUIRE(top.size() == 4);
+    for (size_t i = 0; i < top.size(); ++i) {
+        CHECK(top[i].index % 3 == 1);
+        CHECK(top[i].score == doctest::Approx(all_scores[top[i].index / 3]).epsilon(1e-4));
+        if (i > 0) {
+            CHECK(top[i].score <= top[i - 1].score);
+        }
+    }
+    const size_t best = static_cast<size_t>(std::max_element(all_scores.begin(), all_scores.end()) -
+                                            all_scores.begin());
+    CHECK(top[0].index == many[best]);
+    CHECK(model.top_k_candidates(x, {42}, 1, TopKScore::Logit)[0].index == 42);
+
+    CHECK_THROWS_AS(model.forward_candidates(x, {}), std::invalid_argument);
+    CHECK_THROWS_AS(model.forward_candidates(x, {C}), std::invalid_argument);
+    CHECK_THROWS_AS(model.forward_candidates(make_values(I - 1, 0.0f), {1}), std::invalid_argument);
+    CHECK_THROWS_AS(model.top_k_candidates(x, {1, 2}, 3), std::invalid_argument);
+    std::vector<float> wrong(2);
+    CHECK_THROWS_AS(model.candidate_scores_into(Span<const float>(x), Span<const size_t>(candidates),
+                                                Span<float>(wrong)),
+                    std::invalid_argument);
+}
+
+TEST_CASE("Lazy Class Paging") {
+    using namespace ZeticML;
+
+    // 64 inputs: 256-byte rows, 256 classes per 64 KB block
+    const size_t I = 64, C = 65536;
+    const std::string path = "class_paging_test.zetic";
+    MultiClassClassifier source(I, C);
+    source.set_parameters(make_values(source.get_parameters().size(), 0.1f, 0.2f));
+    save_zetic_model(source, path);
+
+    // Heap-backed weights: always resident, paging calls do nothing
+    ClassPagingStats heap_stats = source.class_paging_stats();
+    CHECK_FALSE(heap_stats.file_backed);
+    CHECK(source.release_class_pages() == 0);
+
+    {
+        // Loading never builds (or zero-fills) a heap copy of the weights;
+        // the slack is for large page-cache folios of the file
+        const size_t weight_bytes = source.parameter_block().size_bytes();
+        const bool measured = reset_peak_resident();
+        const size_t before = peak_resident_bytes();
+        auto loaded = load_zetic_model(path);
+        auto* model = dynamic_cast<MultiClassClassifier*>(loaded.get());
+        REQUIRE(model != nullptr);
+        if (measured) {
+            CHECK(peak_resident_bytes() - before < weight_bytes / 4);
+        }
+
+        ClassPagingStats stats = model->class_paging_stats();
+        CHECK(stats.file_backed);
+        CHECK_FALSE(stats.lazy);
+        CHECK(stats.classes_per_block == 256);
+        CHECK(stats.blocks == (C + 255) / 256);
+        CHECK(stats.paged_blocks == 0);
+
+        model->set_lazy_paging(true);
+        const auto x = make_values(I, 0.5f);
+        const std::vector<size_t> candidates = {3, 4, 255, 19999};
+        const auto expected = source.forward_candidates(x, candidates);
+        const auto scores = model->forward_candidates(x, candidates);
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            CHECK(scores[i] == doctest::Approx(expected[i]));
+        }
+        CHECK(model->class_paging_stats().paged_blocks == 2);
+        // Resident memory follows the blocks used, not the class count
+        if (measured) {
+            CHECK(peak_resident_bytes() - before < weight_bytes / 2);
+        }
+
+        model->prefetch_classes(std::vector<size_t>{256, 10000});
+        CHECK(model->class_paging_stats().paged_blocks == 4);
+
+        // Clones share the weights and therefore the paging state
+        auto copy = model->clone();
+        CHECK(dynamic_cast<MultiClassClassifier&>(*copy).class_paging_stats().paged_blocks == 4);
+
+        // Released pages are read back from the file on the next use
+        CHECK(model->release_class_pages() == C * I * sizeof(float));
+        CHECK(model->class_paging_stats().paged_blocks == 0);
+        const auto again = model->forward_candidates(x, candidates);
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            CHECK(again[i] == scores[i]);
+        }
+        CHECK(model->top_k(x, 1)[0].index == source.top_k(x, 1)[0].index);
+        CHECK_THROWS_AS(model->prefetch_classes(std::vector<size_t>{C}), std::invalid_argument);
+
+        // Re-binding (here through a precision change) starts a fresh state
+        model->set_weight_precision(WeightPrecision::Float16);
+        CHECK_FALSE(model->class_paging_stats().file_backed);
+        CHECK(model->class_paging_stats().lazy);
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,224 @@
+/**
+ * ZeticML Assignment - Binary Dataset Unit Tests
+ * .zds round trips, text conversion, zero-copy batches and evaluation
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/dataset_file.h"
+#include "../src/model_registry.h"
+#include "../src/quantization.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool aligned(const float* p) {
+    return reinterpret_cast<uintptr_t>(p) % ZeticML::kZdsAlignment == 0;
+}
+
+bool exists(const std::string& path) {
+    return std::ifstream(path).good();
+}
+
+} // namespace
+
+TEST_CASE("Zds Round Trip") {
+    using namespace ZeticML;
+
+    const size_t rows = 301, in = 7, out = 3, params = 5;
+    const auto inputs = make_values(rows * in, 0.1f);
+    const auto expected = make_values(rows * out, 0.7f);
+    const auto parameters = make_values(rows * params, 1.3f);
+    const std::string path = "zds_roundtrip_test.zds";
+
+    {
+        // Appended in uneven chunks, like a streaming converter would
+        DatasetWriter writer(path, in, out, params);
+        for (size_t first = 0; first < rows; first += 64) {
+            const size_t count = std::min<size_t>(64, rows - first);
+            writer.append(inputs.data() + first * in, expected.data() + first * out,
+                          parameters.data() + first * params, count);
+        }
+        CHECK(writer.finish() == rows);
+    }
+    CHECK_FALSE(exists(path + ".expected.tmp"));
+    CHECK_FALSE(exists(path + ".parameters.tmp"));
+
+    const DatasetFile dataset(path);
+    REQUIRE(dataset.rows() == rows);
+    CHECK(dataset.input_size() == in);
+    CHECK(dataset.output_size() == out);
+    CHECK(dataset.parameter_size() == params);
+    CHECK(aligned(dataset.inputs()));
+    CHECK(aligned(dataset.expected()));
+    CHECK(aligned(dataset.parameters()));
+    CHECK(std::equal(inputs.begin(), inputs.end(), dataset.inputs()));
+    CHECK(std::equal(expected.begin(), expected.end(), dataset.expected()));
+    CHECK(std::equal(parameters.begin(), parameters.end(), dataset.parameters()));
+    CHECK(dataset.row_parameters(300)[4] == parameters[300 * params + 4]);
+
+    // Batches are views into the mapping
+    DatasetBatch batch = dataset.batch(256, 100);
+    CHECK(batch.rows == 45);
+    CHECK(batch.inputs == dataset.inputs() + 256 * in);
+    CHECK(batch.expected_output(44)[2] == expected[300 * out + 2]);
+    CHECK(dataset.batch(400, 10).rows == 0);
+
+    // Feature-only datasets have no expected column
+    save_dataset_file(path, 2, inputs.data(), in, nullptr, 0);
+    const DatasetFile features(path);
+    CHECK(features.rows() == 2);
+    CHECK(features.output_size() == 0);
+    CHECK(features.expected() == nullptr);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Zds Text Conversion") {
+    using namespace ZeticML;
+
+    const std::string text_path = "zds_convert_test.txt";
+    const std::string path = "zds_convert_test.zds";
+    const size_t rows = 5000, in = 4, out = 2;
+    const auto inputs = make_values(rows * in, 0.5f, 10.0f);
+    const auto outputs = make_values(rows * out, 2.5f);
+    {
+        std::ofstream text(text_path);
+        text << std::setprecision(9) << "# header\n";
+        for (size_t r = 0; r < rows; ++r) {
+            text << inputs[r * in] << "," << inputs[r * in + 1] << "," << inputs[r * in + 2] << ","
+                 << inputs[r * in + 3] << " -> " << outputs[r * out] << "," << outputs[r * out + 1] << "\n";
+        }
+    }
+
+    ThreadPool pool(ThreadPool::Options{2, false});
+    CHECK(convert_text_dataset(text_path, path, &pool) == rows);
+    const DatasetFile dataset(path);
+    REQUIRE(dataset.rows() == rows);
+    CHECK(dataset.parameter_size() == 0);
+    CHECK(std::equal(inputs.begin(), inputs.end(), dataset.inputs()));
+    CHECK(std::equal(outputs.begin(), outputs.end(), dataset.expected()));
+
+    // The `|` demo files keep their per-row parameters
+    CHECK(convert_text_dataset("../tests/data/multi_class_demo.txt", path) == 3);
+    const DatasetFile demo(path);
+    CHECK(demo.input_size() == 4);
+    CHECK(demo.parameter_size() == 15);
+    CHECK(demo.output_size() == 3);
+    CHECK(demo.expected_output(0)[0] == doctest::Approx(0.576f));
+
+    std::ofstream(text_path) << "1,2 | 3 | 4\n1,2 | 3,4 | 5\n";
+    CHECK_THROWS_AS(convert_text_dataset(text_path, path), std::runtime_error);
+    CHECK_FALSE(exists(path));
+    std::ofstream(text_path) << "# nothing here\n";
+    CHECK_THROWS_AS(convert_text_dataset(text_path, path), std::runtime_error);
+
+    std::remove(text_path.c_str());
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Zds Malformed Files") {
+    using namespace ZeticML;
+
+    const std::string path = "zds_malformed_test.zds";
+    const auto inputs = make_values(64 * 8, 0.0f);
+    const auto expected = make_values(64, 0.0f);
+    save_dataset_file(path, 64, inputs.data(), 8, expected.data(), 1);
+
+    std::vector<char> bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    auto write_bytes = [&](const std::vector<char>& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+    write_bytes(std::vector<char>(bytes.begin(), bytes.end() - 100));
+    CHECK_THROWS_AS(DatasetFile{path}, std::runtime_error);
+
+    std::vector<char> bad_magic = bytes;
+    bad_magic[0] = 'X';
+    write_bytes(bad_magic);
+    CHECK_THROWS_AS(DatasetFile{path}, std::runtime_error);
+
+    std::vector<char> bad_rows = bytes;
+    bad_rows[8] = 65;      // row_count no longer matches the column sizes
+    write_bytes(bad_rows);
+    CHECK_THROWS_AS(DatasetFile{path}, std::runtime_error);
+
+    // row_count * width * sizeof(float) wraps to the (zero) column sizes
+    std::vector<char> wrapped_rows = bytes;
+    ZdsHeader header;
+    std::memcpy(&header, wrapped_rows.data(), sizeof(header));
+    header.row_count = uint64_t(1) << 62;
+    std::memcpy(wrapped_rows.data(), &header, sizeof(header));
+    for (uint32_t c = 0; c < header.column_count; ++c) {
+        char* entry = wrapped_rows.data() + header.column_table_offset + c * sizeof(ZdsColumn);
+        ZdsColumn column;
+        std::memcpy(&column, entry, sizeof(column));
+        column.size_bytes = 0;
+        std::memcpy(entry, &column, sizeof(column));
+    }
+    write_bytes(wrapped_rows);
+    CHECK_THROWS_AS(DatasetFile{path}, std::runtime_error);
+
+    CHECK_THROWS_AS(DatasetFile("does_not_exist.zds"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Zds Evaluation Harness") {
+    using namespace ZeticML;
+
+    auto model = get_model_registry().create_model("mlp", 8, 16, 4);
+    model->set_parameters(make_values(8 * 16 + 16 + 16 * 4 + 4, 0.0f, 0.5f));
+
+    // Same accuracy report from the text loader and the mapped .zds file
+    const std::string text_path = "../tests/data/quantization_calibration.txt";
+    const std::string path = "quantization_calibration.zds";
+    REQUIRE(convert_text_dataset(text_path, path) == 40);
+    const DatasetFile dataset(path);
+    const auto cases = TestDataLoader::load_from_file(text_path);
+
+    auto from_file = quantize_model(*model, dataset);
+    auto from_cases = quantize_model(*model, cases);
+    CHECK(from_file->activation_scales() == from_cases->activation_scales());
+    const QuantizationReport file_report = evaluate_quantization(*model, *from_file, dataset);
+    const QuantizationReport case_report = evaluate_quantization(*model, *from_cases, cases);
+    CHECK(file_report.samples == 40);
+    CHECK(file_report.max_abs_error == case_report.max_abs_error);
+    CHECK(file_report.fp32_mean_abs_error == case_report.fp32_mean_abs_error);
+    CHECK(file_report.fp32_mean_abs_error < 1e-3);
+
+    // Batched inference straight off the mapping
+    std::vector<float> expected(40 * 4);
+    model->forward_batch(dataset.inputs(), 40, expected.data());
+    ThreadPool pool(ThreadPool::Options{2, false});
+    for (ThreadPool* p : {static_cast<ThreadPool*>(nullptr), &pool}) {
+        size_t seen = 0;
+        const size_t rows = run_dataset(*model, dataset, [&](const DatasetBatch& batch, const float* outputs) {
+            CHECK(batch.inputs == dataset.inputs() + seen * 8);
+            for (size_t k = 0; k < batch.rows * 4; ++k) {
+                REQUIRE(outputs[k] == doctest::Approx(expected[seen * 4 + k]));
+            }
+            seen += batch.rows;
+        }, 16, p);
+        CHECK(rows == 40);
+        CHECK(seen == 40);
+    }
+
+    auto narrow = get_model_registry().create_model("linear", 3);
+    CHECK_THROWS_AS(run_dataset(*narrow, dataset, nullptr), std::invalid_argument);
+    CHECK_THROWS_AS(quantize_model(*narrow, dataset), std::invalid_argument);
+    std::remove(path.c_str());
+}
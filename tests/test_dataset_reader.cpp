@@ -0,0 +1,210 @@
+/**
+ * ZeticML Assignment - Dataset Reader Unit Tests
+ * Streaming batches, parallel parsing, malformed lines and batched inference
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/dataset_reader.h"
+#include "../src/model_registry.h"
+#include "../src/test_data_loader.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// rows lines of `in -> out`, printed with enough digits to round-trip
+void write_dataset(const std::string& path, const std::vector<float>& inputs, size_t in,
+                   const std::vector<float>& outputs, size_t out) {
+    std::ofstream file(path);
+    file << std::setprecision(9) << "# Generated dataset\n\n";
+    const size_t rows = inputs.size() / in;
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t i = 0; i < in; ++i) {
+            file << (i ? ", " : "") << inputs[r * in + i];
+        }
+        if (out > 0) {
+            file << " -> ";
+            for (size_t o = 0; o < out; ++o) {
+                file << (o ? "," : "") << outputs[r * out + o];
+            }
+        }
+        file << (r % 3 == 0 ? "\r\n" : "\n");
+        if (r % 50 == 7) {
+            file << "   # comment between rows\n";
+        }
+    }
+}
+
+void write_text(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    file << text;
+}
+
+} // namespace
+
+TEST_CASE("Dataset Line Parsing") {
+    using namespace ZeticML;
+
+    std::vector<float> inputs, outputs;
+    bool has_outputs = false;
+    const std::string line = " 1.5, -2e-3 ,+4,, 7 -> 0.25,-1\r";
+    CHECK(parse_dataset_line(line.data(), line.data() + line.size(), inputs, outputs, has_outputs) == nullptr);
+    CHECK(has_outputs);
+    CHECK(inputs == std::vector<float>{1.5f, -2e-3f, 4.0f, 7.0f});
+    CHECK(outputs == std::vector<float>{0.25f, -1.0f});
+
+    inputs.clear();
+    outputs.clear();
+    const std::string features = "3,-4";
+    CHECK(parse_dataset_line(features.data(), features.data() + features.size(), inputs, outputs, has_outputs) == nullptr);
+    CHECK_FALSE(has_outputs);
+    CHECK(inputs.size() == 2);
+    CHECK(outputs.empty());
+
+    for (const std::string bad : {"1,x,3 -> 1", "1 2 -> 3", "1,2 -> 1e99"}) {
+        inputs.clear();
+        outputs.clear();
+        CHECK(parse_dataset_line(bad.data(), bad.data() + bad.size(), inputs, outputs, has_outputs) != nullptr);
+    }
+}
+
+TEST_CASE("Dataset Reader Streaming Batches") {
+    using namespace ZeticML;
+
+    const size_t rows = 1000, in = 6, out = 3;
+    const auto inputs = make_values(rows * in, 0.2f, 3.0f);
+    const auto outputs = make_values(rows * out, 1.1f);
+    const std::string path = "dataset_reader_test.txt";
+    write_dataset(path, inputs, in, outputs, out);
+
+    ThreadPool pool(ThreadPool::Options{4, false});
+    for (ThreadPool* p : {static_cast<ThreadPool*>(nullptr), &pool}) {
+        DatasetReader::Options options;
+        options.batch_rows = 300;
+        options.pool = p;
+        DatasetReader reader(path, options);
+        REQUIRE(reader.input_size() == in);
+        REQUIRE(reader.output_size() == out);
+
+        for (int pass = 0; pass < 2; ++pass) {
+            DatasetBatch batch;
+            size_t row = 0, batches = 0;
+            while (reader.next(batch)) {
+                CHECK(batch.rows == std::min<size_t>(300, rows - row));
+                CHECK(batch.input_size == in);
+                for (size_t r = 0; r < batch.rows; ++r, ++row) {
+                    for (size_t i = 0; i < in; ++i) {
+                        REQUIRE(batch.input(r)[i] == inputs[row * in + i]);
+                    }
+                    for (size_t o = 0; o < out; ++o) {
+                        REQUIRE(batch.expected_output(r)[o] == outputs[row * out + o]);
+                    }
+                }
+                ++batches;
+            }
+            CHECK(row == rows);
+            CHECK(batches == 4);
+            CHECK(reader.rows_read() == rows);
+            CHECK_FALSE(reader.next(batch));
+            reader.rewind();
+        }
+    }
+
+    // The loader parses the same file into the same values
+    auto cases = TestDataLoader::load_from_file(path);
+    REQUIRE(cases.size() == rows);
+    CHECK(cases[999].input[5] == inputs[999 * in + 5]);
+    CHECK(cases[999].expected_output[2] == outputs[999 * out + 2]);
+    CHECK(cases[0].description == "Line 3");
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Dataset Reader Malformed Files") {
+    using namespace ZeticML;
+
+    const std::string path = "dataset_reader_bad.txt";
+    auto error_of = [&](const std::string& text, ThreadPool* pool) {
+        write_text(path, text);
+        try {
+            DatasetReader::Options options;
+            options.pool = pool;
+            DatasetReader reader(path, options);
+            DatasetBatch batch;
+            while (reader.next(batch)) {
+            }
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+
+    CHECK(error_of("1,2 -> 3\n1,2,3 -> 4\n", nullptr).find("at line 2") != std::string::npos);
+    CHECK(error_of("# header\n1,2 -> 3\n1,2 -> 3,4\n", nullptr).find("at line 3") != std::string::npos);
+    CHECK(error_of("1,2 -> 3\n1,2\n", nullptr).find("Missing '->'") == 0);
+    CHECK(error_of("1,2\n1,2 -> 3\n", nullptr).find("Unexpected '->'") == 0);
+    CHECK(error_of("1,abc -> 3\n", nullptr).find("Invalid number at line 1") == 0);
+
+    // The earliest bad row wins however the parallel parse was scheduled
+    std::string text;
+    for (int r = 0; r < 900; ++r) {
+        text += (r == 400 || r == 800) ? "1,oops\n" : "1,2\n";
+    }
+    ThreadPool pool(ThreadPool::Options{4, false});
+    CHECK(error_of(text, &pool).find("at line 401 ") != std::string::npos);
+
+    // The lenient loader reports and skips bad lines instead
+    write_text(path, "1,2 -> 3\n1,x -> 3\n# note\n4,5 -> 6\n7,8\n");
+    auto cases = TestDataLoader::load_from_file(path);
+    REQUIRE(cases.size() == 3);
+    CHECK(cases[1].input == std::vector<float>{4.0f, 5.0f});
+    CHECK(cases[2].expected_output.empty());
+    std::remove(path.c_str());
+
+    CHECK_THROWS_AS(DatasetReader("does_not_exist.txt"), std::runtime_error);
+    CHECK(TestDataLoader::load_from_file("does_not_exist.txt").empty());
+}
+
+TEST_CASE("Dataset Batched Inference") {
+    using namespace ZeticML;
+
+    auto model = get_model_registry().create_model("mlp", 8, 16, 4);
+    model->set_parameters(make_values(model->get_parameters().size(), 0.3f, 0.5f));
+
+    const size_t rows = 777;
+    const auto inputs = make_values(rows * 8, 0.9f, 2.0f);
+    std::vector<float> expected(rows * 4);
+    model->forward_batch(inputs.data(), rows, expected.data());
+
+    const std::string path = "dataset_inference_test.txt";
+    write_dataset(path, inputs, 8, {}, 0);
+
+    ThreadPool pool(ThreadPool::Options{3, false});
+    for (ThreadPool* p : {static_cast<ThreadPool*>(nullptr), &pool}) {
+        DatasetReader::Options options;
+        options.batch_rows = 128;
+        options.pool = p;
+        DatasetReader reader(path, options);
+        CHECK(reader.output_size() == 0);
+
+        size_t row = 0;
+        const size_t processed = run_dataset(*model, reader, [&](const DatasetBatch& batch, const float* outputs) {
+            for (size_t k = 0; k < batch.rows * 4; ++k) {
+                REQUIRE(outputs[k] == doctest::Approx(expected[row * 4 + k]));
+            }
+            row += batch.rows;
+        });
+        CHECK(processed == rows);
+        CHECK(row == rows);
+    }
+
+    auto narrow = get_model_registry().create_model("linear", 3);
+    DatasetReader reader(path);
+    CHECK_THROWS_AS(run_dataset(*narrow, reader, nullptr), std::invalid_argument);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,99 @@
+/**
+ * ZeticML Assignment - Fixed-Shape Model Unit Tests
+ * Compile-time sized models against their runtime counterparts
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/fixed_shape_models.h"
+#include "../src/linear_regression.h"
+#include "../src/logistic_regression.h"
+#include "../src/multi_class_classifier.h"
+#include "../src/two_layer_mlp.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Runtime model with sin parameters, its fixed copy, and matching outputs
+template <class Fixed>
+void check_matches(ZeticML::NeuralNetwork& runtime) {
+    runtime.set_parameters(make_values(Fixed::kParameterCount, 0.6f, 0.8f));
+
+    auto fixed = ZeticML::to_fixed<Fixed>(runtime);
+    REQUIRE(fixed.has_value());
+
+    for (int sample = 0; sample < 4; ++sample) {
+        const auto x = make_values(Fixed::kInputSize, 0.9f * sample, 1.5f);
+        const auto expected = runtime.forward(x);
+        std::vector<float> actual(Fixed::kOutputSize);
+        fixed->forward(x.data(), actual.data());
+        for (size_t o = 0; o < Fixed::kOutputSize; ++o) {
+            CHECK(actual[o] == doctest::Approx(expected[o]).epsilon(1e-4));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("Fixed-Shape Models Match Runtime Models") {
+    using namespace ZeticML;
+
+    LinearRegression linear(3);
+    check_matches<FixedLinearRegression<3>>(linear);
+
+    LogisticRegression logistic(2);
+    check_matches<FixedLogisticRegression<2>>(logistic);
+
+    MultiClassClassifier classifier(4, 3);
+    check_matches<FixedMultiClassClassifier<4, 3>>(classifier);
+
+    TwoLayerMLP mlp(2, 3, 2);
+    check_matches<FixedTwoLayerMLP<2, 3, 2>>(mlp);
+
+    TwoLayerMLP wider(8, 16, 4);
+    check_matches<FixedTwoLayerMLP<8, 16, 4>>(wider);
+
+    // Array overloads
+    const FixedLinearRegression<3> direct(std::vector<float>{0.5f, 0.3f, 0.2f, 0.1f}.data());
+    CHECK(direct.forward({1.5f, -0.5f, 2.0f}) == doctest::Approx(1.1f));
+
+    // Shape or type mismatch
+    CHECK_FALSE(to_fixed<FixedLinearRegression<4>>(linear).has_value());
+    CHECK_FALSE(to_fixed<FixedLogisticRegression<3>>(linear).has_value());
+}
+
+TEST_CASE("Fixed-Shape Specialization Of Loaded Models") {
+    using namespace ZeticML;
+
+    TwoLayerMLP mlp(2, 3, 2);
+    mlp.set_parameters(make_values(mlp.get_parameters().size(), 1.3f));
+
+    auto fixed = make_fixed_model(mlp);
+    REQUIRE(fixed != nullptr);
+    CHECK(fixed->type_name() == "mlp");
+    CHECK(fixed->dimensions() == mlp.dimensions());
+    CHECK(fixed->get_parameters() == mlp.get_parameters());
+
+    const size_t batch = 5;
+    const auto inputs = make_values(batch * 2, 0.4f);
+    std::vector<float> expected(batch * 2), actual(batch * 2);
+    mlp.forward_batch(inputs.data(), batch, expected.data());
+    fixed->forward_batch(inputs.data(), batch, actual.data());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        CHECK(actual[i] == doctest::Approx(expected[i]).epsilon(1e-4));
+    }
+
+    // Clones and re-parameterization stay fixed-shape
+    auto copy = fixed->clone();
+    copy->set_parameters(std::vector<float>(mlp.get_parameters().size(), 0.0f));
+    CHECK(copy->forward({1.0f, 1.0f}) == std::vector<float>{0.0f, 0.0f});
+    CHECK(fixed->forward({1.0f, 1.0f})[1] == doctest::Approx(mlp.forward({1.0f, 1.0f})[1]));
+    CHECK_THROWS_AS(copy->set_parameters(std::vector<float>(3, 0.0f)), std::invalid_argument);
+
+    // Shapes outside the build-time set stay runtime models
+    TwoLayerMLP unlisted(2, 5, 2);
+    CHECK(make_fixed_model(unlisted) == nullptr);
+    CHECK(make_fixed_model(unlisted, FixedShapeList<FixedTwoLayerMLP<2, 5, 2>>{}) != nullptr);
+}
@@ -0,0 +1,322 @@
+/**
+ * ZeticML Assignment - Layer Graph Engine Unit Tests
+ * Graph construction, planning, deep / multi-head graphs and the presets
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/graph_model.h"
+#include "../src/model_registry.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Naive dense layer over one row; W is [in x units] or [units x in]
+std::vector<float> dense_ref(const std::vector<float>& x, const float* W, size_t units,
+                             ZeticML::WeightOrder order) {
+    const size_t in = x.size();
+    const float* b = W + in * units;
+    std::vector<float> y(units);
+    for (size_t o = 0; o < units; ++o) {
+        double sum = b[o];
+        for (size_t i = 0; i < in; ++i) {
+            const float w = order == ZeticML::WeightOrder::InputMajor ? W[i * units + o] : W[o * in + i];
+            sum += static_cast<double>(w) * x[i];
+        }
+        y[o] = static_cast<float>(sum);
+    }
+    return y;
+}
+
+std::vector<float> relu_ref(std::vector<float> x) {
+    for (float& v : x) {
+        v = std::max(v, 0.0f);
+    }
+    return x;
+}
+
+std::vector<float> softmax_ref(std::vector<float> x) {
+    const float max = *std::max_element(x.begin(), x.end());
+    double sum = 0.0;
+    for (float& v : x) {
+        v = std::exp(v - max);
+        sum += v;
+    }
+    for (float& v : x) {
+        v = static_cast<float>(v / sum);
+    }
+    return x;
+}
+
+} // namespace
+
+TEST_CASE("Layer Graph Construction") {
+    using namespace ZeticML;
+
+    LayerGraph graph(5);
+    TensorId hidden = graph.relu(graph.dense(graph.input(), 8));
+    TensorId logits = graph.dense(hidden, 3, WeightOrder::OutputMajor);
+    CHECK(graph.output() == logits);
+    CHECK(graph.input_size() == 5);
+    CHECK(graph.output_size() == 3);
+    CHECK(graph.parameter_count() == 5 * 8 + 8 + 8 * 3 + 3);
+
+    // An explicit output survives later nodes
+    graph.set_output(hidden);
+    graph.sigmoid(logits);
+    CHECK(graph.output() == hidden);
+    CHECK(graph.output_size() == 8);
+
+    CHECK_THROWS_AS(graph.relu(42), std::invalid_argument);
+    CHECK_THROWS_AS(graph.add(hidden, logits), std::invalid_argument);
+    CHECK_THROWS_AS(graph.dense(hidden, 2, WeightOrder::InputMajor, DenseKernel::Dot),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(graph.concat({}), std::invalid_argument);
+    CHECK_THROWS_AS(GraphModel(LayerGraph(4)), std::invalid_argument);
+}
+
+TEST_CASE("Deep Graph Matches Reference") {
+    using namespace ZeticML;
+
+    // 10 -> 32 -> 24 -> 16 -> 6 with ReLU between layers and a softmax head
+    const std::vector<size_t> widths = {10, 32, 24, 16, 6};
+    LayerGraph graph(widths[0]);
+    TensorId x = graph.input();
+    for (size_t l = 1; l < widths.size(); ++l) {
+        x = graph.dense(x, widths[l]);
+        x = l + 1 < widths.size() ? graph.relu(x) : graph.softmax(x);
+    }
+    GraphModel model(std::move(graph));
+    CHECK(model.plan_summary() ==
+          "dense[panels]+relu 10->32\n"
+          "dense[panels]+relu 32->24\n"
+          "dense[panels]+relu 24->16\n"
+          "dense[rows]+softmax 16->6");
+
+    const auto params = make_values(model.graph().parameter_count(), 0.3f, 0.3f);
+    model.set_parameters(params);
+    CHECK(model.get_parameters() == params);
+
+    auto reference = [&](std::vector<float> row) {
+        const float* p = params.data();
+        for (size_t l = 1; l < widths.size(); ++l) {
+            row = dense_ref(row, p, widths[l], WeightOrder::InputMajor);
+            p += widths[l - 1] * widths[l] + widths[l];
+            row = l + 1 < widths.size() ? relu_ref(row) : softmax_ref(row);
+        }
+        return row;
+    };
+
+    // Several row tiles plus a ragged tail
+    const size_t batch = 150;
+    const auto inputs = make_values(batch * widths[0], 1.1f, 2.0f);
+    std::vector<float> outputs(batch * widths.back());
+    model.forward_batch(inputs.data(), batch, outputs.data());
+    for (size_t r = 0; r < batch; ++r) {
+        std::vector<float> row(inputs.begin() + r * widths[0], inputs.begin() + (r + 1) * widths[0]);
+        std::vector<float> got(outputs.begin() + r * widths.back(), outputs.begin() + (r + 1) * widths.back());
+        CHECK(max_abs_diff(reference(row), got) < 1e-5f);
+        if (r % 37 == 0) {
+            CHECK(max_abs_diff(model.forward(row), got) < 1e-6f);
+        }
+    }
+
+    // 16-bit storage covers every Rows / Panels layer
+    auto copy = model.clone();
+    copy->set_weight_precision(WeightPrecision::Float16);
+    std::vector<float> half(outputs.size());
+    copy->forward_batch(inputs.data(), batch, half.data());
+    CHECK(max_abs_diff(outputs, half) < 5e-3f);
+}
+
+TEST_CASE("Multi-Head Graph With Residual") {
+    using namespace ZeticML;
+
+    // trunk = relu(dense(x, 16)); heads: softmax(dense 4), sigmoid(dense 1),
+    // relu(dense(trunk, 16) + trunk); output = concat(heads)
+    const size_t I = 7, T = 16;
+    LayerGraph graph(I);
+    TensorId trunk = graph.relu(graph.dense(graph.input(), T));
+    TensorId classes = graph.softmax(graph.dense(trunk, 4, WeightOrder::OutputMajor));
+    TensorId score = graph.sigmoid(graph.dense(trunk, 1));
+    TensorId residual = graph.relu(graph.add(graph.dense(trunk, T), trunk));
+    graph.concat({classes, score, residual});
+    GraphModel model(std::move(graph));
+    CHECK(model.output_size() == 4 + 1 + T);
+
+    // Every head writes straight into its output columns: no concat step
+    CHECK(model.plan_summary() ==
+          "dense[panels]+relu 7->16\n"
+          "dense[rows]+softmax 16->4\n"
+          "dense[dot]+sigmoid 16->1\n"
+          "dense[panels] 16->16\n"
+          "add[in-place] 16\n"
+          "relu[in-place] 16");
+
+    const auto params = make_values(model.graph().parameter_count(), 0.9f, 0.4f);
+    model.set_parameters(params);
+    CHECK(model.get_parameters() == params);
+
+    auto reference = [&](const std::vector<float>& row) {
+        const float* p = params.data();
+        auto t = relu_ref(dense_ref(row, p, T, WeightOrder::InputMajor));
+        p += I * T + T;
+        auto c = softmax_ref(dense_ref(t, p, 4, WeightOrder::OutputMajor));
+        p += T * 4 + 4;
+        auto s = dense_ref(t, p, 1, WeightOrder::InputMajor);
+        s[0] = 1.0f / (1.0f + std::exp(-s[0]));
+        p += T + 1;
+        auto h = dense_ref(t, p, T, WeightOrder::InputMajor);
+        for (size_t i = 0; i < T; ++i) {
+            h[i] = std::max(h[i] + t[i], 0.0f);
+        }
+        std::vector<float> out = c;
+        out.insert(out.end(), s.begin(), s.end());
+        out.insert(out.end(), h.begin(), h.end());
+        return out;
+    };
+
+    const size_t batch = 70;
+    const size_t O = model.output_size();
+    const auto inputs = make_values(batch * I, 0.4f, 1.5f);
+    std::vector<float> outputs(batch * O);
+    model.forward_batch(inputs.data(), batch, outputs.data());
+    for (size_t r = 0; r < batch; ++r) {
+        std::vector<float> row(inputs.begin() + r * I, inputs.begin() + (r + 1) * I);
+        std::vector<float> got(outputs.begin() + r * O, outputs.begin() + (r + 1) * O);
+        CHECK(max_abs_diff(reference(row), got) < 1e-5f);
+    }
+
+    // A Dot layer has no 16-bit kernel
+    CHECK_THROWS_AS(model.set_weight_precision(WeightPrecision::BFloat16), std::invalid_argument);
+    CHECK(model.weight_precision() == WeightPrecision::Float32);
+
+    SUBCASE("Shared parts are copied into the concat") {
+        LayerGraph g(3);
+        TensorId d = g.dense(g.input(), 2);
+        g.concat({g.input(), d, d});
+        GraphModel passthrough(std::move(g));
+        passthrough.set_parameters(std::vector<float>{1, 0, 0, 1, 0, 0, 0.5f, -0.5f});
+        CHECK(passthrough.plan_summary() == "dense[panels] 3->2\nconcat 7");
+        auto out = passthrough.forward({1.0f, 2.0f, 3.0f});
+        CHECK(out == std::vector<float>{1.0f, 2.0f, 3.0f, 1.5f, 1.5f, 1.5f, 1.5f});
+    }
+}
+
+TEST_CASE("Presets Are Graph Models") {
+    using namespace ZeticML;
+    auto& registry = get_model_registry();
+
+    auto linear = registry.create_model("linear", 3);
+    auto logistic = registry.create_model("logistic", 3);
+    auto multiclass = registry.create_model("multiclass", 4, 3);
+    auto mlp = registry.create_model("mlp", 2, 3, 2);
+    CHECK(dynamic_cast<GraphModel&>(*linear).plan_summary() == "dense[dot] 3->1");
+    CHECK(dynamic_cast<GraphModel&>(*logistic).plan_summary() == "dense[dot]+sigmoid 3->1");
+    CHECK(dynamic_cast<GraphModel&>(*multiclass).plan_summary() == "dense[rows]+softmax 4->3");
+    CHECK(dynamic_cast<GraphModel&>(*mlp).plan_summary() ==
+          "dense[panels]+relu 2->3\ndense[panels] 3->2");
+
+    // A hand-built graph of the same shape runs bit-identically to the preset
+    // and shares its native layout
+    const size_t I = 20, H = 40, O = 5;
+    auto preset = registry.create_model("mlp", I, H, O);
+    LayerGraph graph(I);
+    graph.dense(graph.relu(graph.dense(graph.input(), H)), O, WeightOrder::InputMajor,
+                DenseKernel::Panels);
+    GraphModel custom(std::move(graph));
+
+    const auto params = make_values(I * H + H + H * O + O, 0.1f, 0.2f);
+    preset->set_parameters(params);
+    custom.share_parameters(*preset);
+    CHECK(custom.parameter_block().data() == preset->parameter_block().data());
+
+    const size_t batch = 33;
+    const auto inputs = make_values(batch * I, 2.2f);
+    std::vector<float> expected(batch * O), actual(batch * O);
+    preset->forward_batch(inputs.data(), batch, expected.data());
+    custom.forward_batch(inputs.data(), batch, actual.data());
+    CHECK(expected == actual);
+    CHECK(custom.type_name() == "graph");
+    CHECK(custom.dimensions() == std::vector<size_t>{I, O});
+}
+
+TEST_CASE("Activation Memory Plan") {
+    using namespace ZeticML;
+
+    // 10 -> 32 -> 24 -> 16 -> 6: the 32- and 16-wide activations are never
+    // live together and share arena memory
+    LayerGraph graph(10);
+    TensorId x = graph.input();
+    for (size_t units : {32, 24, 16}) {
+        x = graph.relu(graph.dense(x, units));
+    }
+    graph.dense(x, 6);
+    GraphModel model(std::move(graph));
+    model.set_parameters(make_values(model.graph().parameter_count(), 0.5f, 0.2f));
+
+    CHECK(model.tensor_floats_per_row() == 32 + 24 + 16);
+    CHECK(model.arena_floats_per_row() == 32 + 24);
+    CHECK(model.peak_activation_bytes() == 56 * sizeof(float));
+    CHECK(model.workspace_size(10) == 10 * 56);
+    CHECK(model.workspace_size(1000) == 64 * 56);
+
+    // Sized once up front; no call grows it afterwards
+    InferenceContext context;
+    model.prepare(context, 1000);
+    CHECK(context.workspace().allocations() == 1);
+    const size_t capacity = context.workspace().capacity();
+
+    const auto inputs = make_values(300 * 10, 0.7f);
+    std::vector<float> outputs(300 * 6);
+    for (size_t batch : {1, 7, 64, 65, 300}) {
+        model.forward_batch(inputs.data(), batch, outputs.data(), context);
+    }
+    std::vector<float> single(6);
+    model.forward_into(Span<const float>(inputs.data(), 10), Span<float>(single), context);
+    CHECK(context.workspace().allocations() == 1);
+    CHECK(context.workspace().capacity() == capacity);
+    CHECK(single == std::vector<float>(outputs.begin(), outputs.begin() + 6));
+
+    // Presets: only the MLP's hidden tile needs arena memory
+    auto& registry = get_model_registry();
+    CHECK(registry.create_model("linear", 8)->peak_activation_bytes(100) == 0);
+    CHECK(registry.create_model("multiclass", 8, 4)->peak_activation_bytes(100) == 0);
+    CHECK(registry.create_model("mlp", 8, 20, 3)->peak_activation_bytes(100) == 64 * 20 * sizeof(float));
+}
+
+TEST_CASE("Fused Dense Activations") {
+    using namespace ZeticML;
+
+    // Multi-label heads: sigmoid fused into a GEMM store and into row blocks
+    const size_t I = 24, H = 40, L = 9;
+    LayerGraph graph(I);
+    TensorId hidden = graph.sigmoid(graph.dense(graph.input(), H));
+    graph.sigmoid(graph.dense(hidden, L, WeightOrder::OutputMajor, DenseKernel::Rows));
+    GraphModel model(std::move(graph));
+    CHECK(model.plan_summary() == "dense[panels]+sigmoid 24->40\ndense[rows]+sigmoid 40->9");
+
+    const auto params = make_values(model.graph().parameter_count(), 0.6f, 0.3f);
+    model.set_parameters(params);
+
+    auto sigmoid_ref = [](std::vector<float> x) {
+        for (float& v : x) {
+            v = 1.0f / (1.0f + std::exp(-v));
+        }
+        return x;
+    };
+    const size_t batch = 90;
+    const auto inputs = make_values(batch * I, 0.2f, 2.0f);
+    std::vector<float> outputs(batch * L);
+    model.forward_batch(inputs.data(), batch, outputs.data());
+    for (size_t r = 0; r < batch; ++r) {
+        std::vector<float> row(inputs.begin() + r * I, inputs.begin() + (r + 1) * I);
+        auto h = sigmoid_ref(dense_ref(row, params.data(), H, WeightOrder::InputMajor));
+        auto expected = sigmoid_ref(dense_ref(h, params.data() + I * H + H, L, WeightOrder::OutputMajor));
+        std::vector<float> got(outputs.begin() + r * L, outputs.begin() + (r + 1) * L);
+        CHECK(max_abs_diff(expected, got) < 1e-5f);
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * ZeticML Assignment - 16-bit Weight Storage Unit Tests
+ * Conversions, widening kernels, fp16 / bf16 models and .zetic dtypes
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/half_precision.h"
+#include "../src/kernels.h"
+#include "../src/model_loader.h"
+#include "../src/model_registry.h"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Half Precision Conversions") {
+    using namespace ZeticML;
+
+    // Exactly representable values survive the round trip
+    for (float v : {0.0f, 1.0f, -2.5f, 0.099975586f, 65504.0f, 6.1035156e-05f, 5.9604645e-08f}) {
+        CHECK(half_to_float(float_to_half(v)) == v);
+    }
+    for (float v : {0.0f, 1.0f, -2.5f, 3.0e38f, 1.0e-38f}) {
+        const float rounded = bfloat16_to_float(float_to_bfloat16(v));
+        CHECK(std::abs(rounded - v) <= std::abs(v) / 128.0f);
+    }
+
+    CHECK(float_to_half(1.0f) == 0x3C00);
+    CHECK(float_to_half(-0.0f) == 0x8000);
+    CHECK(float_to_half(1.0e6f) == 0x7C00);                       // Overflow to Inf
+    CHECK(float_to_half(1.00048828125f) == 0x3C00);               // Tie rounds to even
+    CHECK(float_to_half(1.00146484375f) == 0x3C02);
+    CHECK(float_to_bfloat16(1.0f) == 0x3F80);
+    CHECK(std::isnan(half_to_float(float_to_half(std::numeric_limits<float>::quiet_NaN()))));
+    CHECK(std::isnan(bfloat16_to_float(float_to_bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+    CHECK(std::isinf(half_to_float(0x7C00)));
+
+    // Relative error bounds: 2^-11 for fp16, 2^-8 for bf16
+    auto values = make_values(1000, 0.2f, 10.0f);
+    std::vector<uint16_t> half(values.size());
+    std::vector<float> back(values.size());
+    narrow_weights(values.data(), values.size(), WeightPrecision::Float16, half.data());
+    widen_weights(half.data(), half.size(), WeightPrecision::Float16, back.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        CHECK(std::abs(back[i] - values[i]) <= std::abs(values[i]) / 2048.0f + 1e-7f);
+    }
+    narrow_weights(values.data(), values.size(), WeightPrecision::BFloat16, half.data());
+    widen_weights(half.data(), half.size(), WeightPrecision::BFloat16, back.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        CHECK(std::abs(back[i] - values[i]) <= std::abs(values[i]) / 256.0f);
+    }
+
+    CHECK_THROWS_AS(narrow_weights(values.data(), 1, WeightPrecision::Float32, half.data()),
+                    std::invalid_argument);
+    CHECK(precision_bytes(WeightPrecision::BFloat16) == 2);
+    CHECK(std::string(precision_name(WeightPrecision::Float16)) == "fp16");
+}
+
+TEST_CASE("Half Precision Kernels") {
+    using namespace ZeticML;
+
+    const size_t rows = 7;
+    for (const KernelTable* k : available_kernel_tables()) {
+        INFO("ISA: " << k->name);
+        for (WeightPrecision precision : {WeightPrecision::Float16, WeightPrecision::BFloat16}) {
+            INFO("Precision: " << precision_name(precision));
+            auto matvec = precision == WeightPrecision::Float16 ? k->matvec_f16 : k->matvec_bf16;
+            auto gemm = precision == WeightPrecision::Float16 ? k->gemm_f16 : k->gemm_bf16;
+
+            for (size_t n : {0, 1, 7, 16, 17, 33, 100}) {
+                const size_t stride = n + 3;
+                auto W = make_values(rows * stride, 0.4f);
+                std::vector<uint16_t> Wh(W.size());
+                narrow_weights(W.data(), W.size(), precision, Wh.data());
+                widen_weights(Wh.data(), Wh.size(), precision, W.data());
+                auto x = make_values(n, 1.3f);
+                auto bias = make_values(rows, 2.0f);
+
+                // Reference: fp32 matvec on the widened weights
+                std::vector<float> expected(rows), actual(rows);
+                k->matvec(W.data(), stride, bias.data(), rows, x.data(), n, expected.data());
+                matvec(Wh.data(), stride, bias.data(), rows, x.data(), n, actual.data());
+                CHECK(max_abs_diff(expected, actual) < 1e-5f);
+            }
+
+            // GEMM against fp32 panels holding the same widened values
+            const size_t M = 5, K = 37, N = 21;
+            auto B = make_values(K * N, 0.9f);
+            PackedMatrix packed(K, N);
+            packed.pack(B.data(), N);
+            std::vector<float> panels(packed.data(), packed.data() + PackedMatrix::packed_size(K, N));
+            std::vector<uint16_t> half_panels(panels.size());
+            narrow_weights(panels.data(), panels.size(), precision, half_panels.data());
+            widen_weights(half_panels.data(), half_panels.size(), precision, panels.data());
+
+            auto A = make_values(M * K, 0.1f);
+            auto bias = make_values(N, 0.7f);
+            std::vector<float> expected(M * N), actual(M * N);
+            k->gemm(A.data(), M, K, panels.data(), K, N, bias.data(), Epilogue::Relu, expected.data(), N);
+            gemm(A.data(), M, K, half_panels.data(), K, N, bias.data(), Epilogue::Relu, actual.data(), N);
+            CHECK(max_abs_diff(expected, actual) < 1e-5f);
+        }
+    }
+}
+
+TEST_CASE("Half Precision Models") {
+    using namespace ZeticML;
+    auto& registry = get_model_registry();
+
+    auto multiclass = registry.create_model("multiclass", 50, 12);
+    multiclass->set_parameters(make_values(50 * 12 + 12, 0.5f, 0.3f));
+    auto mlp = registry.create_model("mlp", 40, 64, 6);
+    mlp->set_parameters(make_values(40 * 64 + 64 + 64 * 6 + 6, 0.8f, 0.3f));
+
+    const size_t batch = 70;
+    for (NeuralNetwork* model : {multiclass.get(), mlp.get()}) {
+        INFO("Model: " << model->type_name());
+        const size_t I = model->input_size(), O = model->output_size();
+        auto inputs = make_values(batch * I, 0.0f, 2.0f);
+        std::vector<float> reference(batch * O);
+        model->forward_batch(inputs.data(), batch, reference.data());
+        const size_t fp32_bytes = model->parameter_block().size_bytes();
+        const auto fp32_params = model->get_parameters();
+
+        for (WeightPrecision precision : {WeightPrecision::Float16, WeightPrecision::BFloat16}) {
+            INFO("Precision: " << precision_name(precision));
+            auto copy = model->clone();
+            copy->set_weight_precision(precision);
+            CHECK(copy->weight_precision() == precision);
+            CHECK(copy->parameter_block().size_bytes() < fp32_bytes * 6 / 10);
+
+            std::vector<float> actual(batch * O);
+            copy->forward_batch(inputs.data(), batch, actual.data());
+            const float tolerance = precision == WeightPrecision::Float16 ? 5e-3f : 5e-2f;
+            CHECK(max_abs_diff(reference, actual) < tolerance);
+
+            // Single-sample path agrees with the batch
+            std::vector<float> row(inputs.begin(), inputs.begin() + I);
+            auto single = copy->forward(row);
+            for (size_t o = 0; o < O; ++o) {
+                CHECK(single[o] == doctest::Approx(actual[o]).epsilon(1e-5));
+            }
+
+            // New parameters are stored at the current precision
+            copy->set_parameters(fp32_params);
+            CHECK(copy->weight_precision() == precision);
+            CHECK(max_abs_diff(copy->get_parameters(), fp32_params) < tolerance);
+
+            // Back to fp32 keeps the rounded values
+            copy->set_weight_precision(WeightPrecision::Float32);
+            CHECK(copy->parameter_block().size_bytes() == fp32_bytes);
+        }
+    }
+
+    auto linear = registry.create_model("linear", 4);
+    CHECK_NOTHROW(linear->set_weight_precision(WeightPrecision::Float32));
+    CHECK_THROWS_AS(linear->set_weight_precision(WeightPrecision::Float16), std::invalid_argument);
+}
+
+TEST_CASE("Half Precision Zetic Files") {
+    using namespace ZeticML;
+
+    auto model = get_model_registry().create_model("mlp", 12, 20, 3);
+    model->set_parameters(make_values(12 * 20 + 20 + 20 * 3 + 3, 0.2f));
+    const auto input = make_values(12, 0.6f);
+
+    const std::string path = "zetic_half_test.zetic";
+    for (WeightPrecision precision : {WeightPrecision::Float16, WeightPrecision::BFloat16}) {
+        INFO("Precision: " << precision_name(precision));
+        model->set_weight_precision(precision);
+        save_zetic_model(*model, path);
+
+        ZeticModelInfo info = read_zetic_info(path);
+        CHECK(info.weight_precision == precision);
+        CHECK(info.weight_bytes == model->parameter_block().size_bytes());
+
+        // Bound straight to the mapped 16-bit block
+        auto loaded = load_zetic_model(path);
+        CHECK(loaded->weight_precision() == precision);
+        CHECK(loaded->forward(input) == model->forward(input));
+    }
+    std::remove(path.c_str());
+}
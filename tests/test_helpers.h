@@ -0,0 +1,54 @@
+/**
+ * ZeticML Assignment - Shared Test Helpers
+ * Deterministic inputs and comparisons used across the unit tests
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// scale * sin(i * step + phase): smooth, sign-changing values without a RNG
+inline std::vector<float> make_values(size_t count, float phase, float scale = 1.0f, float step = 0.37f) {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = scale * std::sin(static_cast<float>(i) * step + phase);
+    }
+    return values;
+}
+
+inline float max_abs_diff(const std::vector<float>& a, const std::vector<float>& b) {
+    float diff = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff = std::max(diff, std::abs(a[i] - b[i]));
+    }
+    return diff;
+}
+
+// Resident-set high-water mark since the last reset_peak_resident(); the
+// reset needs Linux 4.0+, and tests skip their memory checks when it fails
+inline bool reset_peak_resident() {
+#if defined(__linux__)
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    return static_cast<bool>(clear_refs << "5" << std::flush);
+#else
+    return false;
+#endif
+}
+
+inline size_t peak_resident_bytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        unsigned long kb = 0;
+        if (std::sscanf(line.c_str(), "VmHWM: %lu kB", &kb) == 1) {
+            return static_cast<size_t>(kb) * 1024;
+        }
+    }
+    return 0;
+}
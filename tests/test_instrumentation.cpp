@@ -0,0 +1,92 @@
+/**
+ * ZeticML Assignment - Instrumentation Unit Tests
+ * Stats sink sharding and merging, and the model hooks when compiled in
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/instrumentation.h"
+#include "../src/two_layer_mlp.h"
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Stats Sink") {
+    using namespace ZeticML;
+
+    StatsSink& sink = StatsSink::global();
+    const uint32_t id = sink.scope_id("test/sink");
+    CHECK(sink.scope_id("test/sink") == id);
+    CHECK(sink.scope_id("test/sink-other") != id);
+
+    // Each thread records into its own shard; reads merge them
+    const int num_threads = 4, per_thread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 1; i <= per_thread; ++i) {
+                sink.record(id, static_cast<uint64_t>(i) * 100, t + 1, 64);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const ScopeStats stats = sink.stats("test/sink");
+    CHECK(stats.calls == num_threads * per_thread);
+    CHECK(stats.samples == per_thread * (1 + 2 + 3 + 4));
+    CHECK(stats.bytes == uint64_t(num_threads) * per_thread * 64);
+    CHECK(stats.latency_ns.count() == stats.calls);
+    CHECK(stats.latency_ns.min() == 100);
+    CHECK(stats.latency_ns.max() == 100000);
+    CHECK(stats.latency_ns.percentile(0.5) == doctest::Approx(50000).epsilon(0.125));
+    CHECK(stats.batch_size.max() == 4);
+    CHECK(stats.to_string().find("test/sink: 4000 calls") == 0);
+
+    bool listed = false;
+    for (const ScopeStats& s : sink.snapshot()) {
+        listed = listed || s.name == "test/sink";
+    }
+    CHECK(listed);
+    CHECK(sink.stats("test/never-recorded").calls == 0);
+
+    sink.reset();
+    CHECK(sink.stats("test/sink").calls == 0);
+    CHECK(sink.stats("test/sink").latency_ns.count() == 0);
+}
+
+TEST_CASE("Model Instrumentation Hooks") {
+    using namespace ZeticML;
+
+    // A shape no other test uses, so the scopes are this test's alone
+    TwoLayerMLP model(7, 13, 5);
+    model.set_parameters(make_values(model.get_parameters().size(), 0.4f));
+    const std::string name = model.instrumentation_name();
+    CHECK(name == "mlp/7x13x5");
+
+    const auto inputs = make_values(8 * 7, 1.0f);
+    std::vector<float> outputs(8 * 5);
+    model.forward(make_values(7, 0.3f));
+    model.forward_batch(inputs.data(), 8, outputs.data());
+
+    StatsSink& sink = StatsSink::global();
+    const ScopeStats stats = sink.stats(name);
+    if (StatsSink::enabled()) {
+        CHECK(stats.calls == 2);
+        CHECK(stats.samples == 9);
+        CHECK(stats.bytes == 9 * (7 + 5) * sizeof(float));
+        CHECK(stats.batch_size.max() == 8);
+
+        // One scope per planned step, named after the plan
+        const ScopeStats hidden = sink.stats(name + "/0:dense[panels]+relu 7->13");
+        const ScopeStats output = sink.stats(name + "/1:dense[panels] 13->5");
+        CHECK(hidden.calls == 2);
+        CHECK(output.calls == 2);
+        CHECK(output.samples == 9);
+    } else {
+        // Hooks compiled out: nothing reaches the sink
+        CHECK(stats.calls == 0);
+    }
+}
@@ -0,0 +1,197 @@
+/**
+ * ZeticML Assignment - Kernel Unit Tests
+ * Runs every kernel table usable on this CPU against scalar references,
+ * including loop-tail lengths
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/kernels.h"
+#include "../src/cpu_features.h"
+#include "../src/multi_class_classifier.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+TEST_CASE("Kernel Dispatch") {
+    using namespace ZeticML;
+
+    auto tables = available_kernel_tables();
+    REQUIRE(!tables.empty());
+    CHECK(tables.back()->isa == KernelIsa::Scalar);
+    CHECK(kernel_table(KernelIsa::Scalar) != nullptr);
+
+    // The active table is one of the available ones
+    const KernelTable& active = kernels();
+    CHECK(std::find(tables.begin(), tables.end(), &active) != tables.end());
+
+    std::cout << "CPU features: " << cpu_features().to_string()
+              << ", active kernels: " << active.name << std::endl;
+}
+
+TEST_CASE("Kernel Dot, Sparse Dot And Matvec") {
+    using namespace ZeticML;
+
+    for (const KernelTable* k : available_kernel_tables()) {
+        INFO("ISA: " << k->name);
+
+        for (size_t n : {0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100}) {
+            auto a = make_values(n, 0.3f);
+            auto b = make_values(n, 1.1f);
+
+            double ref = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                ref += static_cast<double>(a[i]) * b[i];
+            }
+            CHECK(std::abs(k->dot(a.data(), b.data(), n) - ref) < 1e-4);
+
+            // Sparse: scattered indices into a wider weight vector
+            const size_t width = 1000;
+            auto w = make_values(width, 0.7f);
+            std::vector<uint32_t> indices(n);
+            double sparse_ref = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                indices[i] = static_cast<uint32_t>((i * 7919 + 13) % width);
+                sparse_ref += static_cast<double>(w[indices[i]]) * b[i];
+            }
+            CHECK(std::abs(k->sparse_dot(w.data(), indices.data(), b.data(), n) - sparse_ref) < 1e-4);
+
+            // 7 rows exercises both the 4-row kernel and the remainder
+            const size_t rows = 7, stride = n + 5;
+            auto W = make_values(rows * stride, 2.0f);
+            auto bias = make_values(rows, 0.9f);
+            std::vector<float> out(rows);
+            k->matvec(W.data(), stride, bias.data(), rows, a.data(), n, out.data());
+            for (size_t r = 0; r < rows; ++r) {
+                float expected = bias[r];
+                for (size_t i = 0; i < n; ++i) {
+                    expected += W[r * stride + i] * a[i];
+                }
+                CHECK(std::abs(out[r] - expected) < 1e-4f);
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernel Activations") {
+    using namespace ZeticML;
+
+    for (const KernelTable* k : available_kernel_tables()) {
+        INFO("ISA: " << k->name);
+
+        for (size_t n : {1, 2, 5, 8, 13, 16, 29, 1000, 2500}) {
+            // Large magnitudes check the max-subtraction and exp range handling
+            auto x = make_values(n, 0.4f, 40.0f);
+            auto expected = x;
+
+            float max_value = *std::max_element(expected.begin(), expected.end());
+            double sum = 0.0;
+            for (auto& v : expected) {
+                v = std::exp(v - max_value);
+                sum += v;
+            }
+            for (auto& v : expected) {
+                v = static_cast<float>(v / sum);
+            }
+
+            k->softmax(x.data(), n);
+            double total = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(std::abs(x[i] - expected[i]) < 1e-6f + 1e-5f * expected[i]);
+                total += x[i];
+            }
+            CHECK(std::abs(total - 1.0) < 1e-5);
+
+            // Online statistics folded over uneven chunks give the same row
+            auto chunked = make_values(n, 0.4f, 40.0f);
+            float max_value_online = std::numeric_limits<float>::lowest(), sum_online = 0.0f;
+            for (size_t i = 0; i < n; i += 7 + i % 11) {
+                const size_t len = std::min<size_t>(7 + i % 11, n - i);
+                k->softmax_stats(chunked.data() + i, len, &max_value_online, &sum_online);
+            }
+            CHECK(max_value_online == max_value);
+            k->softmax_normalize(chunked.data(), n, max_value_online, sum_online);
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(std::abs(chunked[i] - expected[i]) < 1e-6f + 1e-5f * expected[i]);
+            }
+
+            auto s = make_values(n, 0.8f, 12.0f);
+            auto s_ref = s;
+            k->sigmoid(s.data(), n);
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(std::abs(s[i] - 1.0f / (1.0f + std::exp(-s_ref[i]))) < 1e-6f);
+            }
+
+            auto h = make_values(n, 1.9f);
+            auto bias = make_values(n, 0.2f);
+            auto h_ref = h;
+            k->bias_relu(h.data(), bias.data(), n);
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(h[i] == std::max(0.0f, h_ref[i] + bias[i]));
+            }
+        }
+    }
+}
+
+TEST_CASE("Kernel Packed GEMM") {
+    using namespace ZeticML;
+
+    const size_t M = 19, K = 300, N = 35;
+    auto A = make_values(M * K, 0.1f);
+    auto Bsrc = make_values(K * N, 0.7f);
+    auto bias = make_values(N, 1.3f);
+    PackedMatrix B(K, N);
+    B.pack(Bsrc.data(), N);
+
+    for (const KernelTable* k : available_kernel_tables()) {
+        INFO("ISA: " << k->name);
+
+        std::vector<float> C(M * N, -7.0f);
+        k->gemm(A.data(), M, K, B.panel(0), K, N, bias.data(), Epilogue::Relu, C.data(), N);
+        for (size_t m = 0; m < M; ++m) {
+            for (size_t n = 0; n < N; ++n) {
+                float ref = bias[n];
+                for (size_t i = 0; i < K; ++i) {
+                    ref += A[m * K + i] * Bsrc[i * N + n];
+                }
+                CHECK(std::abs(C[m * N + n] - std::max(0.0f, ref)) < 1e-3f);
+            }
+        }
+    }
+}
+
+TEST_CASE("Multi-Class Classifier Many Classes") {
+    using namespace ZeticML;
+
+    const size_t input_size = 45, num_classes = 3001;   // Three class blocks
+    MultiClassClassifier model(input_size, num_classes);
+    auto params = make_values(num_classes * input_size + num_classes, 0.5f);
+    model.set_parameters(params);
+
+    const size_t batch_size = 5;
+    auto batch = make_values(batch_size * input_size, 1.7f);
+    std::vector<float> output(batch_size * num_classes);
+    model.forward_batch(batch.data(), batch_size, output.data());
+
+    std::vector<double> logits(num_classes);
+    for (size_t r = 0; r < batch_size; ++r) {
+        const float* x = batch.data() + r * input_size;
+        for (size_t c = 0; c < num_classes; ++c) {
+            double acc = params[num_classes * input_size + c];
+            for (size_t i = 0; i < input_size; ++i) {
+                acc += static_cast<double>(params[c * input_size + i]) * x[i];
+            }
+            logits[c] = acc;
+        }
+        double max_logit = *std::max_element(logits.begin(), logits.end());
+        double sum = 0.0;
+        for (double l : logits) {
+            sum += std::exp(l - max_logit);
+        }
+        for (size_t c = 0; c < num_classes; ++c) {
+            double expected = std::exp(logits[c] - max_logit) / sum;
+            CHECK(std::abs(output[r * num_classes + c] - expected) < 1e-5);
+        }
+    }
+}
@@ -0,0 +1,242 @@
+/**
+ * ZeticML Assignment - Memory Placement Unit Tests
+ * Huge-page and NUMA-placed allocations, placed loading and per-node replicas
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/memory_placement.h"
+#include "../src/model_loader.h"
+#include "../src/parallel_inference.h"
+#include "../src/replicated_model.h"
+#include "../src/thread_pool.h"
+#include "../src/two_layer_mlp.h"
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Hidden layer of 256 x 2304 floats: 2.25 MB, above one 2 MB huge page
+constexpr size_t kIn = 256, kHidden = 2304, kOut = 8;
+constexpr size_t kParams = kIn * kHidden + kHidden + kHidden * kOut + kOut;
+
+// Restores the process-wide placement when a test leaves
+struct PlacementGuard {
+    ~PlacementGuard() { ZeticML::set_default_weight_placement(ZeticML::MemoryPlacement()); }
+};
+
+} // namespace
+
+TEST_CASE("NUMA Topology") {
+    using namespace ZeticML;
+
+    const NumaTopology& topology = numa_topology();
+    REQUIRE(topology.num_nodes() >= 1);
+    size_t cpus = 0;
+    for (size_t node = 0; node < topology.num_nodes(); ++node) {
+        for (size_t cpu : topology.node_cpus[node]) {
+            CHECK(topology.node_of_cpu(cpu) == node);
+            ++cpus;
+        }
+    }
+    CHECK(cpus >= 1);
+    CHECK(current_numa_node() < topology.num_nodes());
+
+    // Node-pinned workers only ever run on their own node
+    ThreadPool pool(ThreadPool::Options{3, false, true});
+    std::atomic<size_t> bad_nodes{0};
+    std::vector<int> touched(64, 0);
+    pool.parallel_for(0, touched.size(), 4, [&](size_t begin, size_t end) {
+        if (current_numa_node() >= topology.num_nodes()) {
+            ++bad_nodes;
+        }
+        for (size_t i = begin; i < end; ++i) {
+            ++touched[i];
+        }
+    });
+    CHECK(bad_nodes == 0);
+    for (int count : touched) {
+        CHECK(count == 1);
+    }
+}
+
+TEST_CASE("Placed Allocation") {
+    using namespace ZeticML;
+
+    const size_t large = 3 << 20, small = 1000;
+    for (HugePages pages : {HugePages::Off, HugePages::Transparent, HugePages::Explicit}) {
+        for (NumaPolicy numa : {NumaPolicy::Default, NumaPolicy::Local, NumaPolicy::Interleave}) {
+            MemoryPlacement placement;
+            placement.huge_pages = pages;
+            placement.numa = numa;
+            placement.node = numa == NumaPolicy::Local ? 0 : -1;
+            INFO("Pages: " << static_cast<int>(pages) << " NUMA: " << static_cast<int>(numa));
+
+            for (size_t bytes : {large, small}) {
+                PlacedMemory memory = allocate_placed(bytes, placement);
+                REQUIRE(memory.data != nullptr);
+                CHECK(memory.bytes == bytes);
+                CHECK(reinterpret_cast<uintptr_t>(memory.data) % kSimdAlignment == 0);
+                // Granted at most what was asked; small ranges never get huge pages
+                CHECK(static_cast<int>(memory.huge_pages) <= static_cast<int>(pages));
+                if (bytes == small) {
+                    CHECK(memory.huge_pages == HugePages::Off);
+                }
+                if (numa == NumaPolicy::Default) {
+                    CHECK_FALSE(memory.numa_applied);
+                }
+
+                unsigned char* data = static_cast<unsigned char*>(memory.data);
+                size_t nonzero = 0;
+                for (size_t i = 0; i < bytes; i += 4093) {
+                    nonzero += data[i] != 0;
+                    data[i] = 0x5A;
+                }
+                CHECK(nonzero == 0);
+                CHECK(data[0] == 0x5A);
+            }
+        }
+    }
+
+    CHECK(allocate_placed(0, MemoryPlacement()).data == nullptr);
+
+    MemoryPlacement missing;
+    missing.numa = NumaPolicy::Local;
+    missing.node = static_cast<int>(numa_topology().num_nodes());
+    CHECK_THROWS_AS(allocate_placed(large, missing), std::invalid_argument);
+}
+
+TEST_CASE("Weight Placement") {
+    using namespace ZeticML;
+
+    const std::vector<float> params = make_values(kParams, 0.4f);
+    const std::vector<float> input = make_values(kIn, 1.1f);
+    TwoLayerMLP reference(kIn, kHidden, kOut);
+    reference.set_parameters(params);
+    const std::vector<float> expected = reference.forward(input);
+
+    SUBCASE("WeightBlock::place copies into placed memory") {
+        MemoryPlacement placement;
+        placement.huge_pages = HugePages::Transparent;
+        placement.numa = NumaPolicy::Interleave;
+        const WeightBlock& source = reference.parameter_block();
+        WeightBlock placed = WeightBlock::place(source, placement);
+        REQUIRE(placed.size() == source.size());
+        CHECK(placed.data() != source.data());
+        CHECK(std::equal(source.data(), source.data() + source.size(), placed.data()));
+
+        TwoLayerMLP model(kIn, kHidden, kOut);
+        model.bind_parameters(placed);
+        CHECK(model.forward(input) == expected);
+    }
+
+    SUBCASE("The default placement applies to packed parameters") {
+        PlacementGuard guard;
+        MemoryPlacement placement;
+        placement.huge_pages = HugePages::Transparent;
+        placement.numa = NumaPolicy::Interleave;
+        set_default_weight_placement(placement);
+        CHECK(default_weight_placement().numa == NumaPolicy::Interleave);
+
+        TwoLayerMLP model(kIn, kHidden, kOut);
+        model.set_parameters(params);
+        CHECK(model.forward(input) == expected);
+        model.set_weight_precision(WeightPrecision::Float16);
+        TwoLayerMLP half(kIn, kHidden, kOut);
+        half.set_weight_precision(WeightPrecision::Float16);
+        half.set_parameters(params);
+        CHECK(model.forward(input) == half.forward(input));
+    }
+
+    SUBCASE("Loading into placed memory") {
+        const std::string path = "zetic_placement_test.zetic";
+        save_zetic_model(reference, path);
+
+        auto mapped = load_zetic_model(path);
+        CHECK(mapped->parameter_block().file_backed());
+
+        ZeticLoadOptions options;
+        options.placement.huge_pages = HugePages::Transparent;
+        auto placed = load_zetic_model(path, options);
+        CHECK_FALSE(placed->parameter_block().file_backed());
+        CHECK(placed->forward(input) == expected);
+        CHECK(mapped->forward(input) == expected);
+        std::remove(path.c_str());
+    }
+}
+
+TEST_CASE("Replicated Model") {
+    using namespace ZeticML;
+
+    const std::vector<float> params = make_values(kParams, 0.7f);
+    TwoLayerMLP reference(kIn, kHidden, kOut);
+    reference.set_parameters(params);
+
+    const size_t rows = 24;
+    const std::vector<float> batch = make_values(rows * kIn, 0.2f);
+    std::vector<float> expected(rows * kOut);
+    reference.forward_batch(batch.data(), rows, expected.data());
+    const std::vector<float> row(batch.begin(), batch.begin() + kIn);
+    const std::vector<float> expected_row(expected.begin(), expected.begin() + kOut);
+
+    ReplicatedModel replicated(reference, HugePages::Transparent);
+    CHECK(replicated.num_replicas() == numa_topology().num_nodes());
+    CHECK(replicated.huge_pages() == HugePages::Transparent);
+    CHECK(replicated.type_name() == reference.type_name());
+    CHECK(replicated.dimensions() == reference.dimensions());
+    CHECK(replicated.input_size() == kIn);
+    CHECK(replicated.output_size() == kOut);
+    for (size_t node = 0; node < replicated.num_replicas(); ++node) {
+        CHECK(replicated.replica(node).parameter_block().data() != reference.parameter_block().data());
+    }
+    CHECK_THROWS_AS(replicated.replica(replicated.num_replicas()), std::invalid_argument);
+
+    SUBCASE("Forward passes match the source model") {
+        CHECK(replicated.forward(row) == expected_row);
+        std::vector<float> output(rows * kOut);
+        replicated.forward_batch(batch.data(), rows, output.data());
+        CHECK(output == expected);
+
+        ThreadPool pool(ThreadPool::Options{2, false, true});
+        std::fill(output.begin(), output.end(), 0.0f);
+        parallel_forward_batch(replicated, batch.data(), rows, output.data(), pool, 4);
+        CHECK(output == expected);
+
+        auto copy = replicated.clone();
+        CHECK(copy->forward(row) == expected_row);
+    }
+
+    SUBCASE("Rebinding rebuilds every replica") {
+        const std::vector<float> updated = make_values(kParams, 1.9f);
+        TwoLayerMLP target(kIn, kHidden, kOut);
+        target.set_parameters(updated);
+
+        auto copy = replicated.clone();
+        replicated.set_parameters(updated);
+        CHECK(replicated.forward(row) == target.forward(row));
+        CHECK(replicated.get_parameters() == target.get_parameters());
+        // Clones keep the replicas they were made with
+        CHECK(copy->forward(row) == expected_row);
+
+        CHECK_THROWS_AS(replicated.set_parameters(std::vector<float>(10, 0.0f)), std::invalid_argument);
+        CHECK(replicated.forward(row) == target.forward(row));
+
+        replicated.set_weight_precision(WeightPrecision::BFloat16);
+        target.set_weight_precision(WeightPrecision::BFloat16);
+        CHECK(replicated.weight_precision() == WeightPrecision::BFloat16);
+        CHECK(replicated.forward(row) == target.forward(row));
+    }
+
+    SUBCASE("Saves as the wrapped model") {
+        const std::string path = "zetic_replicated_test.zetic";
+        save_zetic_model(replicated, path);
+        auto loaded = load_zetic_model(path);
+        CHECK(loaded->type_name() == "mlp");
+        CHECK(loaded->forward(row) == expected_row);
+        std::remove(path.c_str());
+    }
+}
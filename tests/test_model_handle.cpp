@@ -0,0 +1,164 @@
+/**
+ * ZeticML Assignment - Hot-Swappable Model Handle Unit Tests
+ * Snapshot isolation, epoch-based reclamation and concurrent swaps
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/model_handle.h"
+#include "../src/linear_regression.h"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Linear model whose weights and bias all equal `value`: on an all-ones
+// input it outputs value * (inputs + 1), which identifies the version
+std::shared_ptr<const ZeticML::NeuralNetwork> constant_model(size_t inputs, float value) {
+    auto model = std::make_shared<ZeticML::LinearRegression>(inputs);
+    model->set_parameters(std::vector<float>(inputs + 1, value));
+    return model;
+}
+
+} // namespace
+
+TEST_CASE("Model Handle Publish And Reclaim") {
+    using namespace ZeticML;
+
+    const std::vector<float> ones(8, 1.0f);
+    auto first = constant_model(8, 1.0f);
+    std::weak_ptr<const NeuralNetwork> first_alive = first;
+    ModelHandle handle(std::move(first));
+    CHECK(handle.version() == 1);
+    CHECK(handle.forward(ones)[0] == doctest::Approx(9.0f));
+
+    {
+        ModelHandle::Snapshot pinned = handle.acquire();
+        CHECK(pinned.version() == 1);
+
+        CHECK(handle.publish(constant_model(8, 2.0f)) == 2);
+        CHECK(handle.version() == 2);
+        CHECK(handle.forward(ones)[0] == doctest::Approx(18.0f));
+
+        // The pinned reader keeps seeing version 1, which stays retired
+        CHECK(pinned->forward(ones)[0] == doctest::Approx(9.0f));
+        CHECK(handle.retired_count() == 1);
+        CHECK(handle.reclaim() == 1);
+        CHECK_FALSE(first_alive.expired());
+
+        ModelHandle::Snapshot moved = std::move(pinned);
+        CHECK(moved.version() == 1);
+    }
+    CHECK(handle.reclaim() == 0);
+    CHECK(first_alive.expired());
+
+    // share() keeps a version alive past its retirement
+    std::shared_ptr<const NeuralNetwork> kept = handle.acquire().share();
+    CHECK(handle.publish_parameters(std::vector<float>(9, 3.0f)) == 3);
+    handle.synchronize();
+    CHECK(handle.retired_count() == 0);
+    CHECK(kept->forward(ones)[0] == doctest::Approx(18.0f));
+    CHECK(handle.forward(ones)[0] == doctest::Approx(27.0f));
+
+    // Replacements must keep the model's input and output sizes
+    CHECK_THROWS_AS(handle.publish(constant_model(4, 1.0f)), std::invalid_argument);
+    CHECK_THROWS_AS(handle.publish(nullptr), std::invalid_argument);
+    CHECK_THROWS_AS(handle.publish_parameters(make_values(3, 0.1f)), std::invalid_argument);
+    CHECK(handle.version() == 3);
+    CHECK_THROWS_AS(ModelHandle(nullptr), std::invalid_argument);
+
+    // Every reader slot can be held at once
+    std::vector<ModelHandle::Snapshot> snapshots;
+    for (size_t i = 0; i < ModelHandle::kReaderSlots; ++i) {
+        snapshots.push_back(handle.acquire());
+    }
+    CHECK(snapshots.back().version() == 3);
+}
+
+TEST_CASE("Model Handle Concurrent Swaps") {
+    using namespace ZeticML;
+
+    constexpr size_t kInputs = 16;
+    constexpr int kVersions = 200;
+    const std::vector<float> ones(kInputs, 1.0f);
+    ModelHandle handle(constant_model(kInputs, 1.0f));
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> went_back{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            uint64_t last = 0;
+            while (!done.load()) {
+                ModelHandle::Snapshot snapshot = handle.acquire();
+                const float output = snapshot->forward(ones)[0];
+                // Each version's output is exactly version * (kInputs + 1)
+                if (output != static_cast<float>(snapshot.version() * (kInputs + 1))) {
+                    ++torn;
+                }
+                if (snapshot.version() < last) {
+                    ++went_back;
+                }
+                last = snapshot.version();
+            }
+        });
+    }
+
+    for (int v = 2; v <= kVersions; ++v) {
+        handle.publish(constant_model(kInputs, static_cast<float>(v)));
+        if (v % 16 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(torn == 0);
+    CHECK(went_back == 0);
+    CHECK(handle.version() == kVersions);
+    handle.synchronize();
+    CHECK(handle.retired_count() == 0);
+}
+
+TEST_CASE("Model Handle Version During Publishes") {
+    using namespace ZeticML;
+
+    // version() takes no snapshot, so it must not touch versions a
+    // concurrent publish may retire and free (ASan builds catch that)
+    constexpr size_t kInputs = 4;
+    constexpr int kVersions = 2000;
+    ModelHandle handle(constant_model(kInputs, 1.0f));
+    std::vector<std::shared_ptr<const NeuralNetwork>> models;
+    for (int v = 2; v <= kVersions; ++v) {
+        models.push_back(constant_model(kInputs, static_cast<float>(v)));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> went_back{0};
+    std::thread reader([&] {
+        uint64_t last = 0;
+        while (!done.load()) {
+            const uint64_t version = handle.version();
+            if (version < last) {
+                ++went_back;
+            }
+            last = version;
+        }
+    });
+    for (auto& model : models) {
+        handle.publish(std::move(model));
+    }
+    done = true;
+    reader.join();
+
+    CHECK(went_back == 0);
+    CHECK(handle.version() == kVersions);
+    handle.synchronize();
+    CHECK(handle.retired_count() == 0);
+}
@@ -0,0 +1,150 @@
+/**
+ * ZeticML Assignment - .zetic Loader Unit Tests
+ * Round-trips every model type through the container and checks zero-copy binding
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/model_loader.h"
+#include "../src/model_registry.h"
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+bool points_into(const float* p, const ZeticML::WeightBlock& block, const float* base, size_t bytes) {
+    const char* begin = reinterpret_cast<const char*>(base);
+    const char* ptr = reinterpret_cast<const char*>(p);
+    return ptr >= begin && ptr + block.size_bytes() <= begin + bytes;
+}
+
+} // namespace
+
+TEST_CASE("Zetic Model Round Trip") {
+    using namespace ZeticML;
+    ModelRegistry& registry = get_model_registry();
+
+    std::vector<std::unique_ptr<NeuralNetwork>> models;
+    models.push_back(registry.create_model("linear", 5));
+    models.push_back(registry.create_model("logistic", 7));
+    models.push_back(registry.create_model("multiclass", 19, 5));
+    models.push_back(registry.create_model("mlp", 6, 33, 3));
+
+    const std::string path = "zetic_roundtrip_test.zetic";
+
+    for (auto& model : models) {
+        INFO("Model: " << model->get_model_type());
+
+        // Public parameter count is the size pack_parameters() accepts
+        size_t param_count = 0;
+        const auto d = model->dimensions();
+        if (d.size() == 1) {
+            param_count = d[0] + 1;
+        } else if (d.size() == 2) {
+            param_count = d[0] * d[1] + d[1];
+        } else {
+            param_count = d[0] * d[1] + d[1] + d[1] * d[2] + d[2];
+        }
+        model->set_parameters(make_values(param_count, 0.3f));
+
+        save_zetic_model(*model, path, "roundtrip");
+
+        ZeticModelInfo info = read_zetic_info(path);
+        CHECK_FALSE(info.legacy);
+        CHECK(info.version_major == kZeticVersionMajor);
+        CHECK(info.type_name == model->type_name());
+        CHECK(info.dimensions == model->dimensions());
+        CHECK(info.name == "roundtrip");
+        CHECK(info.weight_bytes == model->parameter_block().size_bytes());
+
+        auto loaded = load_zetic_model(path);
+        REQUIRE(loaded != nullptr);
+        CHECK(loaded->type_name() == model->type_name());
+        CHECK(loaded->input_size() == model->input_size());
+        CHECK(loaded->output_size() == model->output_size());
+
+        // Weights are used in place: the block is owned by the mapping and
+        // starts on a 64-byte boundary
+        const WeightBlock& block = loaded->parameter_block();
+        CHECK(block.owner() != nullptr);
+        CHECK(reinterpret_cast<uintptr_t>(block.data()) % kZeticAlignment == 0);
+        auto mapping = std::static_pointer_cast<const MappedFile>(block.owner());
+        CHECK(points_into(block.data(), block,
+                          reinterpret_cast<const float*>(mapping->data()), mapping->size()));
+
+        auto input = make_values(model->input_size(), 1.1f);
+        auto expected = model->forward(input);
+        auto actual = loaded->forward(input);
+        REQUIRE(actual.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CHECK(actual[i] == expected[i]);
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Zetic Legacy And Malformed Files") {
+    using namespace ZeticML;
+
+    // The bundled model uses the legacy length-prefixed header
+    ZeticModelInfo info = read_zetic_info("../mobile_model.zetic");
+    CHECK(info.legacy);
+    CHECK(info.name == "MobileNet");
+    CHECK_THROWS_AS(load_zetic_model("../mobile_model.zetic"), std::runtime_error);
+
+    CHECK_THROWS_AS(load_zetic_model("does_not_exist.zetic"), std::runtime_error);
+
+    // Truncated weight section
+    const std::string path = "zetic_truncated_test.zetic";
+    auto model = get_model_registry().create_model("linear", 4);
+    save_zetic_model(*model, path);
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 4));
+    }
+    CHECK_THROWS_AS(load_zetic_model(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Zetic Cold Start Touches No Weight Pages") {
+    using namespace ZeticML;
+
+    // 32 MB of fp32 weights: zero-filling a throwaway block would show up
+    // in the peak resident set, binding the mapping does not (reading the
+    // header may map one large page-cache folio, hence the slack)
+    const size_t I = 256, C = 32768;
+    const std::string path = "zetic_cold_start_test.zetic";
+    for (WeightPrecision precision : {WeightPrecision::Float32, WeightPrecision::Float16}) {
+        INFO("Precision: " << precision_name(precision));
+        {
+            MultiClassClassifier source(I, C);
+            source.set_weight_precision(precision);
+            save_zetic_model(source, path);
+        }
+        const size_t weight_bytes = read_zetic_info(path).weight_bytes;
+
+        const bool measured = reset_peak_resident();
+        const size_t before = peak_resident_bytes();
+        auto loaded = load_zetic_model(path);
+        const size_t peak = peak_resident_bytes();
+
+        const WeightBlock& block = loaded->parameter_block();
+        CHECK(block.file_backed());
+        CHECK(block.size_bytes() == weight_bytes);
+        CHECK(loaded->weight_precision() == precision);
+        auto mapping = std::static_pointer_cast<const MappedFile>(block.owner());
+        CHECK(points_into(block.data(), block,
+                          reinterpret_cast<const float*>(mapping->data()), mapping->size()));
+        if (measured) {
+            CHECK(peak - before < weight_bytes / 4);
+        }
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,187 @@
+/**
+ * ZeticML Assignment - Model Registry and Cache Unit Tests
+ * Factory registration, interned type ids, shapes and the LRU instance cache
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/model_cache.h"
+#include "../src/model_loader.h"
+#include "../src/model_registry.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Linear model of `inputs` features: (inputs + 1) floats of parameters
+std::unique_ptr<ZeticML::NeuralNetwork> linear_model(size_t inputs) {
+    auto model = std::make_unique<ZeticML::LinearRegression>(inputs);
+    model->set_parameters(make_values(inputs + 1, 0.2f));
+    return model;
+}
+
+} // namespace
+
+TEST_CASE("Model Registry Factories") {
+    using namespace ZeticML;
+
+    ModelRegistry registry;
+    CHECK(registry.get_registered_types() == std::vector<std::string>{"linear", "logistic", "multiclass", "mlp"});
+
+    const ModelTypeId mlp = registry.type_id("mlp");
+    REQUIRE(mlp != kUnknownModelType);
+    CHECK(registry.type_name(mlp) == "mlp");
+    CHECK(registry.type_id("nonexistent") == kUnknownModelType);
+    CHECK_THROWS_AS(registry.type_name(99), std::invalid_argument);
+
+    // By id, by name with a shape, and the size_t shorthands agree
+    auto by_id = registry.create_model(mlp, ModelShape{8, 16, 4});
+    auto by_shape = registry.create_model("mlp", ModelShape(std::vector<size_t>{8, 16, 4}));
+    auto by_sizes = registry.create_model("mlp", 8, 16, 4);
+    CHECK(by_id->dimensions() == by_sizes->dimensions());
+    CHECK(by_shape->get_model_type() == by_sizes->get_model_type());
+    CHECK(ModelShape(by_id->dimensions()).to_string() == "8x16x4");
+
+    CHECK_THROWS_AS(registry.create_model("linear", 2, 3), std::invalid_argument);
+    CHECK_THROWS_AS(registry.create_model("unknown_type", 2), std::invalid_argument);
+    CHECK_THROWS_AS(ModelShape({1, 2, 3, 4, 5}), std::invalid_argument);
+
+    // Pluggable factories; a variadic one and a replaced one keep their ids
+    const ModelTypeId wide = registry.register_type("wide_linear", 0, [](const ModelShape& s) {
+        size_t inputs = 1;
+        for (size_t d : s) {
+            inputs *= d;
+        }
+        return std::make_unique<LinearRegression>(inputs);
+    });
+    CHECK(wide == 4);
+    CHECK(registry.is_registered("wide_linear"));
+    CHECK(registry.create_model(wide, ModelShape{3, 5})->input_size() == 15);
+    CHECK(registry.create_model(wide, ModelShape{7})->input_size() == 7);
+
+    const ModelTypeId replaced = registry.register_type("wide_linear", 1, [](const ModelShape& s) {
+        return std::make_unique<LogisticRegression>(s[0]);
+    });
+    CHECK(replaced == wide);
+    CHECK(registry.create_model("wide_linear", 6)->type_name() == "logistic");
+    CHECK_THROWS_AS(registry.create_model(wide, ModelShape{3, 5}), std::invalid_argument);
+    CHECK(registry.get_registered_types().size() == 5);
+
+    CHECK_THROWS_AS(registry.register_type("", 1, [](const ModelShape&) { return linear_model(1); }),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(registry.register_type("empty", 1, ModelFactory()), std::invalid_argument);
+}
+
+TEST_CASE("Model Cache LRU Budget") {
+    using namespace ZeticML;
+
+    // Each linear_model(99) is charged 100 floats
+    const size_t entry_bytes = ModelCache::charge(*linear_model(99));
+    CHECK(entry_bytes == 100 * sizeof(float));
+    ModelCache cache(3 * entry_bytes);
+
+    int loads = 0;
+    auto loader = [&] {
+        ++loads;
+        return linear_model(99);
+    };
+    auto a = cache.get("a", loader);
+    cache.get("b", loader);
+    cache.get("c", loader);
+    CHECK(loads == 3);
+    CHECK(cache.get("a", loader) == a);             // Hit; "a" becomes most recent
+    CHECK(loads == 3);
+    CHECK(cache.memory_bytes() == 3 * entry_bytes);
+
+    cache.get("d", loader);                         // Evicts "b", the least recent
+    CHECK(cache.size() == 3);
+    CHECK(cache.find("b") == nullptr);
+    CHECK(cache.find("a") == a);
+    CHECK(cache.find("c") != nullptr);
+
+    ModelCacheStats stats = cache.stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 4);
+    CHECK(stats.evictions == 1);
+    CHECK(stats.memory_budget == 3 * entry_bytes);
+
+    // Shrinking the budget evicts from the cold end; held models stay usable
+    cache.set_memory_budget(entry_bytes);
+    CHECK(cache.size() == 1);
+    CHECK(cache.find("c") != nullptr);
+    CHECK(a->forward(make_values(99, 1.0f)).size() == 1);
+
+    // A model bigger than the whole budget is returned but not kept
+    auto big = cache.get("big", [] { return linear_model(1000); });
+    REQUIRE(big != nullptr);
+    CHECK(cache.find("big") == nullptr);
+
+    CHECK(cache.erase("c"));
+    CHECK_FALSE(cache.erase("c"));
+    CHECK(cache.memory_bytes() == 0);
+
+    cache.insert("manual", linear_model(99));
+    CHECK(cache.find("manual") != nullptr);
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK_THROWS_AS(cache.insert("null", nullptr), std::invalid_argument);
+}
+
+TEST_CASE("Model Cache Concurrent Loads") {
+    using namespace ZeticML;
+
+    ModelCache cache(1 << 20);
+    std::atomic<int> loads{0};
+    auto slow_loader = [&] {
+        ++loads;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return linear_model(15);
+    };
+
+    // Eight threads miss on the same key at once; one load serves all
+    std::vector<std::thread> threads;
+    std::vector<ModelCache::ModelPtr> results(8);
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&, t] { results[t] = cache.get("tenant-7", slow_loader); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(loads == 1);
+    for (const auto& result : results) {
+        CHECK(result == results[0]);
+    }
+
+    // Failing loads cache nothing and rethrow
+    auto failing = []() -> std::unique_ptr<NeuralNetwork> { throw std::runtime_error("disk on fire"); };
+    CHECK_THROWS_AS(cache.get("broken", failing), std::runtime_error);
+    CHECK(cache.find("broken") == nullptr);
+    CHECK(cache.stats().load_failures == 1);
+    CHECK(cache.get("broken", [] { return linear_model(3); }) != nullptr);
+}
+
+TEST_CASE("Model Cache Zetic Files") {
+    using namespace ZeticML;
+
+    const std::string path = "model_cache_test.zetic";
+    auto model = get_model_registry().create_model("multiclass", 12, 5);
+    model->set_parameters(make_values(12 * 5 + 5, 0.9f));
+    save_zetic_model(*model, path);
+
+    {
+        ModelCache cache(1 << 20);
+        auto first = cache.get_file(path);
+        auto second = cache.get_file(path);
+        CHECK(first == second);
+        CHECK(first->get_parameters() == model->get_parameters());
+        CHECK(cache.stats().misses == 1);
+        CHECK_THROWS_AS(cache.get_file("does_not_exist.zetic"), std::runtime_error);
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,98 @@
+/**
+ * ZeticML Assignment - Fused Multi-Head Model Unit Tests
+ * Stacked heads against the separate models they were fused from
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/multi_head_model.h"
+#include "../src/model_registry.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+void check_close(const std::vector<float>& actual, const std::vector<float>& expected, double epsilon = 1e-4) {
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        CHECK(actual[i] == doctest::Approx(expected[i]).epsilon(epsilon));
+    }
+}
+
+} // namespace
+
+TEST_CASE("Multi-Head Fusion Matches Separate Models") {
+    using namespace ZeticML;
+
+    const size_t I = 21;
+    LinearRegression linear(I);
+    LogisticRegression logistic(I);
+    MultiClassClassifier classifier(I, 9);
+    linear.set_parameters(make_values(I + 1, 0.3f, 0.4f));
+    logistic.set_parameters(make_values(I + 1, 1.3f, 0.4f));
+    classifier.set_parameters(make_values(9 * I + 9, 2.3f, 0.4f));
+
+    auto fused = MultiHeadModel::fuse({&linear, &logistic, &classifier});
+    CHECK(fused->num_heads() == 3);
+    CHECK(fused->input_size() == I);
+    CHECK(fused->output_size() == 11);
+    CHECK(fused->heads()[2].offset == 2);
+    CHECK(fused->heads()[2].activation == HeadActivation::Softmax);
+    CHECK(fused->type_name() == "multihead");
+
+    const auto x = make_values(I, 0.8f);
+    const auto heads = fused->forward_heads(x);
+    REQUIRE(heads.size() == 3);
+    check_close(heads[0], linear.forward(x));
+    check_close(heads[1], logistic.forward(x));
+    check_close(heads[2], classifier.forward(x));
+
+    const auto output = fused->forward(x);
+    const Span<const float> probabilities = fused->head_output(Span<const float>(output), 2);
+    CHECK(probabilities.size() == 9);
+    float total = 0.0f;
+    for (float p : probabilities) {
+        total += p;
+    }
+    CHECK(total == doctest::Approx(1.0f));
+
+    // Batches (more rows than one tile) match row by row
+    const size_t rows = 70;
+    const auto batch = make_values(rows * I, 0.1f);
+    std::vector<float> outputs(rows * fused->output_size());
+    fused->forward_batch(batch.data(), rows, outputs.data());
+    for (size_t r = 0; r < rows; r += 23) {
+        const std::vector<float> row(batch.begin() + r * I, batch.begin() + (r + 1) * I);
+        const std::vector<float> fused_row(outputs.begin() + r * 11, outputs.begin() + (r + 1) * 11);
+        check_close(fused_row, fused->forward(row));
+    }
+
+    // 16-bit storage of the stacked matrix
+    auto half = fused->clone();
+    half->set_weight_precision(WeightPrecision::Float16);
+    check_close(half->forward(x), output, 1e-2);
+
+    // Round trip of the stacked parameters
+    MultiHeadModel copy(I, {ModelHead{1, HeadActivation::Identity}, ModelHead{1, HeadActivation::Sigmoid},
+                            ModelHead{9, HeadActivation::Softmax}});
+    copy.set_parameters(fused->get_parameters());
+    CHECK(copy.forward(x) == output);
+}
+
+TEST_CASE("Multi-Head Fusion Validation") {
+    using namespace ZeticML;
+
+    LinearRegression a(8);
+    LinearRegression b(9);
+    auto mlp = get_model_registry().create_model("mlp", 8, 4, 2);
+    CHECK_THROWS_AS(MultiHeadModel::fuse({&a, &b}), std::invalid_argument);
+    CHECK_THROWS_AS(MultiHeadModel::fuse({&a, mlp.get()}), std::invalid_argument);
+    CHECK_THROWS_AS(MultiHeadModel::fuse({}), std::invalid_argument);
+    CHECK_THROWS_AS(MultiHeadModel(8, {}), std::invalid_argument);
+    CHECK_THROWS_AS(MultiHeadModel(8, {ModelHead{0, HeadActivation::Sigmoid}}), std::invalid_argument);
+
+    auto single = MultiHeadModel::fuse({&a});
+    const auto output = single->forward(make_values(8, 0.0f));
+    CHECK_THROWS_AS(single->head_output(Span<const float>(output), 1), std::invalid_argument);
+}
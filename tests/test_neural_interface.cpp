@@ -16,6 +16,7 @@
 #include <fstream>
 #include <sstream>
 #include <cmath>
+#include <thread>
 
 // ==================== Test Data Structure ====================
 
@@ -297,6 +298,196 @@ TEST_CASE("Registry Pattern Polymorphism") {
     }
 }
 
+TEST_CASE("Batched Inference") {
+    using namespace ZeticML;
+
+    auto& registry = get_model_registry();
+
+    std::vector<std::unique_ptr<NeuralNetwork>> models;
+    models.push_back(registry.create_model("linear", 5));
+    models.push_back(registry.create_model("logistic", 5));
+    models.push_back(registry.create_model("multiclass", 5, 7));
+    models.push_back(registry.create_model("mlp", 5, 19, 3));
+
+    const size_t batch_size = 37;  // Not a multiple of any row tile
+
+    for (auto& model : models) {
+        INFO("Testing model type: " << model->get_model_type());
+
+        // Deterministic pseudo-random parameters and inputs
+        size_t param_count = 0;
+        if (model->get_model_type() == "Two-Layer MLP") {
+            param_count = 5 * 19 + 19 + 19 * 3 + 3;
+        } else {
+            param_count = (model->input_size() + 1) * model->output_size();
+        }
+        std::vector<float> params(param_count);
+        for (size_t i = 0; i < params.size(); ++i) {
+            params[i] = std::sin(static_cast<float>(i) * 0.7f) * 0.5f;
+        }
+        model->set_parameters(params);
+
+        std::vector<float> batch(batch_size * model->input_size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i] = std::cos(static_cast<float>(i) * 0.3f);
+        }
+
+        std::vector<float> batch_output(batch_size * model->output_size(), -1.0f);
+        model->forward_batch(batch.data(), batch_size, batch_output.data());
+
+        for (size_t r = 0; r < batch_size; ++r) {
+            std::vector<float> row(batch.begin() + r * model->input_size(),
+                                   batch.begin() + (r + 1) * model->input_size());
+            auto expected = model->forward(row);
+            for (size_t o = 0; o < model->output_size(); ++o) {
+                CHECK(std::abs(batch_output[r * model->output_size() + o] - expected[o]) < 1e-5f);
+            }
+        }
+
+        // Empty batches are a no-op
+        model->forward_batch(batch.data(), 0, batch_output.data());
+    }
+}
+
+TEST_CASE("Span-Based Inference") {
+    using namespace ZeticML;
+
+    auto& registry = get_model_registry();
+    auto model = registry.create_model("mlp", 2, 3, 2);
+    model->set_parameters(std::vector<float>(17, 0.1f));
+
+    // Caller-owned buffers reused across calls
+    float input[2] = {1.0f, 2.0f};
+    float output[2] = {0.0f, 0.0f};
+
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        model->forward_into(Span<const float>(input, 2), Span<float>(output, 2));  // hidden 0.4 each
+        CHECK(std::abs(output[0] - 0.22f) < 1e-5f);
+        CHECK(std::abs(output[1] - 0.22f) < 1e-5f);
+    }
+
+    // The vector wrapper goes through the same path
+    auto wrapped = model->forward({1.0f, 2.0f});
+    CHECK(wrapped == std::vector<float>(output, output + 2));
+
+    SUBCASE("Span size validation") {
+        CHECK_THROWS(model->forward_into(Span<const float>(input, 1), Span<float>(output, 2)));
+        CHECK_THROWS(model->forward_into(Span<const float>(input, 2), Span<float>(output, 1)));
+    }
+}
+
+TEST_CASE("Moved And Shared Parameters") {
+    using namespace ZeticML;
+
+    auto& registry = get_model_registry();
+
+    SUBCASE("Rvalue set_parameters adopts the buffer") {
+        auto model = registry.create_model("linear", 3);
+        std::vector<float> params = {0.5f, 0.3f, 0.2f, 0.1f};
+        const float* buffer = params.data();
+        model->set_parameters(std::move(params));
+
+        CHECK(model->parameter_block().data() == buffer);
+        auto output = model->forward({1.5f, -0.5f, 2.0f});
+        CHECK(std::abs(output[0] - 1.1f) < 1e-5f);
+    }
+
+    SUBCASE("Replicas share one immutable array") {
+        // 16 inputs: rows need no padding, so the public order is native
+        const size_t inputs = 16, classes = 3;
+        const size_t count = inputs * classes + classes;
+        std::shared_ptr<float[]> storage(new float[count]);
+        for (size_t i = 0; i < count; ++i) {
+            storage[i] = 0.01f * static_cast<float>(i % 7);
+        }
+        std::shared_ptr<const float[]> shared = storage;
+
+        auto a = registry.create_model("multiclass", inputs, classes);
+        auto b = registry.create_model("multiclass", inputs, classes);
+        a->set_parameters(shared, count);
+        b->set_parameters(shared, count);
+        CHECK(a->parameter_block().data() == shared.get());
+        CHECK(b->parameter_block().data() == shared.get());
+
+        std::vector<float> input(inputs, 1.0f);
+        CHECK(a->forward(input) == b->forward(input));
+
+        // Padded layouts repack once instead of aliasing the caller's array
+        auto padded = registry.create_model("multiclass", 15, classes);
+        padded->set_parameters(shared, 15 * classes + classes);
+        CHECK(padded->parameter_block().data() != shared.get());
+    }
+
+    SUBCASE("share_parameters reuses another model's block") {
+        auto first = registry.create_model("mlp", 2, 3, 2);
+        first->set_parameters(std::vector<float>(17, 0.1f));
+        auto second = registry.create_model("mlp", 2, 3, 2);
+        second->share_parameters(*first);
+
+        CHECK(second->parameter_block().data() == first->parameter_block().data());
+        CHECK(second->forward({1.0f, 2.0f}) == first->forward({1.0f, 2.0f}));
+    }
+
+    SUBCASE("Size validation") {
+        auto model = registry.create_model("linear", 3);
+        CHECK_THROWS_AS(model->set_parameters(std::vector<float>(2, 0.0f)), std::invalid_argument);
+        std::shared_ptr<const float[]> small(new float[2]());
+        CHECK_THROWS_AS(model->set_parameters(small, 2), std::invalid_argument);
+        auto other = registry.create_model("linear", 4);
+        CHECK_THROWS_AS(model->share_parameters(*other), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Concurrent Const Inference") {
+    using namespace ZeticML;
+
+    auto& registry = get_model_registry();
+    std::unique_ptr<const NeuralNetwork> model = [&] {
+        auto m = registry.create_model("mlp", 8, 64, 4);
+        std::vector<float> params(8 * 64 + 64 + 64 * 4 + 4);
+        for (size_t i = 0; i < params.size(); ++i) {
+            params[i] = std::sin(static_cast<float>(i) * 0.13f);
+        }
+        m->set_parameters(std::move(params));
+        return std::unique_ptr<const NeuralNetwork>(std::move(m));
+    }();
+
+    const size_t batch_size = 37;
+    std::vector<float> batch(batch_size * 8);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i] = std::cos(static_cast<float>(i) * 0.29f);
+    }
+    std::vector<float> expected(batch_size * 4);
+    model->forward_batch(batch.data(), batch_size, expected.data());
+
+    // One shared model, one context per thread, no locking
+    const int num_threads = 8;
+    std::vector<std::vector<float>> results(num_threads, std::vector<float>(batch_size * 4));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            InferenceContext context;
+            for (int repeat = 0; repeat < 20; ++repeat) {
+                model->forward_batch(batch.data(), batch_size, results[t].data(), context);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& result : results) {
+        CHECK(result == expected);
+    }
+
+    // Clones share weights and produce identical results
+    auto copy = model->clone();
+    CHECK(copy->parameter_block().data() == model->parameter_block().data());
+    CHECK(copy->type_name() == model->type_name());
+    std::vector<float> cloned(batch_size * 4);
+    copy->forward_batch(batch.data(), batch_size, cloned.data());
+    CHECK(cloned == expected);
+}
+
 TEST_CASE("Model Error Handling") {
     using namespace ZeticML;
 
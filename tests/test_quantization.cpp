@@ -0,0 +1,181 @@
+/**
+ * ZeticML Assignment - INT8 Quantization Unit Tests
+ * Int8 kernel variants, quantized models for every type and calibration
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/quantization.h"
+#include "../src/int8_kernels.h"
+#include "../src/model_registry.h"
+#include "../src/test_data_loader.h"
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+std::vector<int8_t> make_int8(size_t n, int seed) {
+    std::vector<int8_t> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = static_cast<int8_t>(static_cast<int>((i * 37 + seed * 11) % 255) - 127);
+    }
+    return values;
+}
+
+std::vector<float> make_batch(size_t rows, size_t size) {
+    std::vector<float> batch(rows * size);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch[i] = 2.0f * std::cos(static_cast<float>(i) * 0.29f);
+    }
+    return batch;
+}
+
+std::vector<float> mlp_params(size_t I, size_t H, size_t O) {
+    std::vector<float> params(I * H + H + H * O + O);
+    for (size_t i = 0; i < params.size(); ++i) {
+        params[i] = 0.5f * std::sin(static_cast<float>(i) * 0.37f);
+    }
+    return params;
+}
+
+} // namespace
+
+TEST_CASE("Int8 Kernels") {
+    using namespace ZeticML;
+
+    const size_t rows = 7, n = 192, stride = 256;
+    const auto W = make_int8(rows * stride, 1);
+    const auto x = make_int8(n, 2);
+
+    std::vector<int32_t> expected(rows, 0);
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t k = 0; k < n; ++k) {
+            expected[r] += static_cast<int32_t>(W[r * stride + k]) * x[k];
+        }
+    }
+
+    auto tables = available_int8_kernel_tables();
+    REQUIRE(!tables.empty());
+    CHECK(tables.back()->isa == Int8KernelIsa::Scalar);
+    CHECK(int8_kernel_table(Int8KernelIsa::Scalar) != nullptr);
+
+    for (const Int8KernelTable* table : tables) {
+        INFO("ISA: " << table->name);
+        std::vector<int32_t> out(rows, -1);
+        table->matvec(W.data(), stride, rows, x.data(), n, out.data());
+        CHECK(out == expected);
+
+        // Extremes of the quantized range: 127 * 127 * n
+        std::vector<int8_t> hi(kInt8Block * 2, 127), lo(kInt8Block * 2, -127);
+        int32_t acc = 0;
+        table->matvec(hi.data(), hi.size(), 1, lo.data(), lo.size(), &acc);
+        CHECK(acc == -127 * 127 * static_cast<int32_t>(hi.size()));
+    }
+}
+
+TEST_CASE("Quantized Models") {
+    using namespace ZeticML;
+    auto& registry = get_model_registry();
+
+    SUBCASE("Every model type stays close to fp32") {
+        struct Case {
+            std::unique_ptr<NeuralNetwork> model;
+            size_t parameters;
+            float tolerance;
+        };
+        std::vector<Case> cases;
+        cases.push_back({registry.create_model("linear", 100), 101, 0.05f});
+        cases.push_back({registry.create_model("logistic", 100), 101, 0.01f});
+        cases.push_back({registry.create_model("multiclass", 100, 10), 100 * 10 + 10, 0.01f});
+        cases.push_back({registry.create_model("mlp", 100, 64, 10), 100 * 64 + 64 + 64 * 10 + 10, 0.05f});
+
+        const size_t batch = 45;  // More than one row tile
+        for (auto& c : cases) {
+            INFO("Model: " << c.model->type_name());
+            c.model->set_parameters(make_values(c.parameters, 0.3f, 0.2f, 0.37f));
+            const size_t I = c.model->input_size(), O = c.model->output_size();
+            const auto inputs = make_batch(batch, I);
+
+            auto quantized = quantize_model(*c.model, inputs.data(), batch);
+            CHECK(quantized->input_size() == I);
+            CHECK(quantized->output_size() == O);
+            CHECK(quantized->type_name() == "int8-" + c.model->type_name());
+            CHECK(quantized->dimensions() == c.model->dimensions());
+
+            std::vector<float> expected(batch * O), actual(batch * O);
+            c.model->forward_batch(inputs.data(), batch, expected.data());
+            quantized->forward_batch(inputs.data(), batch, actual.data());
+            float max_diff = 0.0f;
+            for (size_t i = 0; i < expected.size(); ++i) {
+                max_diff = std::max(max_diff, std::abs(expected[i] - actual[i]));
+            }
+            INFO("max |diff| = " << max_diff);
+            CHECK(max_diff < c.tolerance);
+
+            // Single-sample path matches the batched one
+            std::vector<float> row(inputs.begin(), inputs.begin() + I);
+            auto single = quantized->forward(row);
+            for (size_t o = 0; o < O; ++o) {
+                CHECK(single[o] == actual[o]);
+            }
+
+            // Dequantized parameters are within half a step of the originals
+            auto original = c.model->get_parameters();
+            auto restored = quantized->get_parameters();
+            REQUIRE(restored.size() == original.size());
+            for (size_t i = 0; i < original.size(); ++i) {
+                CHECK(std::abs(restored[i] - original[i]) <= 0.2f / 127.0f);
+            }
+        }
+
+        // Dense weights shrink to roughly a quarter
+        const auto& mlp = cases.back().model;
+        auto quantized_mlp = quantize_model(*mlp, make_batch(4, 100).data(), 4);
+        CHECK(quantized_mlp->parameter_block().size_bytes() * 3 < mlp->parameter_block().size_bytes());
+    }
+
+    SUBCASE("Clones share the quantized block") {
+        auto model = registry.create_model("multiclass", 40, 5);
+        model->set_parameters(make_values(40 * 5 + 5, 0.3f, 1.0f, 0.11f));
+        auto quantized = quantize_model(*model, make_batch(8, 40).data(), 8);
+        auto copy = quantized->clone();
+        CHECK(copy->parameter_block().data() == quantized->parameter_block().data());
+        auto input = make_values(40, 0.3f, 1.0f, 0.5f);
+        CHECK(copy->forward(input) == quantized->forward(input));
+    }
+
+    SUBCASE("Validation") {
+        auto model = registry.create_model("linear", 4);
+        CHECK_THROWS_AS(quantize_model(*model, nullptr, 0), std::invalid_argument);
+        CHECK_THROWS_AS(QuantizedModel("unknown", {4}), std::invalid_argument);
+        CHECK_THROWS_AS(QuantizedModel("mlp", {4, 2}), std::invalid_argument);
+
+        QuantizedModel quantized("linear", {4});
+        CHECK_THROWS_AS(quantized.set_activation_scales({1.0f, 1.0f}), std::invalid_argument);
+        CHECK_THROWS_AS(quantized.set_activation_scales({0.0f}), std::invalid_argument);
+        CHECK_THROWS_AS(quantized.set_parameters(std::vector<float>(4, 0.0f)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Quantization Calibration From Data File") {
+    using namespace ZeticML;
+
+    auto dataset = TestDataLoader::load_from_file("../tests/data/quantization_calibration.txt");
+    REQUIRE(dataset.size() == 40);
+
+    auto model = get_model_registry().create_model("mlp", 8, 16, 4);
+    model->set_parameters(mlp_params(8, 16, 4));
+
+    auto quantized = quantize_model(*model, dataset);
+    REQUIRE(quantized->activation_scales().size() == 2);
+
+    auto report = evaluate_quantization(*model, *quantized, dataset);
+    std::cout << report.to_string() << std::endl;
+    CHECK(report.samples == dataset.size());
+    CHECK(report.fp32_mean_abs_error < 1e-3);
+    CHECK(report.int8_mean_abs_error < 0.05);
+    CHECK(report.max_abs_error < 0.1);
+    CHECK(report.argmax_agreement >= 0.9);
+}
@@ -0,0 +1,185 @@
+/**
+ * ZeticML Assignment - Inference Result Cache Unit Tests
+ * Hits skipping the forward pass, TTL, LRU bounds and hot-swap invalidation
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/result_cache.h"
+#include "../src/logistic_regression.h"
+#include "../src/multi_class_classifier.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Classifier counting the rows that actually reach the forward pass
+class CountingClassifier : public ZeticML::MultiClassClassifier {
+public:
+    using MultiClassClassifier::MultiClassClassifier;
+
+    mutable std::atomic<size_t> rows{0};
+
+protected:
+    void run(const float* input, float* output, ZeticML::InferenceContext& context) const override {
+        ++rows;
+        MultiClassClassifier::run(input, output, context);
+    }
+    void run_batch(const float* input, size_t batch_size, float* output,
+                   ZeticML::InferenceContext& context) const override {
+        rows += batch_size;
+        MultiClassClassifier::run_batch(input, batch_size, output, context);
+    }
+};
+
+std::shared_ptr<CountingClassifier> counting_model(float phase) {
+    auto model = std::make_shared<CountingClassifier>(12, 5);
+    model->set_parameters(make_values(12 * 5 + 5, phase));
+    return model;
+}
+
+} // namespace
+
+TEST_CASE("Result Cache Hits And Bounds") {
+    using namespace ZeticML;
+
+    const auto a = make_values(12, 0.1f);
+    const auto b = make_values(12, 0.2f);
+    CHECK(ResultCache::hash_input(Span<const float>(a)) == ResultCache::hash_input(Span<const float>(a)));
+    CHECK(ResultCache::hash_input(Span<const float>(a)) != ResultCache::hash_input(Span<const float>(b)));
+    const std::vector<float> zero = {0.0f}, negative_zero = {-0.0f};
+    CHECK(ResultCache::hash_input(Span<const float>(zero)) != ResultCache::hash_input(Span<const float>(negative_zero)));
+
+    auto model = counting_model(0.5f);
+    ResultCacheOptions options;
+    options.ttl = std::chrono::milliseconds(0);
+    CachedModel cached(model, options);
+
+    const auto first = cached.forward(a);
+    CHECK(first == model->forward(a));
+    model->rows = 0;
+    CHECK(cached.forward(a) == first);              // Served without a forward pass
+    CHECK(model->rows == 0);
+    CHECK(cached.forward(b) == model->forward(b));
+    CHECK(model->rows == 2);
+
+    ResultCacheStats stats = cached.stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 2);
+    CHECK(stats.entries == 2);
+
+    // Batches run only their missing rows, as one batch
+    std::vector<float> batch;
+    for (int r = 0; r < 6; ++r) {
+        const auto row = r % 2 == 0 ? a : make_values(12, 1.0f + r);
+        batch.insert(batch.end(), row.begin(), row.end());
+    }
+    std::vector<float> outputs(6 * 5), expected(6 * 5);
+    model->forward_batch(batch.data(), 6, expected.data());
+    model->rows = 0;
+    cached.forward_batch(batch.data(), 6, outputs.data());
+    CHECK(outputs == expected);
+    CHECK(model->rows == 3);
+
+    cached.invalidate();
+    CHECK(cached.stats().entries == 0);
+
+    // Capacity bounds every shard's LRU list
+    ResultCacheOptions small;
+    small.capacity = 4;
+    small.shards = 1;
+    small.ttl = std::chrono::milliseconds(0);
+    CachedModel bounded(model, small);
+    std::vector<std::vector<float>> inputs;
+    for (int i = 0; i < 10; ++i) {
+        inputs.push_back(make_values(12, 0.01f * i));
+        bounded.forward(inputs.back());
+    }
+    CHECK(bounded.stats().entries == 4);
+    CHECK(bounded.stats().evictions == 6);
+    model->rows = 0;
+    bounded.forward(inputs[9]);                     // Most recent: still cached
+    bounded.forward(inputs[0]);                     // Oldest: evicted
+    CHECK(model->rows == 1);
+
+    CHECK_THROWS_AS(cached.forward(make_values(3, 0.0f)), std::invalid_argument);
+    CHECK_THROWS_AS(CachedModel(std::shared_ptr<const NeuralNetwork>()), std::invalid_argument);
+    small.capacity = 0;
+    CHECK_THROWS_AS(ResultCache{small}, std::invalid_argument);
+}
+
+TEST_CASE("Result Cache TTL And Hot Swaps") {
+    using namespace ZeticML;
+
+    const auto x = make_values(12, 0.3f);
+    auto model = counting_model(0.5f);
+
+    ResultCacheOptions options;
+    options.ttl = std::chrono::milliseconds(30);
+    CachedModel expiring(model, options);
+    expiring.forward(x);
+    expiring.forward(x);
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    model->rows = 0;
+    expiring.forward(x);
+    CHECK(model->rows == 1);
+    CHECK(expiring.stats().expired == 1);
+    CHECK(expiring.stats().hits == 1);
+
+    // Publishing a new version invalidates without a flush
+    ModelHandle handle(model);
+    options.ttl = std::chrono::milliseconds(0);
+    CachedModel served(handle, options);
+    const auto before = served.forward(x);
+    CHECK(served.forward(x) == before);
+
+    auto replacement = counting_model(1.5f);
+    handle.publish(replacement);
+    const auto after = served.forward(x);
+    CHECK(after == replacement->forward(x));
+    CHECK(after != before);
+    CHECK(served.stats().stale == 1);
+    replacement->rows = 0;
+    CHECK(served.forward(x) == after);
+    CHECK(replacement->rows == 0);
+}
+
+TEST_CASE("Result Cache Concurrent Use") {
+    using namespace ZeticML;
+
+    auto model = counting_model(0.8f);
+    ResultCacheOptions options;
+    options.capacity = 64;
+    options.ttl = std::chrono::milliseconds(0);
+    CachedModel cached(model, options);
+
+    // Eight threads cycling through 16 distinct inputs
+    std::vector<std::vector<float>> inputs;
+    for (int i = 0; i < 16; ++i) {
+        inputs.push_back(make_values(12, 0.1f * i));
+    }
+    std::atomic<int> wrong{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 200; ++i) {
+                const auto& x = inputs[(t + i) % 16];
+                if (cached.forward(x) != model->forward(x)) {
+                    ++wrong;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(wrong == 0);
+    ResultCacheStats stats = cached.stats();
+    CHECK(stats.hits + stats.misses == 8 * 200);
+    CHECK(stats.entries <= 16);
+    CHECK(stats.hits >= 8 * 200 - 8 * 16);
+}
@@ -0,0 +1,118 @@
+/**
+ * ZeticML Assignment - Sparse Input Unit Tests
+ * Sparse and CSR inference for the linear models against dense forward()
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/linear_regression.h"
+#include "../src/logistic_regression.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Scattered, unsorted feature indices below width
+std::vector<uint32_t> make_indices(size_t count, size_t width, size_t seed) {
+    std::vector<uint32_t> indices(count);
+    for (size_t i = 0; i < count; ++i) {
+        indices[i] = static_cast<uint32_t>((i * 104729 + seed * 7919 + 17) % width);
+    }
+    return indices;
+}
+
+std::vector<float> densify(const std::vector<uint32_t>& indices, const std::vector<float>& values,
+                           size_t width) {
+    std::vector<float> dense(width, 0.0f);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        dense[indices[i]] += values[i];
+    }
+    return dense;
+}
+
+} // namespace
+
+TEST_CASE("Sparse Vectors Match Dense Inference") {
+    using namespace ZeticML;
+
+    const size_t width = 200000;
+    LinearRegression linear(width);
+    LogisticRegression logistic(width);
+    linear.set_parameters(make_values(width + 1, 0.3f, 0.1f));
+    logistic.set_parameters(make_values(width + 1, 1.7f, 0.1f));
+
+    for (size_t nnz : {0, 1, 7, 50, 133}) {
+        INFO("nnz: " << nnz);
+        const auto indices = make_indices(nnz, width, nnz);
+        const auto values = make_values(nnz, 0.5f, 2.0f);
+        const SparseVector x{Span<const uint32_t>(indices), Span<const float>(values)};
+        const auto dense = densify(indices, values, width);
+
+        CHECK(linear.forward_sparse(x) == doctest::Approx(linear.forward(dense)[0]).epsilon(1e-4));
+        CHECK(logistic.forward_sparse(x) == doctest::Approx(logistic.forward(dense)[0]).epsilon(1e-4));
+    }
+
+    SUBCASE("Repeated indices add up") {
+        const std::vector<uint32_t> indices = {5, 9, 5};
+        const std::vector<float> values = {1.0f, -2.0f, 0.5f};
+        const SparseVector x{Span<const uint32_t>(indices), Span<const float>(values)};
+        CHECK(linear.forward_sparse(x) ==
+              doctest::Approx(linear.forward(densify(indices, values, width))[0]));
+    }
+
+    SUBCASE("Invalid sparse rows") {
+        const std::vector<uint32_t> out_of_range = {3, static_cast<uint32_t>(width)};
+        const std::vector<float> values = {1.0f, 1.0f};
+        CHECK_THROWS_AS(linear.forward_sparse({Span<const uint32_t>(out_of_range),
+                                               Span<const float>(values)}),
+                        std::invalid_argument);
+        const std::vector<uint32_t> short_indices = {3};
+        CHECK_THROWS_AS(logistic.forward_sparse({Span<const uint32_t>(short_indices),
+                                                 Span<const float>(values)}),
+                        std::invalid_argument);
+    }
+}
+
+TEST_CASE("CSR Batches") {
+    using namespace ZeticML;
+
+    const size_t width = 5000, rows = 9;
+    LogisticRegression model(width);
+    model.set_parameters(make_values(width + 1, 0.8f, 0.2f));
+
+    // Row r has 3 * r non-zeros, so row 0 is empty
+    std::vector<size_t> offsets = {0};
+    std::vector<uint32_t> indices;
+    std::vector<float> values;
+    for (size_t r = 0; r < rows; ++r) {
+        const auto row_indices = make_indices(3 * r, width, r);
+        const auto row_values = make_values(3 * r, 0.2f * r);
+        indices.insert(indices.end(), row_indices.begin(), row_indices.end());
+        values.insert(values.end(), row_values.begin(), row_values.end());
+        offsets.push_back(indices.size());
+    }
+    const CsrMatrix batch{Span<const size_t>(offsets), Span<const uint32_t>(indices),
+                          Span<const float>(values)};
+    REQUIRE(batch.rows() == rows);
+
+    std::vector<float> output(rows);
+    model.forward_sparse_batch(batch, output.data());
+    for (size_t r = 0; r < rows; ++r) {
+        CHECK(output[r] == doctest::Approx(model.forward_sparse(batch.row(r))));
+    }
+
+    SUBCASE("Invalid row offsets") {
+        std::vector<size_t> bad = offsets;
+        bad[3] = bad[4] + 1;
+        const CsrMatrix broken{Span<const size_t>(bad), Span<const uint32_t>(indices),
+                               Span<const float>(values)};
+        CHECK_THROWS_AS(model.forward_sparse_batch(broken, output.data()), std::invalid_argument);
+
+        bad = offsets;
+        bad.back() = indices.size() + 1;
+        const CsrMatrix overrun{Span<const size_t>(bad), Span<const uint32_t>(indices),
+                                Span<const float>(values)};
+        CHECK_THROWS_AS(model.forward_sparse_batch(overrun, output.data()), std::invalid_argument);
+    }
+}
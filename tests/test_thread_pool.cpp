@@ -0,0 +1,117 @@
+/**
+ * ZeticML Assignment - Thread Pool Unit Tests
+ * Coverage, exception propagation and parallel batch inference equivalence
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/thread_pool.h"
+#include "../src/parallel_inference.h"
+#include "../src/model_registry.h"
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Thread Pool Parallel For") {
+    using namespace ZeticML;
+
+    for (size_t threads : {1, 3, 8}) {
+        ThreadPool::Options options;
+        options.num_threads = threads;
+        options.pin_threads = (threads == 3);
+        ThreadPool pool(options);
+        CHECK(pool.size() == threads);
+
+        SUBCASE("Every index runs exactly once") {
+            for (size_t grain : {1, 7, 64, 5000}) {
+                std::vector<std::atomic<int>> hits(1000);
+                pool.parallel_for(0, hits.size(), grain, [&](size_t begin, size_t end) {
+                    CHECK(end - begin <= grain);
+                    for (size_t i = begin; i < end; ++i) {
+                        hits[i].fetch_add(1);
+                    }
+                });
+                for (const auto& hit : hits) {
+                    CHECK(hit.load() == 1);
+                }
+            }
+        }
+
+        SUBCASE("Nested loops run inline") {
+            std::atomic<size_t> total{0};
+            pool.parallel_for(0, 16, 1, [&](size_t, size_t) {
+                pool.parallel_for(0, 10, 1, [&](size_t begin, size_t end) {
+                    total.fetch_add(end - begin);
+                });
+            });
+            CHECK(total.load() == 160);
+        }
+
+        SUBCASE("Exceptions reach the caller") {
+            std::atomic<size_t> ran{0};
+            CHECK_THROWS_AS(pool.parallel_for(0, 100, 1, [&](size_t begin, size_t) {
+                ran.fetch_add(1);
+                if (begin == 42) {
+                    throw std::runtime_error("tile failed");
+                }
+            }), std::runtime_error);
+            CHECK(ran.load() >= 43);
+
+            // The pool stays usable afterwards
+            std::atomic<size_t> after{0};
+            pool.parallel_for(0, 10, 1, [&](size_t, size_t) { after.fetch_add(1); });
+            CHECK(after.load() == 10);
+        }
+    }
+}
+
+TEST_CASE("Parallel Batch Inference") {
+    using namespace ZeticML;
+
+    auto& registry = get_model_registry();
+    std::vector<std::unique_ptr<NeuralNetwork>> models;
+    models.push_back(registry.create_model("logistic", 9));
+    models.push_back(registry.create_model("multiclass", 24, 11));
+    models.push_back(registry.create_model("mlp", 12, 40, 5));
+
+    ThreadPool::Options options;
+    options.num_threads = 4;
+    ThreadPool pool(options);
+
+    const size_t batch_size = 1037;
+    for (auto& model : models) {
+        INFO("Model: " << model->get_model_type());
+
+        const auto d = model->dimensions();
+        size_t param_count = d[0] + 1;
+        if (d.size() == 2) {
+            param_count = d[0] * d[1] + d[1];
+        } else if (d.size() == 3) {
+            param_count = d[0] * d[1] + d[1] + d[1] * d[2] + d[2];
+        }
+        model->set_parameters(make_values(param_count, 0.4f));
+
+        auto batch = make_values(batch_size * model->input_size(), 1.7f);
+        std::vector<float> serial(batch_size * model->output_size());
+        model->forward_batch(batch.data(), batch_size, serial.data());
+
+        // Odd tile sizes move rows between vector lanes and scalar tails,
+        // which must round the same way
+        for (size_t rows_per_tile : {0, 1, 7, 16, 33, 100}) {
+            std::vector<float> parallel(serial.size(), -1.0f);
+            parallel_forward_batch(*model, batch.data(), batch_size, parallel.data(),
+                                   pool, rows_per_tile);
+            CHECK(parallel == serial);
+        }
+    }
+
+    SUBCASE("Tile heuristic") {
+        const auto& model = *models[2];
+        CHECK(choose_rows_per_tile(model, 1, 4) == 1);
+        CHECK(choose_rows_per_tile(model, 10, 4) == 10);
+        // 100k rows on 32 threads: balance bound = ceil(100000 / 128) = 782
+        // rows, cache bound = 128 KB / (17 * 4 B) = 1927 rows
+        CHECK(choose_rows_per_tile(model, 100000, 32) == 782);
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * ZeticML Assignment - Top-k Output Mode Unit Tests
+ * MultiClassClassifier top_k / argmax against the full softmax forward pass
+ */
+
+#include "doctest.h"
+#include "test_helpers.h"
+#include "../src/multi_class_classifier.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Reference ranking from the full probability vector, ties to the lower index
+std::vector<size_t> ranking(const std::vector<float>& probabilities) {
+    std::vector<size_t> order(probabilities.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return probabilities[a] > probabilities[b]; });
+    return order;
+}
+
+} // namespace
+
+TEST_CASE("Top-k Matches Full Softmax") {
+    using namespace ZeticML;
+
+    // More classes than one chunk and (at this width) than one class block
+    const size_t I = 37, C = 3001, k = 5;
+    MultiClassClassifier model(I, C);
+    model.set_parameters(make_values(model.get_parameters().size(), 0.4f, 0.3f));
+
+    for (int sample = 0; sample < 3; ++sample) {
+        const auto x = make_values(I, 1.1f * sample);
+        const auto probabilities = model.forward(x);
+        const auto order = ranking(probabilities);
+
+        const auto top = model.top_k(x, k);
+        REQUIRE(top.size() == k);
+        for (size_t i = 0; i < k; ++i) {
+            CHECK(top[i].index == order[i]);
+            CHECK(top[i].score == doctest::Approx(probabilities[order[i]]).epsilon(1e-4));
+        }
+
+        const auto logits = model.top_k(x, k, TopKScore::Logit);
+        for (size_t i = 0; i < k; ++i) {
+            CHECK(logits[i].index == order[i]);
+            if (i > 0) {
+                CHECK(logits[i].score <= logits[i - 1].score);
+            }
+        }
+        CHECK(model.argmax(x) == order[0]);
+    }
+}
+
+TEST_CASE("Top-k Batch And Edge Cases") {
+    using namespace ZeticML;
+
+    const size_t I = 12, C = 40, k = 3, batch = 70;
+    MultiClassClassifier model(I, C);
+    model.set_parameters(make_values(model.get_parameters().size(), 0.9f, 0.5f));
+
+    SUBCASE("Batch rows match single samples across row groups") {
+        std::vector<float> inputs(batch * I);
+        for (size_t r = 0; r < batch; ++r) {
+            const auto x = make_values(I, 0.13f * r);
+            std::copy(x.begin(), x.end(), inputs.begin() + r * I);
+        }
+        std::vector<ClassScore> results(batch * k);
+        model.top_k_batch(inputs.data(), batch, k, results.data());
+
+        for (size_t r = 0; r < batch; ++r) {
+            const std::vector<float> x(inputs.begin() + r * I, inputs.begin() + (r + 1) * I);
+            const auto single = model.top_k(x, k);
+            for (size_t i = 0; i < k; ++i) {
+                CHECK(results[r * k + i].index == single[i].index);
+                CHECK(results[r * k + i].score == doctest::Approx(single[i].score));
+            }
+        }
+    }
+
+    SUBCASE("k equal to the class count returns the whole distribution") {
+        const auto x = make_values(I, 0.5f);
+        const auto probabilities = model.forward(x);
+        const auto top = model.top_k(x, C);
+        float total = 0.0f;
+        for (size_t i = 0; i < C; ++i) {
+            total += top[i].score;
+            CHECK(top[i].score == doctest::Approx(probabilities[top[i].index]).epsilon(1e-4));
+        }
+        CHECK(total == doctest::Approx(1.0f).epsilon(1e-4));
+    }
+
+    SUBCASE("Ties go to the lower class index") {
+        // All-zero weights: every class ties with 1 / C
+        model.set_parameters(std::vector<float>(model.get_parameters().size(), 0.0f));
+        const auto top = model.top_k(make_values(I, 0.5f), k);
+        for (size_t i = 0; i < k; ++i) {
+            CHECK(top[i].index == i);
+            CHECK(top[i].score == doctest::Approx(1.0f / C));
+        }
+    }
+
+    SUBCASE("16-bit weights") {
+        model.set_weight_precision(WeightPrecision::BFloat16);
+        const auto x = make_values(I, 0.2f);
+        CHECK(model.argmax(x) == ranking(model.forward(x))[0]);
+    }
+
+    SUBCASE("Invalid arguments") {
+        const auto x = make_values(I, 0.0f);
+        CHECK_THROWS_AS(model.top_k(x, 0), std::invalid_argument);
+        CHECK_THROWS_AS(model.top_k(x, C + 1), std::invalid_argument);
+        CHECK_THROWS_AS(model.top_k(make_values(I + 1, 0.0f), k), std::invalid_argument);
+        CHECK_THROWS_AS(model.top_k_batch(nullptr, 2, k, nullptr), std::invalid_argument);
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * ZeticML Assignment - Dataset Converter
+ * Converts text evaluation datasets to the binary columnar .zds format
+ *
+ *   zetic_convert_dataset <input.txt> <output.zds>   convert (either text format)
+ *   zetic_convert_dataset --info <file.zds>          print rows and column widths
+ */
+
+#include "../src/dataset_file.h"
+#include "../src/thread_pool.h"
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    using namespace ZeticML;
+
+    try {
+        if (argc == 3 && std::strcmp(argv[1], "--info") == 0) {
+            const DatasetFile dataset(argv[2]);
+            std::cout << argv[2] << ": " << dataset.rows() << " rows, input " << dataset.input_size()
+                      << ", expected " << dataset.output_size() << ", parameters "
+                      << dataset.parameter_size() << std::endl;
+            return 0;
+        }
+        if (argc != 3) {
+            std::cerr << "Usage: " << argv[0] << " <input.txt> <output.zds>\n"
+                      << "       " << argv[0] << " --info <file.zds>" << std::endl;
+            return 2;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const size_t rows = convert_text_dataset(argv[1], argv[2], &ThreadPool::shared());
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Converted " << rows << " rows from " << argv[1] << " to " << argv[2] << " in "
+                  << seconds << " s" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}